@@ -33,6 +33,7 @@ project "Akkad"
         "%{IncludeDir.json}",
         "%{IncludeDir.box2d}",
         "%{IncludeDir.curl}",
+        "%{IncludeDir.concurrentqueue}",
     }
     
     links
@@ -63,23 +64,47 @@ project "Akkad"
             "src/Akkad/Platforms/Desktop/Windows/**.cpp",
             "src/Akkad/Graphics/API/OpenGL/**.h",
             "src/Akkad/Graphics/API/OpenGL/**.cpp",
+            "src/Akkad/Platforms/Headless/**.h",
+            "src/Akkad/Platforms/Headless/**.cpp",
+            "src/Akkad/Graphics/API/Null/**.h",
+            "src/Akkad/Graphics/API/Null/**.cpp",
         }
 
 
     
     filter "system:linux"
         systemversion "latest"
-        excludes
-        {
-         "src/**.h",
-         "src/**.cpp",
-        }
+        if not _OPTIONS['target-emscripten'] then
+            links
+            {
+                "Glad",
+                "curl-lib",
+                "X11",
+                "EGL",
+                "dl",
+                "pthread"
+            }
+        end
         files
         {
-            "src/Akkad/Net/HTTP/**.h",
-            "src/Akkad/Net/HTTP/**.cpp",
+            "src/Akkad/Platforms/Desktop/Linux/**.h",
+            "src/Akkad/Platforms/Desktop/Linux/**.cpp",
+            "src/Akkad/Graphics/API/OpenGL/**.h",
+            "src/Akkad/Graphics/API/OpenGL/**.cpp",
+            "src/Akkad/Platforms/Headless/**.h",
+            "src/Akkad/Platforms/Headless/**.cpp",
+            "src/Akkad/Graphics/API/Null/**.h",
+            "src/Akkad/Graphics/API/Null/**.cpp",
         }
-        links {"curl-lib"}
+
+    -- the AVX2 transform kernel only runs after a CPU check, the rest of the engine keeps the baseline instruction set.
+    if not _OPTIONS['target-emscripten'] then
+        filter { "files:src/Akkad/Math/TransformBatchAVX2.cpp", "toolset:msc*" }
+            buildoptions { "/arch:AVX2" }
+        filter { "files:src/Akkad/Math/TransformBatchAVX2.cpp", "toolset:not msc*" }
+            buildoptions { "-mavx2", "-mfma" }
+        filter {}
+    end
         
     configuration "target-emscripten"
     excludes
@@ -93,14 +118,16 @@ project "Akkad"
     {
         "src/Akkad/Platforms/Web/**.h",
         "src/Akkad/Platforms/Web/**.cpp",
-        "src/Akkad/Graphics/API/OpenGLES/**"
+        "src/Akkad/Graphics/API/OpenGLES/**",
+        "src/Akkad/Platforms/Headless/**",
+        "src/Akkad/Graphics/API/Null/**"
     }
     
     if _OPTIONS['em-debug'] then
-        buildoptions{"-fPIC -pthread", "-s NO_DISABLE_EXCEPTION_CATCHING", "--profiling"};
+        buildoptions{"-fPIC -pthread -msimd128", "-s NO_DISABLE_EXCEPTION_CATCHING", "--profiling"};
         linkoptions{"-fPIC -pthread", "-s NO_DISABLE_EXCEPTION_CATCHING", "--profiling"};
 	else
-        buildoptions{"-fPIC -pthread -O3"};
+        buildoptions{"-fPIC -pthread -O3 -msimd128"};
         linkoptions{"-fPIC -pthread -O3"};
 	end
 
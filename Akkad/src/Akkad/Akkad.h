@@ -5,6 +5,8 @@
 #include "Akkad/ECS/Components/Components.h"
 #include "Akkad/Input/Input.h"
 #include "Akkad/Input/KeyCodes.h"
+#include "Akkad/Jobs/JobSystem.h"
+#include "Akkad/ECS/SystemScheduler.h"
 #include "Akkad/Asset/AssetManager.h"
 #include "Akkad/ECS/SceneManager.h"
 
@@ -13,6 +13,17 @@
 	#undef max
 #endif
 
+#include "Akkad/Platforms/Headless/HeadlessWindow.h"
+#include "Akkad/Platforms/Headless/HeadlessInput.h"
+#include "Akkad/Platforms/Headless/HeadlessTime.h"
+
+#ifdef AK_PLATFORM_LINUX
+	#include "Akkad/Platforms/Desktop/Linux/LinuxWindow.h"
+	#include "Akkad/Platforms/Desktop/Linux/LinuxTime.h"
+	#include "Akkad/Platforms/Desktop/Linux/LinuxInput.h"
+	#include "Akkad/Net/HTTP/CurlHTTPHandler.h"
+#endif
+
 #ifdef AK_PLATFORM_WEB
 	#include "Akkad/Platforms/Web/WebPlatform.h"
 	#include "Akkad/Platforms/Web/WebHTTPHandler.h"
@@ -23,9 +34,12 @@
 #include "Akkad/Graphics/ImGuiHandler.h"
 #include "Akkad/Graphics/RenderPlatform.h"
 #include "Akkad/Graphics/Renderer2D.h"
+#include "Akkad/Graphics/RenderThread.h"
 #include "Akkad/Asset/AssetManager.h"
 #include "Akkad/ECS/SceneManager.h"
 #include "Akkad/ECS/Entity.h"
+#include "Akkad/Jobs/JobSystem.h"
+#include "Akkad/Profiling/Profiler.h"
 
 namespace Akkad {
 	using namespace Graphics;
@@ -34,27 +48,56 @@ namespace Akkad {
 
 	void Application::InitImpl(ApplicationSettings& settings)
 	{
+		AK_PROFILE_THREAD("Main Thread");
+
+		// the calling thread becomes the main thread of the job system.
+		m_ApplicationComponents.m_JobSystem = CreateSharedPtr<JobSystem>(settings.job_worker_threads);
+
 		Window* window;
 		Input* input;
 		TimeManager* timeManager;
 		EventFN event_cb = std::bind(&Application::OnEvent, this, std::placeholders::_1);
 		RenderAPI targetRenderAPI = RenderAPI::OPENGL;
 
+		if (settings.headless)
+		{
+			window = new HeadlessWindow();
+			input = new HeadlessInput();
+			timeManager = new HeadlessTime(settings.headless_delta_time);
+
+			targetRenderAPI = RenderAPI::NONE;
+		}
+
 		#ifdef AK_PLATFORM_WINDOWS
+		else
+		{
 			window = new Win32Window();
 			input = new Win32Input();
 			timeManager = new Win32TimeManager();
-			m_ApplicationComponents.m_HttpHandler = new NET::CurlHTTPHandler();
+		}
+		m_ApplicationComponents.m_HttpHandler = new NET::CurlHTTPHandler();
 		#endif //AK_PLATFORM_WINDOWS
 
+		#ifdef AK_PLATFORM_LINUX
+		else
+		{
+			window = new LinuxWindow(settings.offscreen);
+			input = new LinuxInput();
+			timeManager = new LinuxTimeManager();
+		}
+		m_ApplicationComponents.m_HttpHandler = new NET::CurlHTTPHandler();
+		#endif // AK_PLATFORM_LINUX
+
 		#ifdef AK_PLATFORM_WEB
+		else
+		{
 			window = new WebWindow();
 			input = new WebInput();
 			timeManager = new WebTime();
 
 			targetRenderAPI = RenderAPI::OPENGLES;
-
-			m_ApplicationComponents.m_HttpHandler = new NET::WebHTTPHandler();
+		}
+		m_ApplicationComponents.m_HttpHandler = new NET::WebHTTPHandler();
 		#endif // AK_PLATFORM_WEB
 
 
@@ -75,9 +118,16 @@ namespace Akkad {
 		m_ApplicationComponents.m_Renderer2D = &Renderer2D::GetInstance();
 		m_Running = true;
 
-		if (settings.enable_ImGui)
+		if (settings.enable_ImGui && settings.headless)
+		{
+			AK_WARNING("ImGui needs a window, it stays disabled in headless mode.");
+		}
+
+		else if (settings.enable_ImGui)
 		{
-			#ifndef AK_PLATFORM_WEB
+			#ifdef AK_PLATFORM_LINUX
+				AK_WARNING("ImGui has no X11 backend, it stays disabled on linux.");
+			#elif !defined(AK_PLATFORM_WEB)
 				m_ApplicationComponents.m_ImguiHandler = ImGuiHandler::create(RenderAPI::OPENGL);
 				m_ApplicationComponents.m_ImguiHandler->Init();
 				m_ImGuiEnabled = true;
@@ -85,6 +135,19 @@ namespace Akkad {
 			
 		}
 
+		if (settings.threaded_rendering)
+		{
+			if (m_ImGuiEnabled)
+			{
+				AK_WARNING("threaded rendering is not supported with ImGui enabled, rendering stays on the main thread.");
+			}
+
+			else
+			{
+				m_ThreadedRendering = true;
+			}
+		}
+
 	}
 
 	void Application::RunImpl()
@@ -94,30 +157,48 @@ namespace Akkad {
 			layer->OnAttach();
 		}
 
+		// layers create their resources on attach, the context is handed over after that.
+		if (m_ThreadedRendering)
+		{
+			RenderThread::Start();
+		}
+
 		#ifdef AK_PLATFORM_WEB
 		emscripten_set_main_loop(&Application::Update, 0, 1);
 		emscripten_set_main_loop_timing(EM_TIMING_RAF, 1);
 		#endif
 
-		#ifndef AK_PLAFORM_WEB
+		#ifndef AK_PLATFORM_WEB
 		while (m_Running)
 		{
 			Update();
 		}
-		#endif // !AK_PLAFORM_WEB
+
+		RenderThread::Stop();
+		m_ApplicationComponents.m_JobSystem->Shutdown();
+		#endif // !AK_PLATFORM_WEB
 
 
 	}
 
 	void Application::Update()
 	{
+		// the previous frame ends where this one starts, the first frame spans the initialization.
+		AK_PROFILE_FRAME();
+		AK_PROFILE_SCOPE("Application::Update");
+
 		for (auto it = GetInstance().m_Layers.rbegin(); it != GetInstance().m_Layers.rend(); ++it)
 		{
 			auto layer = *it;
-			layer->OnUpdate();
+			{
+				AK_PROFILE_SCOPE("Layer::OnUpdate");
+				layer->OnUpdate();
+			}
+
 			if (GetInstance().m_ImGuiEnabled)
 			{
 				#ifndef AK_PLATFORM_WEB
+				AK_PROFILE_SCOPE("Layer::RenderImGui");
 				GetInstance().m_ApplicationComponents.m_ImguiHandler->NewFrame();
 				layer->RenderImGui();
 				GetInstance().m_ApplicationComponents.m_ImguiHandler->Render();
@@ -128,7 +209,10 @@ namespace Akkad {
 		}
 
 		GetInstance().m_ApplicationComponents.m_TimeManager->CalculateDeltaTime();
-		GetInstance().m_ApplicationComponents.m_platform->GetRenderContext()->SwapWindowBuffers();
+		{
+			AK_PROFILE_SCOPE("RenderThread::EndFrame");
+			RenderThread::EndFrame();
+		}
 		GetInstance().m_ApplicationComponents.m_Window->OnUpdate();
 		GetInstance().m_ApplicationComponents.m_HttpHandler->OnUpdate();
 	}
@@ -155,7 +239,10 @@ namespace Akkad {
 			layer->OnWindowResize(e);
 		}
 
-		m_ApplicationComponents.m_platform->OnWindowResize(e.m_Width, e.m_Height);
+		auto platform = m_ApplicationComponents.m_platform;
+		unsigned int width = e.m_Width;
+		unsigned int height = e.m_Height;
+		RenderThread::Submit([platform, width, height]() { platform->OnWindowResize(width, height); });
 		return true;
 	}
 
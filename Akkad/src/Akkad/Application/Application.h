@@ -11,6 +11,7 @@ namespace Akkad {
 	class LoadedGameAssembly;
 	class TimeManager;
 	class Input;
+	class JobSystem;
 
 	namespace Graphics
 	{
@@ -28,6 +29,15 @@ namespace Akkad {
 	{
 		WindowSettings window_settings;
 		bool enable_ImGui = false;
+		// records frames on the main thread and submits them on a render thread, ImGui must be disabled.
+		bool threaded_rendering = false;
+		// no window nor GPU, rendering goes to the null platform and the time advances by a fixed step each frame.
+		bool headless = false;
+		double headless_delta_time = 1.0 / 60.0;
+		// linux only, renders on the GPU without opening a window.
+		bool offscreen = false;
+		// -1 starts one job worker per hardware thread besides the main thread, the web build has none.
+		int job_worker_threads = -1;
 	};
 
 	struct ApplicationComponents
@@ -37,6 +47,7 @@ namespace Akkad {
 		Input* m_InputManager = nullptr;
 		Graphics::Renderer2D* m_Renderer2D = nullptr;
 
+		SharedPtr<JobSystem> m_JobSystem;
 		SharedPtr<Graphics::ImGuiHandler> m_ImguiHandler;
 		SharedPtr<Graphics::RenderPlatform> m_platform;
 
@@ -44,7 +55,7 @@ namespace Akkad {
 		SharedPtr<AssetManager> m_AssetManager;
 		SharedPtr<SceneManager> m_SceneManager;
 
-		NET::HTTPHandler* m_HttpHandler;
+		NET::HTTPHandler* m_HttpHandler = nullptr;
 	};
 
 	class Application {
@@ -66,6 +77,7 @@ namespace Akkad {
 		static LoadedGameAssembly* GetGameAssembly() { return GetInstance().m_LoadedGameAssembly; }
 		static TimeManager* GetTimeManager() { return GetInstance().m_ApplicationComponents.m_TimeManager; }
 		static Input* GetInputManager() { return GetInstance().m_ApplicationComponents.m_InputManager; }
+		static JobSystem* GetJobSystem() { return GetInstance().m_ApplicationComponents.m_JobSystem.get(); }
 
 		static SharedPtr<Graphics::RenderPlatform> GetRenderPlatform() { return GetInstance().m_ApplicationComponents.m_platform; }
 		static SharedPtr<AssetManager> GetAssetManager() { return GetInstance().m_ApplicationComponents.m_AssetManager; }
@@ -88,6 +100,7 @@ namespace Akkad {
 
 		bool m_Running = false;
 		bool m_ImGuiEnabled = false;
+		bool m_ThreadedRendering = false;
 
 		// -------- Event Handlers -----------------
 		void OnEvent(Event& e);
@@ -3,9 +3,11 @@
 #include "Akkad/Logging.h"
 #include "Akkad/Application/Application.h"
 #include "Akkad/ECS/Serializers/InstantiableEntitySerializer.h"
+#include "Akkad/Profiling/Profiler.h"
 
 #include "Akkad/Graphics/Texture.h"
 #include "Akkad/Graphics/Shader.h"
+#include "Akkad/Graphics/RenderThread.h"
 
 namespace Akkad {
 	AssetInfo::~AssetInfo() {}
@@ -78,23 +80,27 @@ namespace Akkad {
 
 		else
 		{
+			AK_PROFILE_SCOPE("AssetManager::LoadTexture");
 			auto desc = GetDescriptorByID(assetID);
 			
 			auto textureinfo = std::static_pointer_cast<TextureAssetInfo>(desc.assetInfo);
+			auto platform = Application::GetInstance().GetRenderPlatform();
+			SharedPtr<Graphics::Texture> texture;
+
+			// GPU resources are created where the context is current, the texture is needed right away.
 			if (textureinfo->isTilemap)
 			{
-				auto texture = Application::GetInstance().GetRenderPlatform()->CreateTexture(desc.absolutePath.c_str(), textureinfo->tileWidth, textureinfo->tileHeight);
-				m_LoadedTextures[assetID] = texture;
-				return texture;
+				Graphics::RenderThread::Execute([&]() { texture = platform->CreateTexture(desc.absolutePath.c_str(), textureinfo->tileWidth, textureinfo->tileHeight); });
 			}
 
 			else
 			{
-				auto texture = Application::GetInstance().GetRenderPlatform()->CreateTexture(desc.absolutePath.c_str());
-				m_LoadedTextures[assetID] = texture;
-				return texture;
+				Graphics::RenderThread::Execute([&]() { texture = platform->CreateTexture(desc.absolutePath.c_str()); });
 			}
 
+			m_LoadedTextures[assetID] = texture;
+			return texture;
+
 		}
 	}
 
@@ -104,7 +110,15 @@ namespace Akkad {
 
 		AK_ASSERT(desc.assetType == AssetType::TEXTURE, "Failed to reload asset, asset type mismatch !");
 		
-		m_LoadedTextures.erase(assetID);
+		auto it = m_LoadedTextures.find(assetID);
+		if (it != m_LoadedTextures.end())
+		{
+			// the texture is deleted by the last reference, which has to be dropped where the context is current.
+			auto texture = it->second;
+			m_LoadedTextures.erase(it);
+			Graphics::RenderThread::Submit([texture]() {});
+		}
+
 		GetTexture(assetID);
 	}
 
@@ -117,8 +131,11 @@ namespace Akkad {
 		}
 		else
 		{
+			AK_PROFILE_SCOPE("AssetManager::LoadShader");
 			auto desc = GetDescriptorByID(assetID);
-			auto shader = Application::GetInstance().GetRenderPlatform()->CreateShader(desc.absolutePath.c_str());
+			auto platform = Application::GetInstance().GetRenderPlatform();
+			SharedPtr<Graphics::Shader> shader;
+			Graphics::RenderThread::Execute([&]() { shader = platform->CreateShader(desc.absolutePath.c_str()); });
 			m_LoadedShaders[assetID] = shader;
 			
 			return shader;
@@ -146,7 +163,9 @@ namespace Akkad {
 		auto it = m_LoadedShaders.find(assetID);
 		if (it != m_LoadedShaders.end())
 		{
-			m_LoadedShaders.erase(assetID);
+			auto shader = it->second;
+			m_LoadedShaders.erase(it);
+			Graphics::RenderThread::Submit([shader]() {});
 		}
 	}
 
@@ -191,6 +210,7 @@ namespace Akkad {
 
 		else
 		{
+			AK_PROFILE_SCOPE("AssetManager::LoadInstantiableEntity");
 			auto data = InstantiableEntitySerializer::Deserialize(desc.absolutePath);
 			auto instantiableObject = CreateSharedPtr<nlohmann::ordered_json>(data);
 			m_LoadedInstantiableEntities[desc.assetID] = instantiableObject;
@@ -3,6 +3,7 @@
 #include "SpriteRendererComponent.h"
 #include "TagComponent.h"
 #include "TransformComponent.h"
+#include "Transform2DComponent.h"
 #include "ScriptComponent.h"
 #include "RigidBody2dComponent.h"
 #include "GUITextComponent.h"
@@ -17,6 +17,8 @@ namespace Akkad {
 		GUI::GUIText::FittingMode fittingMode = GUI::GUIText::FittingMode::KEEP_FONT_SIZE;
 	private:
 		GUI::GUIText uitext;
+		// the asset the font was loaded from, the descriptor is only looked up when fontAssetID changes.
+		std::string loadedFontAssetID;
 		friend class Scene;
 
 	};
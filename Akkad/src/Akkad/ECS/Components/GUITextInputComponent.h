@@ -7,6 +7,11 @@ namespace Akkad {
 	{
 		GUI::GUITextInput textinput;
 		std::string fontAssetID;
+
+	private:
+		// the asset the font was loaded from, the descriptor is only looked up when fontAssetID changes.
+		std::string loadedFontAssetID;
+		friend class Scene;
 	};
 
 }
\ No newline at end of file
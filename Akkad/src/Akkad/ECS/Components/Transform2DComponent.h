@@ -0,0 +1,139 @@
+#pragma once
+#include "Akkad/Math/Affine2D.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Akkad {
+
+	// a transform for entities that only move on the xy plane. setters only store the value,
+	// the local and world transforms are computed on the first read after a change.
+	// an entity has either this or a TransformComponent.
+	struct Transform2DComponent {
+	public:
+		// world position, follows the whole parent chain.
+		glm::vec2 GetPosition() {
+			return GetWorldTransform().GetTranslation();
+		}
+
+		glm::vec2 GetLocalPosition() {
+			return m_Position;
+		}
+
+		float GetRotation() {
+			return m_Rotation;
+		}
+
+		glm::vec2 GetScale() {
+			return m_Scale;
+		}
+
+		// depth used when the transform is expanded to a 4x4 matrix, it is not inherited.
+		float GetZ() {
+			return m_Z;
+		}
+
+		void SetPosition(glm::vec2 position) {
+			if (position != m_Position)
+			{
+				m_Position = position;
+				Invalidate();
+			}
+		}
+
+		void SetWorldPosition(glm::vec2 position) {
+			SetPosition(m_ParentTransform.Inverse().TransformPoint(position));
+		}
+
+		void SetRotation(float rotation) {
+			if (rotation != m_Rotation)
+			{
+				m_Rotation = rotation;
+				Invalidate();
+			}
+		}
+
+		void SetScale(glm::vec2 scale) {
+			if (scale != m_Scale)
+			{
+				m_Scale = scale;
+				Invalidate();
+			}
+		}
+
+		void SetZ(float z) {
+			m_Z = z;
+		}
+
+		const Affine2D& GetLocalTransform() {
+			if (m_LocalDirty)
+			{
+				m_LocalTransform = Affine2D::FromTRS(m_Position, m_Rotation, m_Scale);
+				m_LocalDirty = false;
+			}
+			return m_LocalTransform;
+		}
+
+		// world transform, children are brought up to date by Scene::UpdateTransforms().
+		const Affine2D& GetWorldTransform() {
+			if (m_WorldDirty)
+			{
+				m_WorldTransform = m_ParentTransform * GetLocalTransform();
+				m_WorldDirty = false;
+			}
+			return m_WorldTransform;
+		}
+
+		const Affine2D& GetParentTransform() {
+			return m_ParentTransform;
+		}
+
+		glm::mat4 GetTransformMatrix() {
+			return GetWorldTransform().ToMat4(m_Z);
+		}
+
+		bool IsDirty() { return m_IsDirty; }
+
+	private:
+		glm::vec2 m_Position = glm::vec2(0.0f);
+		float m_Rotation = 0.0f;
+		glm::vec2 m_Scale = glm::vec2(1.0f);
+		float m_Z = 0.0f;
+
+		Affine2D m_LocalTransform;
+		Affine2D m_ParentTransform;
+		Affine2D m_WorldTransform;
+
+		bool m_LocalDirty = false;
+		bool m_WorldDirty = false;
+		// set when the local transform changed, the scene hands the new world transform to the children.
+		bool m_IsDirty = true;
+		// position in the scene's parent first transform order.
+		uint32_t m_HierarchyIndex = 0;
+		// the scene's dirty 2D roots, see TransformComponent::m_DirtyRoots.
+		std::vector<uint32_t>* m_DirtyRoots = nullptr;
+
+		void Invalidate()
+		{
+			m_LocalDirty = true;
+			m_WorldDirty = true;
+
+			if (!m_IsDirty && m_DirtyRoots != nullptr)
+			{
+				m_DirtyRoots->push_back(m_HierarchyIndex);
+			}
+
+			m_IsDirty = true;
+		}
+
+		void SetParentTransform(const Affine2D& parent)
+		{
+			m_ParentTransform = parent;
+			m_WorldDirty = true;
+		}
+
+		friend class Scene;
+	};
+}
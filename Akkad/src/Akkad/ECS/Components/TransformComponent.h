@@ -2,21 +2,29 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <cstdint>
+#include <vector>
+
 namespace Akkad {
 	struct TransformComponent {
 	public:
 		TransformComponent() {
 			m_Position = glm::vec3(0.0f);
-			m_ParentPosition = glm::vec3(0.0f);
 			m_Rotation = glm::vec3(0.0f);
-			m_ParentRotation = glm::vec3(0.0f);
 			m_Scale = glm::vec3(1.0f);
-			m_TransformMatrix = glm::mat4(1.0f);
+			m_LocalMatrix = glm::mat4(1.0f);
+			m_ParentMatrix = glm::mat4(1.0f);
+			m_WorldMatrix = glm::mat4(1.0f);
 			RecalculateTransformMatrix();
 		}
 
+		// world position, follows the whole parent chain.
 		glm::vec3 GetPosition() {
-			return m_Position + m_ParentPosition;
+			return glm::vec3(m_WorldMatrix[3]);
+		}
+
+		glm::vec3 GetLocalPosition() {
+			return m_Position;
 		}
 
 		glm::vec3 GetRotation() {
@@ -27,8 +35,17 @@ namespace Akkad {
 			return m_Scale;
 		}
 
+		// world matrix, children are brought up to date by Scene::UpdateTransforms().
 		glm::mat4& GetTransformMatrix() {
-			return m_TransformMatrix;
+			return m_WorldMatrix;
+		}
+
+		glm::mat4& GetLocalMatrix() {
+			return m_LocalMatrix;
+		}
+
+		glm::mat4& GetParentMatrix() {
+			return m_ParentMatrix;
 		}
 
 		void SetPostion(glm::vec3 newpos) {
@@ -39,6 +56,10 @@ namespace Akkad {
 			}
 		}
 
+		void SetWorldPosition(glm::vec3 position) {
+			SetPostion(glm::vec3(glm::inverse(m_ParentMatrix) * glm::vec4(position, 1.0f)));
+		}
+
 		void SetRotation(glm::vec3 rotation) {
 			if (m_Rotation != rotation)
 			{
@@ -55,40 +76,52 @@ namespace Akkad {
 			}
 		}
 
+		bool IsDirty() { return m_IsDirty; }
+
 	private:
 		glm::vec3 m_Position;
-		glm::vec3 m_ParentPosition;
 		glm::vec3 m_Rotation;
-		glm::vec3 m_ParentRotation;
 		glm::vec3 m_Scale;
-		glm::mat4 m_TransformMatrix;
+		glm::mat4 m_LocalMatrix;
+		glm::mat4 m_ParentMatrix;
+		glm::mat4 m_WorldMatrix;
+
+		// set when the local transform changed, the scene recomputes the world matrices of the children.
+		bool m_IsDirty = true;
+		// position in the scene's parent first transform order.
+		uint32_t m_HierarchyIndex = 0;
+		// the scene's dirty roots, set once the transform is in the order. a transform that becomes dirty pushes
+		// its index, so the scene never has to look for dirty transforms.
+		std::vector<uint32_t>* m_DirtyRoots = nullptr;
 
-		void SetParentPosition(glm::vec3 position)
+		void MarkDirty()
 		{
-			if (m_ParentPosition != position)
+			if (!m_IsDirty && m_DirtyRoots != nullptr)
 			{
-				m_ParentPosition = position;
-				RecalculateTransformMatrix();
+				m_DirtyRoots->push_back(m_HierarchyIndex);
 			}
+
+			m_IsDirty = true;
 		}
 
-		void SetParentRotation(glm::vec3 rotation)
+		void SetParentMatrix(const glm::mat4& parent)
 		{
-			if (m_ParentRotation != rotation)
-			{
-				m_ParentRotation = rotation;
-				RecalculateTransformMatrix();
-			}
+			m_ParentMatrix = parent;
+			m_WorldMatrix = m_ParentMatrix * m_LocalMatrix;
 		}
 
+		// the world matrix uses the parent matrix of the last transform update, so a change is visible right away.
 		void RecalculateTransformMatrix() {
-			m_TransformMatrix = glm::mat4(1.0f);
-			m_TransformMatrix = glm::translate(m_TransformMatrix, m_Position + m_ParentPosition);
-			m_TransformMatrix = glm::scale(m_TransformMatrix, m_Scale);
+			m_LocalMatrix = glm::mat4(1.0f);
+			m_LocalMatrix = glm::translate(m_LocalMatrix, m_Position);
+			m_LocalMatrix = glm::scale(m_LocalMatrix, m_Scale);
+
+			m_LocalMatrix = glm::rotate(m_LocalMatrix, m_Rotation.x, { 1,0,0 });
+			m_LocalMatrix = glm::rotate(m_LocalMatrix, m_Rotation.y, { 0,1,0 });
+			m_LocalMatrix = glm::rotate(m_LocalMatrix, m_Rotation.z, { 0,0,1 });
 
-			m_TransformMatrix = glm::rotate(m_TransformMatrix, m_Rotation.x + m_ParentRotation.x, { 1,0,0 });
-			m_TransformMatrix = glm::rotate(m_TransformMatrix, m_Rotation.y + m_ParentRotation.y, { 0,1,0 });
-			m_TransformMatrix = glm::rotate(m_TransformMatrix, m_Rotation.z + m_ParentRotation.z, { 0,0,1 });
+			m_WorldMatrix = m_ParentMatrix * m_LocalMatrix;
+			MarkDirty();
 		}
 
 		friend class Scene;
@@ -96,4 +129,4 @@ namespace Akkad {
 		friend class ViewPortPanel;
 		friend class TransformComponentSerializer;
 	};
-}
\ No newline at end of file
+}
@@ -5,18 +5,97 @@
 
 #include "Akkad/Logging.h"
 #include "Akkad/Application/Application.h"
+#include "Akkad/Jobs/JobSystem.h"
 #include "Akkad/Input/Input.h"
 #include "Akkad/Graphics/Renderer2D.h"
+#include "Akkad/Graphics/RenderThread.h"
 #include "Akkad/Asset/AssetManager.h"
 #include "Akkad/Graphics/SortingLayer2D.h"
 #include "Akkad/Application/TimeManager.h"
+#include "Akkad/Profiling/Profiler.h"
+#include "Akkad/Math/TransformBatch.h"
 
 #include "Components/Components.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace Akkad {
 	using namespace Graphics;
+
+	namespace {
+
+		// the 3D transforms of one dirty range laid out for TransformBatch, one per thread since ranges
+		// are recomputed in parallel.
+		struct TransformBatchScratch
+		{
+			std::vector<float> positionX, positionY, positionZ;
+			std::vector<float> rotationX, rotationY, rotationZ;
+			std::vector<float> scaleX, scaleY, scaleZ;
+			std::vector<uint32_t> parents;
+			std::vector<TransformComponent*> components;
+			std::vector<glm::mat4> localMatrices;
+			std::vector<glm::mat4> worldMatrices;
+			// range offset to batch index, INVALID_PARENT for 2D nodes.
+			std::vector<uint32_t> batchIndices;
+			// parent matrix from outside of the batch that still has to be applied to a batch world matrix.
+			std::vector<uint32_t> corrections;
+			std::vector<glm::mat4> correctionMatrices;
+
+			void Clear()
+			{
+				for (auto values : { &positionX, &positionY, &positionZ, &rotationX, &rotationY, &rotationZ, &scaleX, &scaleY, &scaleZ })
+				{
+					values->clear();
+				}
+
+				parents.clear();
+				components.clear();
+				batchIndices.clear();
+				correctionMatrices.clear();
+			}
+
+			void Push(TransformComponent* transform, uint32_t parent)
+			{
+				glm::vec3 position = transform->GetLocalPosition();
+				glm::vec3 rotation = transform->GetRotation();
+				glm::vec3 scale = transform->GetScale();
+
+				positionX.push_back(position.x);
+				positionY.push_back(position.y);
+				positionZ.push_back(position.z);
+				rotationX.push_back(rotation.x);
+				rotationY.push_back(rotation.y);
+				rotationZ.push_back(rotation.z);
+				scaleX.push_back(scale.x);
+				scaleY.push_back(scale.y);
+				scaleZ.push_back(scale.z);
+				parents.push_back(parent);
+				components.push_back(transform);
+			}
+
+			void Compute()
+			{
+				size_t count = components.size();
+				localMatrices.resize(count);
+				worldMatrices.resize(count);
+				corrections.assign(count, TransformBatch::INVALID_PARENT);
+
+				TransformSoA soa = { positionX.data(), positionY.data(), positionZ.data(),
+					rotationX.data(), rotationY.data(), rotationZ.data(), scaleX.data(), scaleY.data(), scaleZ.data() };
+				TransformBatch::ComputeWorldMatrices(soa, parents.data(), localMatrices.data(), worldMatrices.data(), count);
+			}
+		};
+
+		thread_local TransformBatchScratch t_TransformBatchScratch;
+	}
+
 	Scene::Scene()
 	{
+		ConnectTransformListeners();
+		RegisterBuiltinSystems();
+
 		FrameBufferDescriptor pickingBufferDescriptor;
 		pickingBufferDescriptor.width = 800;
 		pickingBufferDescriptor.height = 800;
@@ -24,13 +103,18 @@ namespace Akkad {
 		pickingBufferDescriptor.usesRenderBuffer = true;
 		if (Application::GetRenderPlatform() != nullptr)
 		{
-			m_PickingBuffer = Application::GetRenderPlatform()->CreateFrameBuffer(pickingBufferDescriptor);
+			m_PickingBuffer = Application::GetRenderPlatform()->AcquireRenderTarget(pickingBufferDescriptor);
 		}
 	}
 
 	Scene::~Scene()
 	{
 		m_PhysicsWorld2D.Clear();
+
+		if (m_PickingBuffer != nullptr && Application::GetRenderPlatform() != nullptr)
+		{
+			Application::GetRenderPlatform()->ReleaseRenderTarget(m_PickingBuffer);
+		}
 	}
 
 	void Scene::Start()
@@ -51,10 +135,15 @@ namespace Akkad {
 
 			// Init bodies
 			{
-				auto view = m_Registry.view<TransformComponent,RigidBody2dComponent>();
+				auto view = m_Registry.view<RigidBody2dComponent>();
 				
 				for (auto entity : view)
 				{
+					if (!HasTransform(entity))
+					{
+						continue;
+					}
+
 					InitilizePhysicsBodies2D({ entity, this });
 				
 				}
@@ -87,65 +176,79 @@ namespace Akkad {
 
 	void Scene::Render2D()
 	{
+		AK_PROFILE_SCOPE("Scene::Render2D");
+		// the editor draws scenes that are not updated, a static hierarchy makes this a scan of the dirty flags.
+		UpdateTransforms();
+
 		auto command = Application::GetRenderPlatform()->GetRenderCommand();
-		auto view = m_Registry.view<TransformComponent, SpriteRendererComponent>();
-		auto animatedView = m_Registry.view<TransformComponent, AnimatedSpriteRendererComponent>();
-		auto colorView = m_Registry.view<TransformComponent, ColoredSpriteRendererComponent>();
+		auto colorView = m_Registry.view<ColoredSpriteRendererComponent>();
 		auto scriptView = m_Registry.view<ScriptComponent>();
 		auto lineView = m_Registry.view<LineRendererComponent>();
 		command->Clear();
 
-		for (auto it : SortingLayer2DHandler::GetRegisteredLayers())
+		BuildSpriteSortKeys(true);
+		// picking resolves against what was drawn last.
+		m_SpritePickIndexDirty = true;
+
+		// keys are sorted by layer, then order in layer, then material, so a single pass submits
+		// everything in draw order. scripts still get a callback after each layer.
+		auto& layers = SortingLayer2DHandler::GetRegisteredLayers();
+		size_t keyIndex = 0;
+
+		for (unsigned int layerOrder = 0; layerOrder < layers.size(); layerOrder++)
 		{
-			for (auto entity : view)
+			for (; keyIndex < m_SpriteSortKeys.size(); keyIndex++)
 			{
-				auto& spriteRenderer = view.get<SpriteRendererComponent>(entity);
-
-				if (spriteRenderer.sprite.GetSortingLayer() == it.name)
+				auto& sortKey = m_SpriteSortKeys[keyIndex];
+				if (SpriteSortKey::GetLayerOrder(sortKey.key) != layerOrder)
 				{
-					auto& transform = view.get<TransformComponent>(entity);
-
-					Renderer2D::DrawSprite(spriteRenderer.sprite, transform.GetTransformMatrix());
+					break;
 				}
 
-			}
+				// sprites are batched by material within a draw order, the render queue keeps the orders apart.
+				Renderer2D::SetDrawOrder(SpriteSortKey::GetDrawOrder(sortKey.key));
 
-			for (auto entity : animatedView)
-			{
-				auto& animatedSprite = animatedView.get<AnimatedSpriteRendererComponent>(entity);
-				auto& transform = animatedView.get<TransformComponent>(entity);
-
-				auto dt = Application::GetTimeManager()->GetDeltaTime();
-				auto frame = animatedSprite.sprite.GetFrame(dt);
-
-				Renderer2D::DrawAnimatedSprite(animatedSprite.sprite, frame, transform.GetTransformMatrix());
-
-			}
+				auto& item = m_SpriteDrawItems[sortKey.index];
+				auto transform = GetWorldMatrix(item.entity);
 
-			if (colorView)
-			{
-				for (auto entity : colorView)
+				if (item.animated)
 				{
-					if (colorView.contains(entity))
-					{
-						auto& color = colorView.get<ColoredSpriteRendererComponent>(entity);
-						auto& transform = colorView.get<TransformComponent>(entity);
-						//Renderer2D::DrawQuad(color.color, transform.GetTransformMatrix());
-						Renderer2D::DrawColoredQuadInstanced(color.color, transform.GetTransformMatrix());
-					}
+					auto& animatedSprite = m_Registry.get<AnimatedSpriteRendererComponent>(item.entity);
+					Renderer2D::DrawAnimatedSprite(animatedSprite.sprite, item.frame, transform);
+				}
+				else
+				{
+					auto& spriteRenderer = m_Registry.get<SpriteRendererComponent>(item.entity);
+					Renderer2D::DrawSprite(spriteRenderer.sprite, transform);
 				}
 			}
 
+			// script draws land on top of the layer they are called for.
+			Renderer2D::SetDrawOrder(SpriteSortKey::GetScriptDrawOrder(layerOrder));
 
 			for (auto entity : scriptView)
 			{
 				auto& script = scriptView.get<ScriptComponent>(entity);
 				if (script.Instance)
 				{
-					script.Instance->OnRender2D(it.name);
+					script.Instance->OnRender2D(layers[layerOrder].name);
 				}
 			}
+		}
 
+		// colored quads, lines and debug shapes are drawn over every layer.
+		Renderer2D::SetDrawOrder(UINT32_MAX);
+
+		for (auto entity : colorView)
+		{
+			if (!HasTransform(entity))
+			{
+				continue;
+			}
+
+			auto& color = colorView.get<ColoredSpriteRendererComponent>(entity);
+			auto transform = GetWorldMatrix(entity);
+			Renderer2D::DrawColoredQuadInstanced(color.color, transform);
 		}
 
 		for (auto entity : lineView)
@@ -171,56 +274,111 @@ namespace Akkad {
 
 	}
 
-	void Scene::RenderPickingBuffer2D()
+	void Scene::BuildSpriteSortKeys(bool advanceAnimations)
 	{
-		auto command = Application::GetRenderPlatform()->GetRenderCommand();
-		m_PickingBuffer->Bind();
-		command->Clear();
+		auto view = m_Registry.view<SpriteRendererComponent>();
+		auto animatedView = m_Registry.view<AnimatedSpriteRendererComponent>();
 
+		m_SpriteSortKeys.clear();
+		m_SpriteDrawItems.clear();
+
+		for (auto entity : view)
 		{
-			auto view = m_Registry.view<TransformComponent, SpriteRendererComponent>();
-			auto animview = m_Registry.view<TransformComponent, AnimatedSpriteRendererComponent>();
+			if (!HasTransform(entity))
+			{
+				continue;
+			}
+
+			auto& sprite = view.get<SpriteRendererComponent>(entity).sprite;
 
-			for (auto it : SortingLayer2DHandler::GetRegisteredLayers())
+			unsigned int layerOrder = SortingLayer2DHandler::GetLayerOrder(sprite.GetSortingLayerID());
+			if (layerOrder == SortingLayer2DHandler::INVALID_LAYER_ID)
 			{
-				for (auto entity : view)
-				{
-					auto& spriteRenderer = view.get<SpriteRendererComponent>(entity);
+				continue;
+			}
 
-					if (spriteRenderer.sprite.GetSortingLayer() == it.name)
-					{
-						auto& transform = view.get<TransformComponent>(entity);
+			auto material = sprite.GetMaterial();
+			uint64_t batchKey = (material != nullptr) ? material->GetBatchKey() : 0;
 
-						uint32_t entityID = (uint32_t)entity;
+			SpriteSortKey sortKey;
+			sortKey.key = SpriteSortKey::Create(layerOrder, sprite.GetOrderInLayer(), batchKey);
+			sortKey.index = (uint32_t)m_SpriteDrawItems.size();
+			m_SpriteSortKeys.push_back(sortKey);
 
-						entityID += 1;
+			SpriteDrawItem2D item;
+			item.entity = entity;
+			item.animated = false;
+			m_SpriteDrawItems.push_back(item);
+		}
 
-						glm::vec3 color;
-						color.r = entityID;
-						Renderer2D::DrawColoredQuadInstanced(color, transform.GetTransformMatrix());
-					}
+		for (auto entity : animatedView)
+		{
+			if (!HasTransform(entity))
+			{
+				continue;
+			}
 
-				}
+			auto& sprite = animatedView.get<AnimatedSpriteRendererComponent>(entity).sprite;
 
-				for (auto entity : animview)
-				{
-					auto& spriteRenderer = animview.get<AnimatedSpriteRendererComponent>(entity);
+			unsigned int layerOrder = SortingLayer2DHandler::GetLayerOrder(sprite.GetSortingLayerID());
+			if (layerOrder == SortingLayer2DHandler::INVALID_LAYER_ID)
+			{
+				continue;
+			}
 
-					if (spriteRenderer.sprite.GetSortingLayer() == it.name)
-					{
-						auto& transform = animview.get<TransformComponent>(entity);
+			SpriteDrawItem2D item;
+			item.entity = entity;
+			item.animated = true;
 
-						uint32_t entityID = (uint32_t)entity;
+			// the frame has to be resolved before the batch key, it swaps the sprite sheet texture.
+			if (advanceAnimations)
+			{
+				auto dt = Application::GetTimeManager()->GetDeltaTime();
+				item.frame = sprite.GetFrame(dt);
+			}
 
-						entityID += 1;
+			auto material = sprite.GetMaterial();
+			uint64_t batchKey = (material != nullptr) ? material->GetBatchKey() : 0;
 
-						glm::vec3 color;
-						color.r = entityID;
-						Renderer2D::DrawColoredQuadInstanced(color, transform.GetTransformMatrix());
-					}
+			SpriteSortKey sortKey;
+			sortKey.key = SpriteSortKey::Create(layerOrder, sprite.GetOrderInLayer(), batchKey);
+			sortKey.index = (uint32_t)m_SpriteDrawItems.size();
+			m_SpriteSortKeys.push_back(sortKey);
 
-				}
+			m_SpriteDrawItems.push_back(item);
+		}
+
+		RadixSort(m_SpriteSortKeys, m_SpriteSortScratch);
+	}
+
+	void Scene::RenderPickingBuffer2D()
+	{
+		AK_PROFILE_SCOPE("Scene::RenderPickingBuffer2D");
+		auto pickingBuffer = m_PickingBuffer;
+		RenderThread::Submit([pickingBuffer]()
+		{
+			pickingBuffer->Bind();
+			Application::GetRenderPlatform()->GetRenderCommand()->Clear();
+		});
+
+		{
+			BuildSpriteSortKeys(false);
+
+			// a single instanced draw keeps submission order, so the sorted keys are enough to resolve overlaps.
+			for (auto& sortKey : m_SpriteSortKeys)
+			{
+				auto& item = m_SpriteDrawItems[sortKey.index];
+				auto transform = GetWorldMatrix(item.entity);
+
+				uint32_t entityID = (uint32_t)item.entity;
+
+				entityID += 1;
+
+				Renderer2D::DrawPickingQuadInstanced(entityID, transform);
 			}
+
+			// the picking quads have to reach the picking buffer, not the next scene flush.
+			Renderer2D::Flush();
 		}
 
 		// GUI picking
@@ -229,8 +387,129 @@ namespace Akkad {
 		}
 
 
-		m_PickingBuffer->Unbind();
-		
+		RenderThread::Submit([pickingBuffer]()
+		{
+			pickingBuffer->Unbind();
+			// the buffer is complete for this frame, reads requested since the last pass can be issued.
+			pickingBuffer->UpdateReadbacks();
+		});
+	}
+
+	entt::entity Scene::Pick(glm::vec2 viewportPoint, const glm::mat4& viewProjection)
+	{
+		// the GUI is drawn on top of the sprites.
+		entt::entity picked = PickGUI(viewportPoint);
+		if (picked != entt::null || m_ViewportSize.x <= 0 || m_ViewportSize.y <= 0)
+		{
+			return picked;
+		}
+
+		glm::vec2 ndc = { (viewportPoint.x / m_ViewportSize.x) * 2.0f - 1.0f, 1.0f - (viewportPoint.y / m_ViewportSize.y) * 2.0f };
+		glm::vec4 worldPoint = glm::inverse(viewProjection) * glm::vec4(ndc, 0.0f, 1.0f);
+
+		return PickSprite(worldPoint);
+	}
+
+	entt::entity Scene::PickGUI(glm::vec2 viewportPoint)
+	{
+		Entity activeContainerEntity = GetGuiContainer();
+		if (activeContainerEntity.IsValid())
+		{
+			auto& container = activeContainerEntity.GetComponent<GUIContainerComponent>().container;
+
+			uint32_t id;
+			if (container.HitTest(viewportPoint, id))
+			{
+				return (entt::entity)id;
+			}
+		}
+
+		return entt::null;
+	}
+
+	entt::entity Scene::PickSprite(glm::vec2 worldPoint)
+	{
+		if (m_SpritePickIndexDirty)
+		{
+			BuildSpritePickIndex();
+		}
+
+		entt::entity picked = entt::null;
+		uint32_t pickedPriority = 0;
+
+		m_SpritePickGrid.Query(worldPoint, [&](uint32_t index)
+		{
+			auto& item = m_SpritePickItems[index];
+			if (picked != entt::null && item.priority <= pickedPriority)
+			{
+				return;
+			}
+
+			// sprites are unit quads in their local space.
+			glm::vec4 localPoint = item.inverseTransform * glm::vec4(worldPoint, 0.0f, 1.0f);
+			if (glm::abs(localPoint.x) <= 0.5f && glm::abs(localPoint.y) <= 0.5f)
+			{
+				picked = item.entity;
+				pickedPriority = item.priority;
+			}
+		});
+
+		return picked;
+	}
+
+	void Scene::BuildSpritePickIndex()
+	{
+		BuildSpriteSortKeys(false);
+
+		m_SpritePickItems.clear();
+		float totalExtent = 0.0f;
+
+		// the sorted position is the draw order, layers first, so a higher priority is drawn on top.
+		for (auto& sortKey : m_SpriteSortKeys)
+		{
+			auto& item = m_SpriteDrawItems[sortKey.index];
+			auto transform = GetWorldMatrix(item.entity);
+
+			SpritePickItem2D pickItem;
+			pickItem.entity = item.entity;
+			pickItem.priority = (uint32_t)m_SpritePickItems.size();
+			pickItem.inverseTransform = glm::inverse(transform);
+			pickItem.min = glm::vec2(std::numeric_limits<float>::max());
+			pickItem.max = glm::vec2(std::numeric_limits<float>::lowest());
+
+			const glm::vec4 corners[4] = { { -0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, -0.5f, 0.0f, 1.0f }, { 0.5f, 0.5f, 0.0f, 1.0f }, { -0.5f, 0.5f, 0.0f, 1.0f } };
+			for (auto& corner : corners)
+			{
+				glm::vec2 worldCorner = transform * corner;
+				pickItem.min = glm::min(pickItem.min, worldCorner);
+				pickItem.max = glm::max(pickItem.max, worldCorner);
+			}
+
+			glm::vec2 size = pickItem.max - pickItem.min;
+			if (std::isfinite(size.x) && std::isfinite(size.y))
+			{
+				totalExtent += glm::max(size.x, size.y);
+			}
+
+			m_SpritePickItems.push_back(pickItem);
+		}
+
+		// cells about the size of an average sprite, rounded to a power of two so the grid keeps its cells between rebuilds.
+		float cellSize = 1.0f;
+		if (!m_SpritePickItems.empty() && totalExtent > 0.0f)
+		{
+			cellSize = std::exp2(std::round(std::log2(totalExtent / m_SpritePickItems.size())));
+		}
+
+		m_SpritePickGrid.SetCellSize(cellSize);
+		m_SpritePickGrid.Clear();
+
+		for (uint32_t i = 0; i < (uint32_t)m_SpritePickItems.size(); i++)
+		{
+			m_SpritePickGrid.Insert(i, m_SpritePickItems[i].min, m_SpritePickItems[i].max);
+		}
+
+		m_SpritePickIndexDirty = false;
 	}
 
 	void Scene::UpdateGUIPositions()
@@ -239,65 +518,300 @@ namespace Akkad {
 		if (activeContainerEntity.IsValid())
 		{
 			auto& activeContainer = activeContainerEntity.GetComponent<GUIContainerComponent>();
+			glm::vec2 screenSize = activeContainer.container.GetScreenSize();
 			activeContainer.container.SetScreenSize(m_ViewportSize);
+
+			// a resize moves the top level rects, the dirty flags carry it down the tree in the same pass.
+			bool resized = screenSize != m_ViewportSize;
+
+			// flag the ancestors of every dirty rect so the layout pass knows which subtrees to enter.
+			m_DirtyGUIRects.clear();
 			auto view = m_Registry.view<RelationShipComponent, RectTransformComponent>();
 
 			for (auto entity : view)
 			{
-				auto& relation_ship = view.get<RelationShipComponent>(entity);
 				auto& rect_transform = view.get<RectTransformComponent>(entity);
-
-				if (relation_ship.parent.IsValid())
+				if (!rect_transform.rect.IsDirty())
 				{
-					glm::vec2 parent_size = {};
-					glm::vec2 parent_position = {};
+					continue;
+				}
 
-					if (relation_ship.parent.HasComponent<GUIContainerComponent>())
-					{
-						auto& container = relation_ship.parent.GetComponent<GUIContainerComponent>();
-						
-						Graphics::Rect parent;
-						parent.SetBounds({ 0,0 }, container.container.GetScreenSize());
-						rect_transform.rect.SetParent(parent);
+				m_DirtyGUIRects.push_back(entity);
 
+				Entity parent = view.get<RelationShipComponent>(entity).parent;
+				while (parent.IsValid() && parent.HasComponent<RectTransformComponent>())
+				{
+					auto& parent_rect = parent.GetComponent<RectTransformComponent>().rect;
+					if (parent_rect.m_HasDirtyChildren)
+					{
+						break;
 					}
 
-					else if (relation_ship.parent.HasComponent<RectTransformComponent>())
-					{
-						auto& parent_rect = relation_ship.parent.GetComponent<RectTransformComponent>();
+					parent_rect.m_HasDirtyChildren = true;
+					parent = parent.GetComponent<RelationShipComponent>().parent;
+				}
+			}
 
-						rect_transform.rect.SetParent(parent_rect.GetRect());
+			if (!resized && !m_GUILayoutInvalidated && m_DirtyGUIRects.empty())
+			{
+				return;
+			}
 
-						if (relation_ship.prev.IsValid())
-						{
-							if (relation_ship.prev.HasComponent<RectTransformComponent>())
-							{
-								auto& prev_rect = relation_ship.prev.GetComponent<RectTransformComponent>();
-								rect_transform.rect.SetPreviousChild(prev_rect.GetRect());
-								auto& prev_tag = relation_ship.prev.GetComponent<TagComponent>();
-								Entity e{ entity, this };
-								auto& tag = e.GetComponent<TagComponent>();
-							}
-						}
+			m_GUILayoutStats.passes++;
+
+			Graphics::Rect screen;
+			screen.SetBounds({ 0,0 }, activeContainer.container.GetScreenSize());
+			UpdateGUIChildrenPositions(activeContainerEntity, screen, m_GUILayoutInvalidated);
+			m_GUILayoutInvalidated = false;
+
+			// rects that are not under the active container have nothing to follow, they only apply their own constraints.
+			for (auto entity : m_DirtyGUIRects)
+			{
+				auto& rect = view.get<RectTransformComponent>(entity).rect;
+				if (rect.IsDirty())
+				{
+					rect.RecalculateRect();
+					rect.m_IsDirty = false;
+					m_GUILayoutStats.nodesRecomputed++;
+				}
+				rect.m_HasDirtyChildren = false;
+			}
+		}
+
+	}
+
+	void Scene::UpdateGUIChildrenPositions(Entity parent, Graphics::Rect parentRect, bool visitAll)
+	{
+		auto& parent_relation = parent.GetComponent<RelationShipComponent>();
+		Entity current_child = parent_relation.first_child;
+
+		// siblings are laid out in order, a previous child constraint always reads an up to date rect.
+		for (size_t i = 0; i < parent_relation.children; i++)
+		{
+			if (!current_child.IsValid())
+			{
+				break;
+			}
+
+			auto& current_child_relation = current_child.GetComponent<RelationShipComponent>();
+
+			if (current_child.HasComponent<RectTransformComponent>())
+			{
+				auto& rect_transform = current_child.GetComponent<RectTransformComponent>();
+				m_GUILayoutStats.nodesVisited++;
+
+				rect_transform.rect.SetParent(parentRect);
+
+				if (current_child_relation.prev.IsValid() && current_child_relation.prev.HasComponent<RectTransformComponent>())
+				{
+					auto& prev_rect = current_child_relation.prev.GetComponent<RectTransformComponent>();
+					rect_transform.rect.SetPreviousChild(prev_rect.GetRect());
+				}
+
+				bool recalculated = visitAll || rect_transform.rect.IsDirty();
+				if (recalculated)
+				{
+					rect_transform.rect.RecalculateRect();
+					rect_transform.rect.m_IsDirty = false;
+					m_GUILayoutStats.nodesRecomputed++;
+				}
+
+				// children of a recalculated rect compare their parent rect, unchanged ones stop there.
+				if (recalculated || rect_transform.rect.m_HasDirtyChildren)
+				{
+					rect_transform.rect.m_HasDirtyChildren = false;
+					UpdateGUIChildrenPositions(current_child, rect_transform.GetRect(), visitAll);
+				}
+			}
+
+			current_child = current_child_relation.next;
+		}
+	}
+
+	void Scene::SyncGUIComponents()
+	{
+		auto assetManager = Application::GetAssetManager();
+
+		auto textView = m_Registry.view<RectTransformComponent, GUITextComponent>();
+		for (auto entity : textView)
+		{
+			auto& rect_transform = textView.get<RectTransformComponent>(entity);
+			auto& guitext = textView.get<GUITextComponent>(entity);
+
+			if (guitext.fontAssetID != guitext.loadedFontAssetID)
+			{
+				if (!guitext.fontAssetID.empty())
+				{
+					auto fontdesc = assetManager->GetDescriptorByID(guitext.fontAssetID);
+
+					if (fontdesc.absolutePath != guitext.uitext.m_FontFilePath)
+					{
+						guitext.uitext.SetFont(fontdesc.absolutePath);
 					}
+				}
+				guitext.loadedFontAssetID = guitext.fontAssetID;
+			}
+
+			if (guitext.uitext.IsValid())
+			{
+				guitext.uitext.SetBoundingBox(rect_transform.rect);
+				guitext.uitext.SetText(guitext.text);
+				guitext.uitext.SetColor(guitext.color);
 
-					
+				if (guitext.fontSize != guitext.uitext.GetOriginalFontSize())
+				{
+					guitext.uitext.SetOriginalFontSize(guitext.fontSize);
+				}
+
+				if (guitext.alignment != guitext.uitext.GetAlignment())
+				{
+					guitext.uitext.SetAlignment(guitext.alignment);
 				}
 
-				rect_transform.rect.RecalculateRect();
+				if (guitext.fittingMode != guitext.uitext.GetFittingMode())
+				{
+					guitext.uitext.SetFittingMode(guitext.fittingMode);
+				}
+			}
+		}
+
+		auto textInputView = m_Registry.view<RectTransformComponent, GUITextInputComponent>();
+		for (auto entity : textInputView)
+		{
+			auto& rect_transform = textInputView.get<RectTransformComponent>(entity);
+			auto& textinput = textInputView.get<GUITextInputComponent>(entity);
+
+			if (textinput.textinput.GetTextInputRect() != rect_transform.rect)
+			{
+				textinput.textinput.SetTextInputRect(rect_transform.rect);
+			}
+
+			if (textinput.fontAssetID != textinput.loadedFontAssetID)
+			{
+				if (!textinput.fontAssetID.empty())
+				{
+					auto fontdesc = assetManager->GetDescriptorByID(textinput.fontAssetID);
+
+					if (fontdesc.absolutePath != textinput.textinput.GetUIText().m_FontFilePath)
+					{
+						textinput.textinput.GetUIText().SetFont(fontdesc.absolutePath);
+					}
+				}
+				textinput.loadedFontAssetID = textinput.fontAssetID;
 			}
 		}
 
+		auto buttonView = m_Registry.view<RectTransformComponent, GUIButtonComponent>();
+		for (auto entity : buttonView)
+		{
+			buttonView.get<GUIButtonComponent>(entity).button.SetUIRect(buttonView.get<RectTransformComponent>(entity).rect);
+		}
+
+		auto panelView = m_Registry.view<RectTransformComponent, GUIPanelComponent>();
+		for (auto entity : panelView)
+		{
+			panelView.get<GUIPanelComponent>(entity).panel.SetUIRect(panelView.get<RectTransformComponent>(entity).rect);
+		}
+
+		auto checkBoxView = m_Registry.view<RectTransformComponent, GUICheckBoxComponent>();
+		for (auto entity : checkBoxView)
+		{
+			checkBoxView.get<GUICheckBoxComponent>(entity).box.SetBoxUIRect(checkBoxView.get<RectTransformComponent>(entity).rect);
+		}
+
+		auto sliderView = m_Registry.view<RectTransformComponent, GUISliderComponent>();
+		for (auto entity : sliderView)
+		{
+			sliderView.get<GUISliderComponent>(entity).slider.SetSliderRect(sliderView.get<RectTransformComponent>(entity).rect);
+		}
 	}
 
-	void Scene::RenderGUIElement(Entity parent, bool pickingPhase)
+	static void HashGUIValue(uint64_t& hash, uint64_t value)
 	{
-		Entity activeContainerEntity = GetGuiContainer();
-		auto& activeContainer = activeContainerEntity.GetComponent<GUIContainerComponent>();
+		hash ^= value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+	}
 
+	static void HashGUIRect(uint64_t& hash, Graphics::Rect rect)
+	{
+		float bounds[4] = { rect.GetMin().x, rect.GetMin().y, rect.GetMax().x, rect.GetMax().y };
+		uint32_t bits[4];
+		memcpy(bits, bounds, sizeof(bounds));
+
+		HashGUIValue(hash, ((uint64_t)bits[0] << 32) | bits[1]);
+		HashGUIValue(hash, ((uint64_t)bits[2] << 32) | bits[3]);
+	}
+
+	uint64_t Scene::GetGUISignature(GUI::GUIContainer& container)
+	{
+		// everything the draw lists are built from : the hierarchy, the rects and the widget versions.
+		uint64_t signature = 0;
+		HashGUIValue(signature, Renderer2D::GetGUIDebugDrawState());
+
+		Graphics::Rect screen;
+		screen.SetBounds({ 0,0 }, container.GetScreenSize());
+		HashGUIRect(signature, screen);
+
+		auto rectView = m_Registry.view<RelationShipComponent, RectTransformComponent>();
+		for (auto entity : rectView)
+		{
+			auto& relation_ship = rectView.get<RelationShipComponent>(entity);
+			auto& rect_transform = rectView.get<RectTransformComponent>(entity);
+
+			HashGUIValue(signature, (uint32_t)entity);
+			HashGUIValue(signature, ((uint64_t)(uint32_t)relation_ship.parent.m_Handle << 32) | (uint32_t)relation_ship.next.m_Handle);
+			HashGUIValue(signature, relation_ship.children);
+			HashGUIRect(signature, rect_transform.GetRect());
+		}
+
+		auto textView = m_Registry.view<GUITextComponent>();
+		for (auto entity : textView)
+		{
+			HashGUIValue(signature, ((uint64_t)entity << 32) | textView.get<GUITextComponent>(entity).uitext.GetVersion());
+		}
+
+		auto textInputView = m_Registry.view<GUITextInputComponent>();
+		for (auto entity : textInputView)
+		{
+			auto& textinput = textInputView.get<GUITextInputComponent>(entity).textinput;
+			HashGUIValue(signature, ((uint64_t)entity << 32) | textinput.GetVersion());
+			HashGUIValue(signature, textinput.GetUIText().GetVersion());
+		}
+
+		auto buttonView = m_Registry.view<GUIButtonComponent>();
+		for (auto entity : buttonView)
+		{
+			HashGUIValue(signature, ((uint64_t)entity << 32) | buttonView.get<GUIButtonComponent>(entity).button.GetVersion());
+		}
+
+		auto panelView = m_Registry.view<GUIPanelComponent>();
+		for (auto entity : panelView)
+		{
+			HashGUIValue(signature, ((uint64_t)entity << 32) | panelView.get<GUIPanelComponent>(entity).panel.GetVersion());
+		}
+
+		auto checkBoxView = m_Registry.view<GUICheckBoxComponent>();
+		for (auto entity : checkBoxView)
+		{
+			HashGUIValue(signature, ((uint64_t)entity << 32) | checkBoxView.get<GUICheckBoxComponent>(entity).box.GetVersion());
+		}
+
+		auto sliderView = m_Registry.view<GUISliderComponent>();
+		for (auto entity : sliderView)
+		{
+			HashGUIValue(signature, ((uint64_t)entity << 32) | sliderView.get<GUISliderComponent>(entity).slider.GetVersion());
+		}
+
+		return signature;
+	}
+
+	void Scene::BuildGUIDrawLists(Entity parent, GUI::GUIContainer& container)
+	{
 		if (parent.IsValid())
 		{
+			auto& drawList = container.GetDrawList();
+			auto& pickingDrawList = container.GetPickingDrawList();
 			auto& parent_relation = parent.GetComponent<RelationShipComponent>();
+			bool drawDebugRects = Renderer2D::GetGUIDebugDrawState();
 
 			Entity current_child = parent_relation.first_child;
 
@@ -306,174 +820,98 @@ namespace Akkad {
 				if (current_child.IsValid())
 				{
 					auto& current_child_relation = current_child.GetComponent<RelationShipComponent>();
-					size_t child_id = (size_t)current_child.m_Handle;
 
-					// Draw gui components here
+					// the picking shader rebuilds the entity ID from the RGB bytes, 0 is the cleared buffer.
+					uint32_t pickingID = (uint32_t)current_child.m_Handle;
+					uint32_t pickingColor = ((pickingID + 1) & 0xFFFFFF) | (0xFFu << 24);
+
 					if (current_child.HasComponent<RectTransformComponent>())
 					{
 						auto& rect_transform = current_child.GetComponent<RectTransformComponent>();
-						if (parent.HasComponent<RectTransformComponent>())
-						{
-							auto& parent_rect = parent.GetComponent<RectTransformComponent>();
-							rect_transform.rect.SetParent(parent_rect.rect.m_Rect);
-						}
-						if (Renderer2D::GetGUIDebugDrawState())
+						if (drawDebugRects)
 						{
-							if (!pickingPhase)
-							{
-								Renderer2D::DrawRect(rect_transform.GetRect(), { 1,0,0 }, false, activeContainer.container.GetProjection());
-							}
+							drawList.AddRectOutline(rect_transform.GetRect(), { 1,0,0 });
 						}
 
 						if (current_child.HasComponent<GUITextComponent>())
 						{
 							auto& guitext = current_child.GetComponent<GUITextComponent>();
-							if (!guitext.fontAssetID.empty())
-							{
-								auto fontdesc = Application::GetAssetManager()->GetDescriptorByID(guitext.fontAssetID);
-
-								if (fontdesc.absolutePath != guitext.uitext.m_FontFilePath)
-								{
-									guitext.uitext.SetFont(fontdesc.absolutePath);
-								}
-							}
 							if (guitext.uitext.IsValid())
 							{
-								guitext.uitext.SetBoundingBox(rect_transform.rect);
-								guitext.uitext.SetText(guitext.text);
-
-
-								if (guitext.uitext.GetColor() != guitext.color)
-								{
-									guitext.uitext.SetColor(guitext.color);
-								}
-
-								if (guitext.fontSize != guitext.uitext.GetOriginalFontSize())
-								{
-									guitext.uitext.SetOriginalFontSize(guitext.fontSize);
-								}
-
-								if (guitext.alignment != guitext.uitext.GetAlignment())
-								{
-									guitext.uitext.SetAlignment(guitext.alignment);
-								}
-
-								if (guitext.fittingMode != guitext.uitext.GetFittingMode())
+								drawList.AddText(guitext.uitext);
+								if (drawDebugRects)
 								{
-									guitext.uitext.SetFittingMode(guitext.fittingMode);
-								}
-
-								if (!pickingPhase)
-								{
-									Renderer2D::RenderText(guitext.uitext, activeContainer.container.GetProjection());
+									for (auto& line : guitext.uitext.GetLines())
+									{
+										drawList.AddRectOutline(line.boundingBox.GetRect(), { 1,0,0 });
+									}
 								}
 							}
-							
 						}
 
 						if (current_child.HasComponent<GUITextInputComponent>())
 						{
 							auto& textinput = current_child.GetComponent<GUITextInputComponent>();
-							if (textinput.textinput.GetTextInputRect() != rect_transform.rect)
-							{
-								textinput.textinput.SetTextInputRect(rect_transform.rect);
-							}
-							
-							if (!textinput.fontAssetID.empty())
-							{
-								auto fontdesc = Application::GetAssetManager()->GetDescriptorByID(textinput.fontAssetID);
+							auto& uitext = textinput.textinput.GetUIText();
 
-								if (fontdesc.absolutePath != textinput.textinput.GetUIText().m_FontFilePath)
+							drawList.AddRect(textinput.textinput.GetTextInputRect().GetRect(), textinput.textinput.GetTextInputColor());
+							drawList.AddText(uitext);
+							if (drawDebugRects && uitext.IsValid())
+							{
+								for (auto& line : uitext.GetLines())
 								{
-									textinput.textinput.GetUIText().SetFont(fontdesc.absolutePath);
+									drawList.AddRectOutline(line.boundingBox.GetRect(), { 1,0,0 });
 								}
 							}
 
-							if (!pickingPhase)
-							{
-								Renderer2D::DrawRect(textinput.textinput.GetTextInputRect().GetRect(), textinput.textinput.GetTextInputColor(), true, activeContainer.container.GetProjection());
-								Renderer2D::RenderText(textinput.textinput.GetUIText(), activeContainer.container.GetProjection());
-							}
-							if (pickingPhase)
-							{
-								child_id += 1;
-								glm::vec3 color;
-								color.r = child_id;
-								Renderer2D::DrawRect(textinput.textinput.GetTextInputRect().GetRect(), color, true, activeContainer.container.GetProjection());
-							}
+							pickingDrawList.AddRect(textinput.textinput.GetTextInputRect().GetRect(), pickingColor);
+							container.AddHitRect(pickingID, textinput.textinput.GetTextInputRect().GetRect());
 						}
 
 						if (current_child.HasComponent<GUIButtonComponent>())
 						{
 							auto& guibutton = current_child.GetComponent<GUIButtonComponent>();
-							guibutton.button.SetUIRect(rect_transform.rect);
-							if (pickingPhase)
-							{
-								child_id += 1;
-								glm::vec3 color;
-								color.r = child_id;
-								Renderer2D::DrawRect(guibutton.button.GetUIRect().GetRect(), color, true, activeContainer.container.GetProjection());
-							}
-							else
-							{
-								Renderer2D::DrawRect(guibutton.button.GetUIRect().GetRect(), guibutton.button.GetColor(), true, activeContainer.container.GetProjection());
-							}
+							drawList.AddRect(guibutton.button.GetUIRect().GetRect(), guibutton.button.GetColor());
+							pickingDrawList.AddRect(guibutton.button.GetUIRect().GetRect(), pickingColor);
+							container.AddHitRect(pickingID, guibutton.button.GetUIRect().GetRect());
 						}
 
 						if (current_child.HasComponent<GUIPanelComponent>())
 						{
 							auto& guipanel = current_child.GetComponent<GUIPanelComponent>();
-							guipanel.panel.SetUIRect(rect_transform.rect);
-							if (!pickingPhase && !guipanel.panel.IsTransparent())
+							if (!guipanel.panel.IsTransparent())
 							{
-								Renderer2D::DrawRect(guipanel.panel.GetUIRect().GetRect(), guipanel.panel.GetColor(), true, activeContainer.container.GetProjection());
+								drawList.AddRect(guipanel.panel.GetUIRect().GetRect(), guipanel.panel.GetColor());
 							}
 						}
 
 						if (current_child.HasComponent<GUICheckBoxComponent>())
 						{
 							auto& checkbox = current_child.GetComponent<GUICheckBoxComponent>();
-							checkbox.box.SetBoxUIRect(rect_transform.rect);
-
-							if (!pickingPhase)
-							{
-								Renderer2D::DrawRect(checkbox.box.GetBoxUIRect().GetRect(), checkbox.box.GetBoxColor(), true, activeContainer.container.GetProjection());
-								if (checkbox.box.IsChecked())
-								{
-									Renderer2D::DrawRect(checkbox.box.GetMarkUIRect().GetRect(), checkbox.box.GetMarkColor(), true, activeContainer.container.GetProjection());
-								}
 
-							}
-							if (pickingPhase)
+							drawList.AddRect(checkbox.box.GetBoxUIRect().GetRect(), checkbox.box.GetBoxColor());
+							if (checkbox.box.IsChecked())
 							{
-								child_id += 1;
-								glm::vec3 color;
-								color.r = child_id;
-								Renderer2D::DrawRect(checkbox.box.GetBoxUIRect().GetRect(), color, true, activeContainer.container.GetProjection());
+								drawList.AddRect(checkbox.box.GetMarkUIRect().GetRect(), checkbox.box.GetMarkColor());
 							}
+
+							pickingDrawList.AddRect(checkbox.box.GetBoxUIRect().GetRect(), pickingColor);
+							container.AddHitRect(pickingID, checkbox.box.GetBoxUIRect().GetRect());
 						}
 
 						if (current_child.HasComponent<GUISliderComponent>())
 						{
 							auto& slider = current_child.GetComponent<GUISliderComponent>();
-							slider.slider.SetSliderRect(rect_transform.rect);
 
-							if (!pickingPhase)
-							{
-								Renderer2D::DrawRect(slider.slider.GetSliderRect().GetRect(), slider.slider.GetSliderColor(), true, activeContainer.container.GetProjection());
-								Renderer2D::DrawRect(slider.slider.GetKnobRect().GetRect(), slider.slider.GetKnobColor(), true, activeContainer.container.GetProjection());
-							}
-							if (pickingPhase)
-							{
-								child_id += 1;
-								glm::vec3 color;
-								color.r = child_id;
-								Renderer2D::DrawRect(slider.slider.GetSliderRect().GetRect(), color, true, activeContainer.container.GetProjection());
-							}
+							drawList.AddRect(slider.slider.GetSliderRect().GetRect(), slider.slider.GetSliderColor());
+							drawList.AddRect(slider.slider.GetKnobRect().GetRect(), slider.slider.GetKnobColor());
+
+							pickingDrawList.AddRect(slider.slider.GetSliderRect().GetRect(), pickingColor);
+							container.AddHitRect(pickingID, slider.slider.GetSliderRect().GetRect());
 						}
 					}
 
-					RenderGUIElement(current_child, pickingPhase); // draw the child elements of the current child
+					BuildGUIDrawLists(current_child, container); // add the child elements of the current child
 					current_child = current_child_relation.next;
 				}
 			}
@@ -482,32 +920,59 @@ namespace Akkad {
 
 	void Scene::RenderGUI(bool pickingPhase)
 	{
+		AK_PROFILE_SCOPE("Scene::RenderGUI");
 		UpdateGUIPositions();
+		SyncGUIComponents();
+
+		Entity activeContainerEntity = GetGuiContainer();
+		if (activeContainerEntity.IsValid())
+		{
+			auto& container = activeContainerEntity.GetComponent<GUIContainerComponent>().container;
+
+			// the widgets are only walked when one of them changed, a static GUI replays its cached lists.
+			uint64_t signature = GetGUISignature(container);
+			if (!container.IsDrawListValid(signature))
+			{
+				container.ClearDrawLists();
+				BuildGUIDrawLists(activeContainerEntity, container);
+				container.SetDrawListSignature(signature);
+			}
+
+			if (pickingPhase)
+			{
+				Renderer2D::DrawGUI(container.GetPickingDrawList(), container.GetProjection(), true);
+			}
+			else
+			{
+				Renderer2D::DrawGUI(container.GetDrawList(), container.GetProjection(), false);
+			}
+		}
 
-		Entity activeContainerEntity = GetGuiContainer();
-		if (activeContainerEntity.IsValid())
-		{
-			auto& activeContainer = activeContainerEntity.GetComponent<GUIContainerComponent>();
+		// the GUI is drawn after EndScene, replay it while the caller's target is still bound.
+		Renderer2D::Flush();
 
-			RenderGUIElement(activeContainerEntity, pickingPhase);
+		// the picking pass runs first, the frame's layout work is complete once the GUI is drawn.
+		if (!pickingPhase)
+		{
+			m_LastGUILayoutStats = m_GUILayoutStats;
+			m_GUILayoutStats = {};
 		}
-		
 	}	
 
 	void Scene::BeginRenderer2D(float aspectRatio)
 	{
-		auto view = m_Registry.view<TransformComponent, CameraComponent>();
+		auto view = m_Registry.view<CameraComponent>();
 		bool foundCamera = false;
 
 		for (auto entity : view)
 		{
-			auto& transform = view.get<TransformComponent>(entity);
 			auto& camera = view.get<CameraComponent>(entity);
 
-			if (camera.isActive)
+			if (camera.isActive && HasTransform(entity))
 			{
+				auto transform = GetWorldMatrix(entity);
 				camera.camera.SetAspectRatio(aspectRatio);
-				Renderer2D::BeginScene(camera.camera, transform.GetTransformMatrix());
+				Renderer2D::BeginScene(camera.camera, transform);
 				break;
 			}
 		}
@@ -515,159 +980,181 @@ namespace Akkad {
 
 	void Scene::Update()
 	{
+		AK_PROFILE_SCOPE("Scene::Update");
+		m_SystemScheduler.Run(*this);
+	}
 
-		// Update physics
-		{
-			m_PhysicsWorld2D.SetContactListener(&m_PhysicsListener2D);
-			//m_PhysicsWorld2D.Step();
+	void Scene::RegisterBuiltinSystems()
+	{
+		// registered in the order Update() used to run them in, the conflicting ones keep it.
+		m_SystemScheduler.AddSystem("Physics2DSync", SystemPhase::Physics,
+			SystemAccess().Read<RigidBody2dComponent>().Write<TransformComponent, Transform2DComponent>(),
+			[](Scene& scene) { scene.UpdatePhysics2D(); });
 
-			auto view = m_Registry.view<TransformComponent, RigidBody2dComponent>();
+		m_SystemScheduler.AddSystem("Transforms", SystemPhase::Physics,
+			SystemAccess().Read<RelationShipComponent>().Write<TransformComponent, Transform2DComponent>(),
+			[](Scene& scene) { scene.UpdateTransforms(); });
 
-			for (auto entity : view)
+		m_SystemScheduler.AddSystem("DestroyEntities", SystemPhase::Update, SystemAccess().Exclusive(),
+			[](Scene& scene) { scene.CleanUpDestroyedEntities(); });
+
+		m_SystemScheduler.AddSystem("GUIInput", SystemPhase::Update, SystemAccess().Exclusive(),
+			[](Scene& scene) { scene.HandleGUIEvents(); });
+
+		m_SystemScheduler.AddSystem("Scripts", SystemPhase::Update, SystemAccess().Exclusive(),
+			[](Scene& scene) { scene.UpdateScripts(); });
+	}
+
+	void Scene::UpdatePhysics2D()
+	{
+		AK_PROFILE_SCOPE("Scene::UpdatePhysics2D");
+		m_PhysicsWorld2D.SetContactListener(&m_PhysicsListener2D);
+		//m_PhysicsWorld2D.Step();
+
+		auto view = m_Registry.view<RigidBody2dComponent>();
+
+		for (auto entity : view)
+		{
+			auto& rigidbody2dcomponent = view.get<RigidBody2dComponent>(entity);
+
+			if (rigidbody2dcomponent.body.IsValid())
 			{
-				auto& transform = view.get<TransformComponent>(entity);
-				auto& rigidbody2dcomponent = view.get<RigidBody2dComponent>(entity);
+				glm::vec2 position = rigidbody2dcomponent.body.GetPosition();
+				float rotation = rigidbody2dcomponent.body.GetRotation();
 
-				if (rigidbody2dcomponent.body.IsValid())
+				// 2D transforms only store the new values, the matrices are built when the entity is drawn.
+				if (auto transform2D = m_Registry.try_get<Transform2DComponent>(entity))
+				{
+					transform2D->SetPosition(position);
+					transform2D->SetRotation(rotation);
+				}
+				else if (auto transform = m_Registry.try_get<TransformComponent>(entity))
 				{
-					glm::vec2 position = rigidbody2dcomponent.body.GetPosition();
-					float rotation = rigidbody2dcomponent.body.GetRotation();
-					transform.SetPostion({ position.x, position.y, 0.0f });
-					transform.SetRotation({ 0, 0, rotation });
+					transform->SetPostion({ position.x, position.y, 0.0f });
+					transform->SetRotation({ 0, 0, rotation });
 				}
+			}
 
 
-			}
 		}
+	}
 
-		UpdateTransforms();
-
-		CleanUpDestroyedEntities();
+	void Scene::HandleGUIEvents()
+	{
+		AK_PROFILE_SCOPE("Scene::HandleGUIEvents");
+		auto input = Application::GetInputManager();
 
-		// Handle GUI mouse events
+		if (input->GetMouseDown(MouseButtons::LEFT))
 		{
-			auto input = Application::GetInputManager();
+			int mouseX = input->GetMouseX();
+			int mouseY = input->GetMouseY();
 
-			if (input->GetMouseDown(MouseButtons::LEFT))
+			if (mouseX < m_ViewportRect.GetMax().x && mouseY < m_ViewportRect.GetMax().y)
 			{
-				int mouseX = input->GetMouseX();
-				int mouseY = input->GetMouseY();
-
-				if (mouseX < m_ViewportRect.GetMax().x && mouseY < m_ViewportRect.GetMax().y)
+				if (mouseX > m_ViewportRect.GetMin().x && mouseY > m_ViewportRect.GetMin().y)
 				{
-					if (mouseX > m_ViewportRect.GetMin().x && mouseY > m_ViewportRect.GetMin().y)
+					int bufferX = mouseX - (int)m_ViewportRect.GetMin().x;
+					int bufferY = mouseY - (int)m_ViewportRect.GetMin().y;
+					Entity PickedEntity = Entity(PickGUI({ bufferX, bufferY }), this);
+					if (PickedEntity.IsValid())
 					{
-						int bufferX = mouseX - (int)m_ViewportRect.GetMin().x;
-						int bufferY = mouseY - (int)m_ViewportRect.GetMin().y;
-						auto pixel = m_PickingBuffer->ReadPixels(bufferX, m_ViewportSize.y - bufferY - 1);
-						
-						unsigned int entityID = pixel.x;
-
-						entityID -= 1;
-						Entity PickedEntity = Entity((entt::entity)entityID, this);
-						if (PickedEntity.IsValid())
-						{
-							m_LastPickedEntity = (entt::entity) - 1;
+						m_LastPickedEntity = (entt::entity) - 1;
 
-							if (PickedEntity.HasComponent<GUIButtonComponent>())
-							{
-								auto& uibutton = PickedEntity.GetComponent<GUIButtonComponent>();
-
-								if (uibutton.button.m_Callback)
-								{
-									uibutton.button.m_Callback();
-								}
-								m_LastPickedEntity = PickedEntity.m_Handle;
-							}
+						if (PickedEntity.HasComponent<GUIButtonComponent>())
+						{
+							auto& uibutton = PickedEntity.GetComponent<GUIButtonComponent>();
 
-							if (PickedEntity.HasComponent<GUICheckBoxComponent>())
+							if (uibutton.button.m_Callback)
 							{
-								auto& checkBox = PickedEntity.GetComponent<GUICheckBoxComponent>();
-								checkBox.box.SetCheckStatus(!checkBox.box.IsChecked());
+								uibutton.button.m_Callback();
 							}
+							m_LastPickedEntity = PickedEntity.m_Handle;
+						}
 
-							if (PickedEntity.HasComponent<GUITextInputComponent>())
-							{
-								m_LastPickedEntity = PickedEntity.m_Handle;
-							}
+						if (PickedEntity.HasComponent<GUICheckBoxComponent>())
+						{
+							auto& checkBox = PickedEntity.GetComponent<GUICheckBoxComponent>();
+							checkBox.box.SetCheckStatus(!checkBox.box.IsChecked());
 						}
-						else
+
+						if (PickedEntity.HasComponent<GUITextInputComponent>())
 						{
-							m_LastPickedEntity = (entt::entity)-1;
+							m_LastPickedEntity = PickedEntity.m_Handle;
 						}
-	
 					}
+					else
+					{
+						m_LastPickedEntity = (entt::entity)-1;
+					}
+	
 				}
 			}
+		}
 
-			if (input->IsMouseDown(MouseButtons::LEFT))
-			{
-				int mouseX = input->GetMouseX();
-				int mouseY = input->GetMouseY();
+		if (input->IsMouseDown(MouseButtons::LEFT))
+		{
+			int mouseX = input->GetMouseX();
+			int mouseY = input->GetMouseY();
 
-				if (mouseX < m_ViewportRect.GetMax().x && mouseY < m_ViewportRect.GetMax().y)
+			if (mouseX < m_ViewportRect.GetMax().x && mouseY < m_ViewportRect.GetMax().y)
+			{
+				if (mouseX > m_ViewportRect.GetMin().x && mouseY > m_ViewportRect.GetMin().y)
 				{
-					if (mouseX > m_ViewportRect.GetMin().x && mouseY > m_ViewportRect.GetMin().y)
+					int bufferX = mouseX - (int)m_ViewportRect.GetMin().x;
+					int bufferY = mouseY - (int)m_ViewportRect.GetMin().y;
+					Entity PickedEntity = Entity(PickGUI({ bufferX, bufferY }), this);
+					if (PickedEntity.IsValid())
 					{
-						int bufferX = mouseX - (int)m_ViewportRect.GetMin().x;
-						int bufferY = mouseY - (int)m_ViewportRect.GetMin().y;
-						auto pixel = m_PickingBuffer->ReadPixels(bufferX, m_ViewportSize.y - bufferY - 1);
-
-						unsigned int entityID = pixel.x;
-
-						entityID -= 1;
-						Entity PickedEntity = Entity((entt::entity)entityID, this);
-						if (PickedEntity.IsValid())
+						if (PickedEntity.HasComponent<GUISliderComponent>())
 						{
-							if (PickedEntity.HasComponent<GUISliderComponent>())
+							m_LastPickedEntity = PickedEntity.m_Handle;
+							auto& slider = PickedEntity.GetComponent<GUISliderComponent>();
+							glm::vec2 sliderMin = slider.slider.GetSliderRect().GetRect().GetMin();
+							glm::vec2 sliderMax = slider.slider.GetSliderRect().GetRect().GetMax();
+							if (bufferX < sliderMax.x && bufferY < sliderMax.y)
 							{
-								m_LastPickedEntity = (entt::entity)entityID;
-								auto& slider = PickedEntity.GetComponent<GUISliderComponent>();
-								glm::vec2 sliderMin = slider.slider.GetSliderRect().GetRect().GetMin();
-								glm::vec2 sliderMax = slider.slider.GetSliderRect().GetRect().GetMax();
-								if (bufferX < sliderMax.x && bufferY < sliderMax.y)
+								if (bufferX > sliderMin.x && bufferY > sliderMin.y)
 								{
-									if (bufferX > sliderMin.x && bufferY > sliderMin.y)
+									float sliderX = bufferX - slider.slider.GetSliderRect().GetRect().GetMin().x;
+									if (sliderX < sliderMax.x)
 									{
-										float sliderX = bufferX - slider.slider.GetSliderRect().GetRect().GetMin().x;
-										if (sliderX < sliderMax.x)
-										{
-											slider.slider.SetKnobX(sliderX);
-										}
+										slider.slider.SetKnobX(sliderX);
 									}
 								}
 							}
 						}
-
 					}
+
 				}
 			}
+		}
 
-			Entity lastEntity = { m_LastPickedEntity, this };
-			if (lastEntity.IsValid())
+		Entity lastEntity = { m_LastPickedEntity, this };
+		if (lastEntity.IsValid())
+		{
+			if (lastEntity.HasComponent<GUITextInputComponent>())
 			{
-				if (lastEntity.HasComponent<GUITextInputComponent>())
+				auto character = input->GetCharacterDown();
+				if (character >= 0 && character < 128)
 				{
-					auto character = input->GetCharacterDown();
-					if (character >= 0 && character < 128)
+					char c = character;
+					auto& textInput = lastEntity.GetComponent<GUITextInputComponent>();
+					if (c == 8)
 					{
-						char c = character;
-						auto& textInput = lastEntity.GetComponent<GUITextInputComponent>();
-						if (c == 8)
-						{
-							textInput.textinput.RemoveCharacter();
-						}
-						else
-						{
-							textInput.textinput.AddCharacter(c);
-						}
+						textInput.textinput.RemoveCharacter();
+					}
+					else
+					{
+						textInput.textinput.AddCharacter(c);
 					}
 				}
 			}
 		}
+	}
 
-		// Update scripts
-		{
+	void Scene::UpdateScripts()
+	{
+		AK_PROFILE_SCOPE("Scene::UpdateScripts");
 		auto view = m_Registry.view<ScriptComponent>();
 
 		for (auto entity : view)
@@ -687,7 +1174,6 @@ namespace Akkad {
 			}
 
 		}
-		}
 	}
 
 	void Scene::Stop()
@@ -724,37 +1210,356 @@ namespace Akkad {
 
 	void Scene::UpdateTransforms()
 	{
-		auto view = m_Registry.view<TransformComponent, RelationShipComponent>();
-		if (view)
+		AK_PROFILE_SCOPE("Scene::UpdateTransforms");
+		m_TransformStats = TransformStats();
+
+		// nothing moved since the last update.
+		if (!m_TransformOrderInvalidated && !m_RecomputeAllTransforms && m_DirtyTransformRoots.empty() &&
+			m_DirtyTransform2DRoots.empty() && m_DirtyTransformEntities.empty())
 		{
-			for (auto entity : view)
+			return;
+		}
+
+		auto view = m_Registry.view<TransformComponent>();
+		auto view2D = m_Registry.view<Transform2DComponent>();
+
+		// parents come first in the order, so a node always reads an up to date parent matrix.
+		// 2D nodes only receive their parent transform, their world transform waits for the first read.
+		// the 3D nodes of a range go through TransformBatch first, relative to the nearest parent outside
+		// of the batch, the ordered pass then applies that parent where there is one.
+		auto recalculateRange = [this, &view, &view2D](uint32_t begin, uint32_t end)
+		{
+			auto& batch = t_TransformBatchScratch;
+			batch.Clear();
+			batch.batchIndices.resize(end - begin, TransformBatch::INVALID_PARENT);
+
+			for (uint32_t i = begin; i < end; i++)
+			{
+				auto& node = m_TransformOrder[i];
+				if (node.is2D)
+				{
+					continue;
+				}
+
+				auto& transform = view.get<TransformComponent>(node.entity);
+				uint32_t parent = TransformBatch::INVALID_PARENT;
+				if (node.parent != InvalidTransformIndex && node.parent >= begin)
+				{
+					parent = batch.batchIndices[node.parent - begin];
+				}
+
+				batch.batchIndices[i - begin] = (uint32_t)batch.components.size();
+				batch.Push(&transform, parent);
+			}
+
+			batch.Compute();
+
+			for (uint32_t i = begin; i < end; i++)
 			{
-				Entity e = { entity, this };
-				if (!e.HasComponent<ColoredSpriteRendererComponent>())
+				auto& node = m_TransformOrder[i];
+				const TransformNode* parent = node.parent != InvalidTransformIndex ? &m_TransformOrder[node.parent] : nullptr;
+
+				if (node.is2D)
 				{
-					if (view.contains(entity))
+					auto& transform = view2D.get<Transform2DComponent>(node.entity);
+					if (parent == nullptr)
+					{
+						transform.SetParentTransform(Affine2D());
+					}
+					else if (parent->is2D)
+					{
+						transform.SetParentTransform(view2D.get<Transform2DComponent>(parent->entity).GetWorldTransform());
+					}
+					else
 					{
-						auto& relation_ship = view.get<RelationShipComponent>(entity);
-						auto& child_transform = view.get<TransformComponent>(entity);
+						transform.SetParentTransform(Affine2D::FromMat4(view.get<TransformComponent>(parent->entity).m_WorldMatrix));
+					}
 
-						if (relation_ship.parent.IsValid())
-						{
-							if (relation_ship.parent.HasComponent<TransformComponent>())
-							{
-								auto& parent_transform = relation_ship.parent.GetComponent<TransformComponent>();
-								//child_transform.m_ParentPosition = parent_transform.GetPosition();
-								//child_transform.m_ParentRotation = parent_transform.GetRotation();
-								child_transform.SetParentPosition(parent_transform.GetPosition());
-								child_transform.SetParentRotation(parent_transform.GetRotation());
-							}
-						}
+					transform.m_IsDirty = false;
+				}
+				else
+				{
+					uint32_t index = batch.batchIndices[i - begin];
+					auto& transform = *batch.components[index];
+					uint32_t batchParent = batch.parents[index];
+
+					if (parent == nullptr)
+					{
+						transform.m_ParentMatrix = glm::mat4(1.0f);
+					}
+					else if (parent->is2D)
+					{
+						transform.m_ParentMatrix = view2D.get<Transform2DComponent>(parent->entity).GetTransformMatrix();
+					}
+					else
+					{
+						transform.m_ParentMatrix = view.get<TransformComponent>(parent->entity).m_WorldMatrix;
+					}
+
+					// a batch root below another node starts a new correction, its batch children inherit it.
+					if (batchParent != TransformBatch::INVALID_PARENT)
+					{
+						batch.corrections[index] = batch.corrections[batchParent];
+					}
+					else if (parent != nullptr)
+					{
+						batch.corrections[index] = (uint32_t)batch.correctionMatrices.size();
+						batch.correctionMatrices.push_back(transform.m_ParentMatrix);
 					}
+
+					uint32_t correction = batch.corrections[index];
+					transform.m_LocalMatrix = batch.localMatrices[index];
+					transform.m_WorldMatrix = correction != TransformBatch::INVALID_PARENT ?
+						batch.correctionMatrices[correction] * batch.worldMatrices[index] : batch.worldMatrices[index];
+					transform.m_IsDirty = false;
 				}
+			}
+		};
 
-				
+		// subtrees are contiguous and do not share nodes, each of them can be recomputed on another thread.
+		m_TransformRanges.clear();
+		CollectDirtyTransformRanges();
+
+		for (auto& range : m_TransformRanges)
+		{
+			m_TransformStats.nodesRecomputed += range.second - range.first;
+		}
+
+		auto jobSystem = Application::GetJobSystem();
+		if (jobSystem != nullptr && m_TransformRanges.size() > 1 && m_TransformStats.nodesRecomputed >= ParallelTransformThreshold)
+		{
+			jobSystem->ParallelFor(0, m_TransformRanges.size(), 1, [this, &recalculateRange](size_t begin, size_t end)
+			{
+				for (size_t i = begin; i < end; i++)
+				{
+					recalculateRange(m_TransformRanges[i].first, m_TransformRanges[i].second);
+				}
+			});
+		}
+		else
+		{
+			for (auto& range : m_TransformRanges)
+			{
+				recalculateRange(range.first, range.second);
+			}
+		}
+	}
+
+	void Scene::CollectDirtyTransformRanges()
+	{
+		auto view = m_Registry.view<TransformComponent>();
+		auto view2D = m_Registry.view<Transform2DComponent>();
+
+		if (m_TransformOrderInvalidated)
+		{
+			// the pushed indices point into the old order, their entities are looked up again after the rebuild.
+			for (auto roots : { &m_DirtyTransformRoots, &m_DirtyTransform2DRoots })
+			{
+				for (auto index : *roots)
+				{
+					if (index < m_TransformOrder.size())
+					{
+						m_DirtyTransformEntities.push_back(m_TransformOrder[index].entity);
+					}
+				}
+
+				roots->clear();
+			}
+
+			RebuildTransformOrder();
+			m_TransformOrderInvalidated = false;
+			m_TransformStats.orderRebuilt = true;
+		}
+
+		if (m_RecomputeAllTransforms)
+		{
+			for (uint32_t index = 0; index < m_TransformOrder.size(); index = m_TransformOrder[index].subtreeEnd)
+			{
+				m_TransformRanges.push_back({ index, m_TransformOrder[index].subtreeEnd });
+			}
+
+			m_DirtyTransformRoots.clear();
+			m_DirtyTransform2DRoots.clear();
+			m_DirtyTransformEntities.clear();
+			m_RecomputeAllTransforms = false;
+			return;
+		}
+
+		for (auto entity : m_DirtyTransformEntities)
+		{
+			if (!m_Registry.valid(entity))
+			{
+				continue;
+			}
+
+			if (auto transform2D = m_Registry.try_get<Transform2DComponent>(entity))
+			{
+				m_DirtyTransformRoots.push_back(transform2D->m_HierarchyIndex);
+			}
+			else if (auto transform = m_Registry.try_get<TransformComponent>(entity))
+			{
+				m_DirtyTransformRoots.push_back(transform->m_HierarchyIndex);
+			}
+		}
+
+		m_DirtyTransformEntities.clear();
+		m_DirtyTransformRoots.insert(m_DirtyTransformRoots.end(), m_DirtyTransform2DRoots.begin(), m_DirtyTransform2DRoots.end());
+		m_DirtyTransform2DRoots.clear();
+
+		if (m_DirtyTransformRoots.empty())
+		{
+			return;
+		}
+
+		// subtrees are contiguous, a dirty node inside of an already collected range is skipped.
+		std::sort(m_DirtyTransformRoots.begin(), m_DirtyTransformRoots.end());
+		uint32_t recalculatedEnd = 0;
+
+		for (auto index : m_DirtyTransformRoots)
+		{
+			if (index < recalculatedEnd || index >= m_TransformOrder.size())
+			{
+				continue;
+			}
+
+			// a 2D parent outside of the range computes its world transform on the first read, that read
+			// has to happen here, siblings in different ranges would race on it.
+			uint32_t parent = m_TransformOrder[index].parent;
+			if (parent != InvalidTransformIndex && m_TransformOrder[parent].is2D)
+			{
+				view2D.get<Transform2DComponent>(m_TransformOrder[parent].entity).GetWorldTransform();
+			}
+
+			recalculatedEnd = m_TransformOrder[index].subtreeEnd;
+			m_TransformRanges.push_back({ index, recalculatedEnd });
+			m_TransformStats.dirtyRoots++;
+		}
+
+		m_DirtyTransformRoots.clear();
+	}
+
+	void Scene::RebuildTransformOrder()
+	{
+		auto view = m_Registry.view<TransformComponent>();
+		auto view2D = m_Registry.view<Transform2DComponent>();
+		m_TransformOrder.clear();
+		m_TransformOrder.reserve(view.size() + view2D.size());
+
+		// every root appends its whole subtree, the others are reached from their parents.
+		auto appendRoot = [this](entt::entity entity)
+		{
+			auto relation_ship = m_Registry.try_get<RelationShipComponent>(entity);
+			if (relation_ship != nullptr && relation_ship->parent.IsValid() && HasTransform(relation_ship->parent.m_Handle))
+			{
+				return;
+			}
+
+			AppendTransformSubtree({ entity, this }, InvalidTransformIndex);
+		};
+
+		for (auto entity : view)
+		{
+			if (!view2D.contains(entity))
+			{
+				appendRoot(entity);
+			}
+		}
+
+		for (auto entity : view2D)
+		{
+			appendRoot(entity);
+		}
+	}
+
+	void Scene::AppendTransformSubtree(Entity entity, uint32_t parentIndex)
+	{
+		uint32_t index = (uint32_t)m_TransformOrder.size();
+		bool is2D = entity.HasComponent<Transform2DComponent>();
+		m_TransformOrder.push_back({ entity.m_Handle, parentIndex, 0, is2D });
+
+		if (is2D)
+		{
+			auto& transform = entity.GetComponent<Transform2DComponent>();
+			transform.m_HierarchyIndex = index;
+			transform.m_DirtyRoots = &m_DirtyTransform2DRoots;
+		}
+		else
+		{
+			auto& transform = entity.GetComponent<TransformComponent>();
+			transform.m_HierarchyIndex = index;
+			transform.m_DirtyRoots = &m_DirtyTransformRoots;
+		}
+
+		if (entity.HasComponent<RelationShipComponent>())
+		{
+			auto& relation_ship = entity.GetComponent<RelationShipComponent>();
+			Entity current_child = relation_ship.first_child;
+
+			for (size_t i = 0; i < relation_ship.children && current_child.IsValid(); i++)
+			{
+				// children without a transform start their own subtree from RebuildTransformOrder().
+				if (HasTransform(current_child.m_Handle))
+				{
+					AppendTransformSubtree(current_child, index);
+				}
+
+				current_child = current_child.GetComponent<RelationShipComponent>().next;
 			}
 		}
 
+		m_TransformOrder[index].subtreeEnd = (uint32_t)m_TransformOrder.size();
+	}
+
+	template<typename Component>
+	void Scene::OnTransformConstructed(entt::registry& registry, entt::entity entity)
+	{
+		// a copied component still points at the list of the scene it came from.
+		registry.get<Component>(entity).m_DirtyRoots = nullptr;
+		m_DirtyTransformEntities.push_back(entity);
+		m_TransformOrderInvalidated = true;
+	}
+
+	template<typename Component>
+	void Scene::OnTransformDestroyed(entt::registry& registry, entt::entity entity)
+	{
+		// the children of the removed transform get a new parent matrix.
+		uint32_t index = registry.get<Component>(entity).m_HierarchyIndex;
+		if (index < m_TransformOrder.size() && m_TransformOrder[index].entity == entity)
+		{
+			for (uint32_t child = index + 1; child < m_TransformOrder[index].subtreeEnd; child = m_TransformOrder[child].subtreeEnd)
+			{
+				m_DirtyTransformEntities.push_back(m_TransformOrder[child].entity);
+			}
+		}
+		else
+		{
+			m_RecomputeAllTransforms = true;
+		}
+
+		m_TransformOrderInvalidated = true;
+	}
+
+	void Scene::ConnectTransformListeners()
+	{
+		m_Registry.on_construct<TransformComponent>().connect<&Scene::OnTransformConstructed<TransformComponent>>(*this);
+		m_Registry.on_destroy<TransformComponent>().connect<&Scene::OnTransformDestroyed<TransformComponent>>(*this);
+		m_Registry.on_construct<Transform2DComponent>().connect<&Scene::OnTransformConstructed<Transform2DComponent>>(*this);
+		m_Registry.on_destroy<Transform2DComponent>().connect<&Scene::OnTransformDestroyed<Transform2DComponent>>(*this);
+	}
+
+	glm::mat4 Scene::GetWorldMatrix(entt::entity entity)
+	{
+		if (auto transform2D = m_Registry.try_get<Transform2DComponent>(entity))
+		{
+			return transform2D->GetTransformMatrix();
+		}
+
+		return m_Registry.get<TransformComponent>(entity).GetTransformMatrix();
+	}
+
+	bool Scene::HasTransform(entt::entity entity)
+	{
+		return m_Registry.any_of<TransformComponent, Transform2DComponent>(entity);
 	}
 
 	void Scene::InitilizePhysicsBodies2D(Entity entity)
@@ -762,7 +1567,6 @@ namespace Akkad {
 		if (entity.HasComponent<RigidBody2dComponent>())
 		{
 			auto& rigidbody2dcomp = entity.GetComponent<RigidBody2dComponent>();
-			auto& transform = entity.GetComponent<TransformComponent>();
 
 			BodySettings settings;
 			settings.density = rigidbody2dcomp.density;
@@ -770,11 +1574,24 @@ namespace Akkad {
 			settings.shape = rigidbody2dcomp.shape;
 			settings.type = rigidbody2dcomp.type;
 
-			settings.position = { transform.GetPosition().x, transform.GetPosition().y };
-			settings.rotation = { transform.GetRotation().z };
+			glm::vec2 scale;
+			if (entity.HasComponent<Transform2DComponent>())
+			{
+				auto& transform = entity.GetComponent<Transform2DComponent>();
+				settings.position = transform.GetPosition();
+				settings.rotation = transform.GetRotation();
+				scale = transform.GetScale();
+			}
+			else
+			{
+				auto& transform = entity.GetComponent<TransformComponent>();
+				settings.position = { transform.GetPosition().x, transform.GetPosition().y };
+				settings.rotation = { transform.GetRotation().z };
+				scale = glm::vec2(transform.GetScale());
+			}
 
-			settings.halfX = transform.GetScale().x / 2;
-			settings.halfY = transform.GetScale().y / 2;
+			settings.halfX = scale.x / 2;
+			settings.halfY = scale.y / 2;
 
 			rigidbody2dcomp.body = m_PhysicsWorld2D.CreateBody(settings, this, (uint32_t)entity.m_Handle);
 		}
@@ -836,7 +1653,16 @@ namespace Akkad {
 
 	void Scene::SetViewportSize(glm::vec2 size)
 	{
-		m_PickingBuffer->SetSize(size.x, size.y);
+		if (size == m_ViewportSize)
+		{
+			return;
+		}
+
+		auto pickingBuffer = m_PickingBuffer;
+		if (pickingBuffer != nullptr)
+		{
+			RenderThread::Submit([pickingBuffer, size]() { pickingBuffer->SetSize(size.x, size.y); });
+		}
 		m_ViewportSize = size;
 	}
 
@@ -941,6 +1767,10 @@ namespace Akkad {
 				prev_relation.next = child_relation.next;
 			}
 
+			// the links of the old siblings must not leak into the new parent's list.
+			child_relation.prev = {};
+			child_relation.next = {};
+
 			if (parent.IsValid())
 			{
 				auto& parent_relation = parent.GetComponent<RelationShipComponent>();
@@ -967,7 +1797,9 @@ namespace Akkad {
 			}
 
 			child_relation.parent = parent;
-
+			m_GUILayoutInvalidated = true;
+			m_TransformOrderInvalidated = true;
+			m_DirtyTransformEntities.push_back(child.m_Handle);
 
 		}
 	}
@@ -1052,10 +1884,21 @@ namespace Akkad {
 			auto entity_data = instantiable_data["Scene"]["Entities"].items().begin();
 			SceneSerializer::DeserializeEntity(entity, entity_data.key(), this, instantiable_data);
 
-			auto& transform = entity.GetComponent<TransformComponent>();
-			transform.SetPostion(position);
-			transform.SetRotation(rotation);
-			transform.SetScale(scale);
+			if (entity.HasComponent<Transform2DComponent>())
+			{
+				auto& transform = entity.GetComponent<Transform2DComponent>();
+				transform.SetPosition(glm::vec2(position));
+				transform.SetZ(position.z);
+				transform.SetRotation(rotation.z);
+				transform.SetScale(glm::vec2(scale));
+			}
+			else
+			{
+				auto& transform = entity.GetComponent<TransformComponent>();
+				transform.SetPostion(position);
+				transform.SetRotation(rotation);
+				transform.SetScale(scale);
+			}
 			return entity;
 		}
 		else
@@ -1073,6 +1916,7 @@ namespace Akkad {
 	void Scene::RemoveEntity(Entity entity)
 	{
 		auto& entity_relation = entity.GetComponent<RelationShipComponent>();
+		m_GUILayoutInvalidated = true;
 
 		Entity current_child = entity_relation.first_child;
 		for (size_t i = 0; i < entity_relation.children; i++)
@@ -1123,6 +1967,7 @@ namespace Akkad {
 	void Scene::RemoveEntityWithAllChildren(Entity entity)
 	{
 		auto& entity_relation = entity.GetComponent<RelationShipComponent>();
+		m_GUILayoutInvalidated = true;
 
 		Entity current_child = entity_relation.last_child;
 		for (size_t i = 0; i < entity_relation.children; i++)
@@ -1195,6 +2040,12 @@ namespace Akkad {
 
 	void Scene::CleanUpDestroyedEntities()
 	{
+		// recorded frames may still reference the resources of these entities.
+		if (!m_EntitiesToDestroy.empty())
+		{
+			RenderThread::Sync();
+		}
+
 		for (auto e : m_EntitiesToDestroy)
 		{
 			Entity entity = { e, this };
@@ -1223,15 +2074,14 @@ namespace Akkad {
 
 	Entity Scene::GetActiveCamera()
 	{
-		auto view = m_Registry.view<TransformComponent, CameraComponent>();
+		auto view = m_Registry.view<CameraComponent>();
 		bool foundCamera = false;
 
 		for (auto entity : view)
 		{
-			auto& transform = view.get<TransformComponent>(entity);
 			auto& camera = view.get<CameraComponent>(entity);
 
-			if (camera.isActive)
+			if (camera.isActive && HasTransform(entity))
 			{
 				return {entity, this};
 			}
@@ -1,11 +1,15 @@
 #pragma once
+#include "SystemScheduler.h"
 #include "Akkad/Graphics/Rect.h"
+#include "Akkad/Graphics/Sprite.h"
+#include "Akkad/Graphics/SpriteSortKey.h"
+#include "Akkad/Math/SpatialGrid2D.h"
 #include "Akkad/Physics/Box2d/Box2dWorld.h"
 
 #include <entt/entt.hpp>
 
-#include <condition_variable>
-#include <mutex>
+#include <utility>
+#include <vector>
 
 namespace Akkad {
 
@@ -13,13 +17,17 @@ namespace Akkad {
 		class FrameBuffer;
 	}
 
+	namespace GUI {
+		class GUIContainer;
+	}
+
 	class Entity;
 
 	class Scene {
 
 	public:
 		Scene();
-		Scene(std::string& name) : m_Name(name) {}
+		Scene(std::string& name) : m_Name(name) { ConnectTransformListeners(); RegisterBuiltinSystems(); }
 		~Scene();
 
 
@@ -46,14 +54,59 @@ namespace Akkad {
 
 		entt::entity GetLastPickedEntity() { return m_LastPickedEntity; };
 
+		// gameplay systems are added here and iterate views of the registry, see SystemAccess for what they declare.
+		SystemScheduler& GetSystemScheduler() { return m_SystemScheduler; }
+		entt::registry& GetRegistry() { return m_Registry; }
+
+		// CPU picking, returns entt::null when nothing is hit. points are in viewport pixels with a top left origin,
+		// the GUI is tested first, then the sprites as seen through viewProjection.
+		entt::entity Pick(glm::vec2 viewportPoint, const glm::mat4& viewProjection);
+		entt::entity PickGUI(glm::vec2 viewportPoint);
+		entt::entity PickSprite(glm::vec2 worldPoint);
+
+		struct GUILayoutStats
+		{
+			unsigned int passes = 0;
+			unsigned int nodesVisited = 0;
+			unsigned int nodesRecomputed = 0;
+		};
+
+		// layout work of the last drawn frame, a static GUI reports no passes.
+		GUILayoutStats GetGUILayoutStats() { return m_LastGUILayoutStats; }
+
+		struct TransformStats
+		{
+			bool orderRebuilt = false;
+			unsigned int dirtyRoots = 0;
+			unsigned int nodesRecomputed = 0;
+		};
+
+		// work of the last transform update, a static scene recomputes nothing.
+		TransformStats GetTransformStats() { return m_TransformStats; }
+
 
 	private:
 		void Start();
 		void Update();
 		void Stop();
+		void RegisterBuiltinSystems();
+		void UpdatePhysics2D();
+		void HandleGUIEvents();
+		void UpdateScripts();
 		void SetViewportSize(glm::vec2 size);
 		void SetViewportRect(Graphics::Rect rect) { m_ViewportRect = rect; }
 		void UpdateTransforms();
+		void CollectDirtyTransformRanges();
+		void RebuildTransformOrder();
+		void AppendTransformSubtree(Entity entity, uint32_t parentIndex);
+		// the world matrix of either transform component, 2D transforms are expanded on the fly.
+		glm::mat4 GetWorldMatrix(entt::entity entity);
+		bool HasTransform(entt::entity entity);
+		void ConnectTransformListeners();
+		template<typename Component>
+		void OnTransformConstructed(entt::registry& registry, entt::entity entity);
+		template<typename Component>
+		void OnTransformDestroyed(entt::registry& registry, entt::entity entity);
 
 		void InitilizePhysicsBodies2D(Entity entity);
 		void InitilizePhysicsJoints2D(Entity entity);
@@ -61,11 +114,17 @@ namespace Akkad {
 		void InitilizeEntitiyScript(Entity entity);
 
 		void BeginRenderer2D(float aspectRatio);
+		void BuildSpriteSortKeys(bool advanceAnimations);
 		void Render2D();
+		// GPU picking pass, only used by the editor when it is asked for.
 		void RenderPickingBuffer2D();
+		void BuildSpritePickIndex();
 
 		void UpdateGUIPositions();
-		void RenderGUIElement(Entity parent, bool pickingPhase);
+		void UpdateGUIChildrenPositions(Entity parent, Graphics::Rect parentRect, bool visitAll);
+		void SyncGUIComponents();
+		uint64_t GetGUISignature(GUI::GUIContainer& container);
+		void BuildGUIDrawLists(Entity parent, GUI::GUIContainer& container);
 		void RenderGUI(bool pickingPhase = false);
 
 		void CleanUpDestroyedEntities();
@@ -75,7 +134,34 @@ namespace Akkad {
 
 		std::vector<entt::entity> m_EntitiesToDestroy;
 
+		struct SpriteDrawItem2D
+		{
+			entt::entity entity;
+			bool animated;
+			Graphics::AnimationFrame frame;
+		};
+
+		// rebuilt every frame, kept as members so the allocations are reused.
+		std::vector<Graphics::SpriteSortKey> m_SpriteSortKeys;
+		std::vector<Graphics::SpriteSortKey> m_SpriteSortScratch;
+		std::vector<SpriteDrawItem2D> m_SpriteDrawItems;
+
+		struct SpritePickItem2D
+		{
+			entt::entity entity;
+			uint32_t priority;
+			glm::mat4 inverseTransform;
+			glm::vec2 min;
+			glm::vec2 max;
+		};
+
+		// world bounds of the sprites drawn last, rebuilt on the first pick after a draw.
+		std::vector<SpritePickItem2D> m_SpritePickItems;
+		SpatialGrid2D m_SpritePickGrid;
+		bool m_SpritePickIndexDirty = true;
+
 		entt::registry m_Registry;
+		SystemScheduler m_SystemScheduler;
 		std::string m_Name = "Scene";
 		glm::vec2 m_ViewportSize = { 0,0 };
 
@@ -88,6 +174,39 @@ namespace Akkad {
 
 		entt::entity m_LastPickedEntity;
 
+		// set when the hierarchy changes, the next layout pass recomputes every rect.
+		bool m_GUILayoutInvalidated = true;
+		std::vector<entt::entity> m_DirtyGUIRects;
+		GUILayoutStats m_GUILayoutStats;
+		GUILayoutStats m_LastGUILayoutStats;
+
+		struct TransformNode
+		{
+			entt::entity entity;
+			uint32_t parent;
+			// one past the last descendant, the subtree of a node is [index, subtreeEnd).
+			uint32_t subtreeEnd;
+			bool is2D;
+		};
+
+		static constexpr uint32_t InvalidTransformIndex = 0xFFFFFFFF;
+		// below this many recomputed nodes the job system costs more than it saves.
+		static constexpr uint32_t ParallelTransformThreshold = 4096;
+
+		// every transform with its parent before its children, rebuilt when entities or the hierarchy change.
+		std::vector<TransformNode> m_TransformOrder;
+		// indices pushed by the transforms that became dirty, one list per component so systems writing
+		// different transform types do not share one.
+		std::vector<uint32_t> m_DirtyTransformRoots;
+		std::vector<uint32_t> m_DirtyTransform2DRoots;
+		// transforms added or moved in the hierarchy, their index is only known once the order is rebuilt.
+		std::vector<entt::entity> m_DirtyTransformEntities;
+		// [begin, end) of the subtrees recomputed by the current transform update.
+		std::vector<std::pair<uint32_t, uint32_t>> m_TransformRanges;
+		bool m_TransformOrderInvalidated = true;
+		bool m_RecomputeAllTransforms = true;
+		TransformStats m_TransformStats;
+
 		friend class Entity;
 		friend class SceneHierarchyPanel;
 		friend class PropertyEditorPanel;
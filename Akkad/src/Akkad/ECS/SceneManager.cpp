@@ -3,11 +3,20 @@
 #include "Serializers/SceneSerializer.h"
 #include "Akkad/Application/Application.h"
 #include "Akkad/Asset/AssetManager.h"
+#include "Akkad/Graphics/RenderThread.h"
+#include "Akkad/Profiling/Profiler.h"
 
 namespace Akkad {
 
 	void SceneManager::LoadScene(std::string sceneName)
 	{
+		// loading creates and frees GPU resources, it runs where the context is current.
+		Graphics::RenderThread::Execute([this, &sceneName]() { LoadSceneImpl(sceneName); });
+	}
+
+	void SceneManager::LoadSceneImpl(std::string& sceneName)
+	{
+		AK_PROFILE_SCOPE("SceneManager::LoadScene");
 		if (m_ActiveScene)
 		{
 			m_ActiveScene->Stop();
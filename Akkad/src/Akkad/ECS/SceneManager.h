@@ -12,6 +12,7 @@ namespace Akkad {
 		SharedPtr<Scene> GetActiveScene() { return m_ActiveScene; };
 
 	private:
+		void LoadSceneImpl(std::string& sceneName);
 		void LoadSceneEditor(std::string filepath);
 		SharedPtr<Scene> m_ActiveScene;
 
@@ -11,6 +11,7 @@ namespace Akkad {
 		auto& sprite = entity.GetComponent<AnimatedSpriteRendererComponent>();
 		entity_data["AnimatedSpriteRenderer"]["MaterialID"] = sprite.materialID;
 		entity_data["AnimatedSpriteRenderer"]["SortingLayer"] = sprite.sprite.GetSortingLayer();
+		entity_data["AnimatedSpriteRenderer"]["OrderInLayer"] = sprite.sprite.GetOrderInLayer();
 		
 		for (auto it : sprite.sprite.m_Animations)
 		{
@@ -26,6 +27,11 @@ namespace Akkad {
 		animated_sprite.materialID = component_data["MaterialID"];
 		animated_sprite.sprite.SetSortingLayer(component_data["SortingLayer"]);
 
+		if (component_data.contains("OrderInLayer"))
+		{
+			animated_sprite.sprite.SetOrderInLayer(component_data["OrderInLayer"]);
+		}
+
 		for (auto it : component_data["Animations"])
 		{
 			animated_sprite.sprite.AddAnimation(it);
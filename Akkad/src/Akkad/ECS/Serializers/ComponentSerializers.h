@@ -1,6 +1,7 @@
 #pragma once
 #include "TagComponentSerializer.h"
 #include "TransformComponentSerializer.h"
+#include "Transform2DComponentSerializer.h"
 #include "SpriteRendererComponentSerializer.h"
 #include "ScriptComponentSerializer.h"
 #include "CameraComponentSerializer.h"
@@ -33,6 +33,11 @@ namespace Akkad {
 			TransformComponentSerializer::Serialize(entity, entity_data);
 		}
 
+		if (entity.HasComponent<Transform2DComponent>())
+		{
+			Transform2DComponentSerializer::Serialize(entity, entity_data);
+		}
+
 		if (entity.HasComponent<SpriteRendererComponent>())
 		{
 			SpriteRendererComponentSerializer::Serialize(entity, entity_data);
@@ -152,6 +157,12 @@ namespace Akkad {
 				continue;
 			}
 
+			else if (component.key() == "Transform2D")
+			{
+				Transform2DComponentSerializer::Deserialize(entity, componentData);
+				continue;
+			}
+
 			else if (component.key() == "Tag")
 			{
 				TagComponentSerializer::Deserialize(entity, componentData);
@@ -10,6 +10,7 @@ namespace Akkad {
 		auto& sprite = entity.GetComponent<SpriteRendererComponent>();
 		entity_data["SpriteRenderer"]["MaterialID"] = sprite.materialID;
 		entity_data["SpriteRenderer"]["SortingLayer"] = sprite.sprite.GetSortingLayer();
+		entity_data["SpriteRenderer"]["OrderInLayer"] = sprite.sprite.GetOrderInLayer();
 		entity_data["SpriteRenderer"]["TileRow"] = sprite.sprite.GetTileRow();
 		entity_data["SpriteRenderer"]["TileColoumn"] = sprite.sprite.GetTileColoumn();
 	}
@@ -26,6 +27,11 @@ namespace Akkad {
 		spriteRenderer.materialID = materialID;
 		spriteRenderer.sprite.SetSortingLayer(sortingLayer);
 
+		if (component_data.contains("OrderInLayer"))
+		{
+			spriteRenderer.sprite.SetOrderInLayer(component_data["OrderInLayer"]);
+		}
+
 		auto desc = Application::GetAssetManager()->GetDescriptorByID(materialID);
 
 		spriteRenderer.sprite.SetMaterial(desc.absolutePath);
@@ -0,0 +1,42 @@
+#include "Transform2DComponentSerializer.h"
+
+#include "Akkad/ECS/Components/TransformComponent.h"
+#include "Akkad/ECS/Components/Transform2DComponent.h"
+namespace Akkad {
+
+	void Transform2DComponentSerializer::Serialize(Entity entity, json& entity_data)
+	{
+		auto& transform = entity.GetComponent<Transform2DComponent>();
+		glm::vec2 position = transform.GetLocalPosition();
+		glm::vec2 scale = transform.GetScale();
+
+		entity_data["Transform2D"]["Position"] = { position.x, position.y };
+		entity_data["Transform2D"]["Rotation"] = transform.GetRotation();
+		entity_data["Transform2D"]["Scale"] = { scale.x, scale.y };
+		entity_data["Transform2D"]["Z"] = transform.GetZ();
+	}
+
+	void Transform2DComponentSerializer::Deserialize(Entity entity, json& component_data)
+	{
+		glm::vec2 position({ component_data["Position"][0],component_data["Position"][1] });
+		glm::vec2 scale({ component_data["Scale"][0],component_data["Scale"][1] });
+
+		// every entity is created with a 3D transform, it is replaced rather than kept next to this one.
+		if (entity.HasComponent<TransformComponent>())
+		{
+			entity.RemoveComponent<TransformComponent>();
+		}
+
+		if (!entity.HasComponent<Transform2DComponent>())
+		{
+			entity.AddComponent<Transform2DComponent>();
+		}
+
+		auto& transform = entity.GetComponent<Transform2DComponent>();
+		transform.SetPosition(position);
+		transform.SetRotation(component_data["Rotation"]);
+		transform.SetScale(scale);
+		transform.SetZ(component_data["Z"]);
+	}
+
+}
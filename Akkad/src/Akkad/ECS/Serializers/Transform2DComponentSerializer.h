@@ -0,0 +1,14 @@
+#pragma once
+#include <Akkad/ECS/Entity.h>
+#include <json.hpp>
+namespace Akkad {
+	using json = nlohmann::ordered_json;
+
+	class Transform2DComponentSerializer
+	{
+	public:
+		static void Serialize(Entity entity, json& entity_data);
+		static void Deserialize(Entity entity, json& component_data);
+
+	};
+}
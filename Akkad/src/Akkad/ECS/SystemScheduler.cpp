@@ -0,0 +1,254 @@
+#include "SystemScheduler.h"
+
+#include "Akkad/Application/Application.h"
+#include "Akkad/Jobs/JobSystem.h"
+#include "Akkad/Logging.h"
+#include "Akkad/Profiling/Profiler.h"
+
+#include <algorithm>
+
+namespace Akkad {
+
+	bool SystemAccess::ConflictsWith(const SystemAccess& other) const
+	{
+		if (m_Exclusive || other.m_Exclusive)
+		{
+			return true;
+		}
+
+		auto touches = [](const SystemAccess& access, entt::id_type component)
+		{
+			return std::find(access.m_Reads.begin(), access.m_Reads.end(), component) != access.m_Reads.end()
+				|| std::find(access.m_Writes.begin(), access.m_Writes.end(), component) != access.m_Writes.end();
+		};
+
+		for (auto component : m_Writes)
+		{
+			if (touches(other, component))
+			{
+				return true;
+			}
+		}
+
+		for (auto component : other.m_Writes)
+		{
+			if (touches(*this, component))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void SystemScheduler::AddSystem(const std::string& name, SystemPhase phase, const SystemAccess& access, SystemFunction function)
+	{
+		if (HasSystem(name))
+		{
+			AK_ERROR("a system named {} is already registered.", name);
+			return;
+		}
+
+		auto system = std::make_unique<System>();
+		system->name = name;
+		system->zoneName = Profiler::InternName(name);
+		system->phase = phase;
+		system->access = access;
+		system->function = std::move(function);
+
+		m_Systems.push_back(std::move(system));
+		m_GraphDirty = true;
+	}
+
+	bool SystemScheduler::RemoveSystem(const std::string& name)
+	{
+		auto it = std::find_if(m_Systems.begin(), m_Systems.end(), [&name](const std::unique_ptr<System>& system) { return system->name == name; });
+		if (it == m_Systems.end())
+		{
+			return false;
+		}
+
+		m_Systems.erase(it);
+		m_GraphDirty = true;
+		return true;
+	}
+
+	bool SystemScheduler::HasSystem(const std::string& name)
+	{
+		return std::any_of(m_Systems.begin(), m_Systems.end(), [&name](const std::unique_ptr<System>& system) { return system->name == name; });
+	}
+
+	void SystemScheduler::Run(Scene& scene)
+	{
+		if (m_GraphDirty)
+		{
+			BuildGraph();
+			m_GraphDirty = false;
+		}
+
+		for (auto& phase : m_Phases)
+		{
+			RunPhase(scene, phase);
+		}
+	}
+
+	std::vector<SystemScheduler::SystemTiming> SystemScheduler::GetTimings()
+	{
+		std::vector<SystemTiming> timings;
+		timings.reserve(m_Systems.size());
+
+		for (auto& phase : m_Phases)
+		{
+			for (auto system : phase)
+			{
+				timings.push_back({ system->name, system->phase, system->durationNs });
+			}
+		}
+
+		return timings;
+	}
+
+	const char* SystemScheduler::GetPhaseName(SystemPhase phase)
+	{
+		switch (phase)
+		{
+		case SystemPhase::PreUpdate:
+			return "PreUpdate";
+		case SystemPhase::Physics:
+			return "Physics";
+		case SystemPhase::Update:
+			return "Update";
+		case SystemPhase::PostUpdate:
+			return "PostUpdate";
+		case SystemPhase::RenderPrep:
+			return "RenderPrep";
+		default:
+			return "Unknown";
+		}
+	}
+
+	void SystemScheduler::BuildGraph()
+	{
+		for (auto& phase : m_Phases)
+		{
+			phase.clear();
+		}
+
+		for (auto& system : m_Systems)
+		{
+			system->dependents.clear();
+			system->dependencyCount = 0;
+			m_Phases[(int)system->phase].push_back(system.get());
+		}
+
+		// edges only go from earlier to later systems, so the graph has no cycle and the
+		// registration order is a valid sequential order.
+		for (auto& phase : m_Phases)
+		{
+			for (size_t later = 0; later < phase.size(); later++)
+			{
+				for (size_t earlier = 0; earlier < later; earlier++)
+				{
+					if (phase[earlier]->access.ConflictsWith(phase[later]->access))
+					{
+						phase[earlier]->dependents.push_back(phase[later]);
+						phase[later]->dependencyCount++;
+					}
+				}
+			}
+		}
+	}
+
+	void SystemScheduler::RunPhase(Scene& scene, std::vector<System*>& systems)
+	{
+		if (systems.empty())
+		{
+			return;
+		}
+
+		auto jobSystem = Application::GetJobSystem();
+		if (jobSystem == nullptr || jobSystem->GetWorkerCount() == 0)
+		{
+			for (auto system : systems)
+			{
+				RunSystem(scene, system);
+			}
+
+			return;
+		}
+
+		for (auto system : systems)
+		{
+			system->pendingDependencies = system->dependencyCount;
+		}
+
+		// counts the systems running as jobs, a system launches its dependents before its own job ends.
+		JobCounter counter;
+		for (auto system : systems)
+		{
+			if (system->dependencyCount == 0)
+			{
+				LaunchSystem(scene, system, jobSystem, counter);
+			}
+		}
+
+		// exclusive systems conflict with every other system, they are only released once the jobs before them
+		// are done. this thread helps with the jobs, then runs the exclusive system they released, if any.
+		while (true)
+		{
+			jobSystem->Wait(counter);
+
+			System* exclusiveSystem = nullptr;
+			{
+				std::lock_guard<std::mutex> lock(m_ReadyMutex);
+				if (!m_ReadyExclusiveSystems.empty())
+				{
+					exclusiveSystem = m_ReadyExclusiveSystems.back();
+					m_ReadyExclusiveSystems.pop_back();
+				}
+			}
+
+			if (exclusiveSystem == nullptr)
+			{
+				break;
+			}
+
+			RunAndRelease(scene, exclusiveSystem, jobSystem, counter);
+		}
+	}
+
+	void SystemScheduler::LaunchSystem(Scene& scene, System* system, JobSystem* jobSystem, JobCounter& counter)
+	{
+		if (system->access.IsExclusive())
+		{
+			std::lock_guard<std::mutex> lock(m_ReadyMutex);
+			m_ReadyExclusiveSystems.push_back(system);
+			return;
+		}
+
+		jobSystem->Submit([this, &scene, system, jobSystem, &counter]() { RunAndRelease(scene, system, jobSystem, counter); }, &counter);
+	}
+
+	void SystemScheduler::RunAndRelease(Scene& scene, System* system, JobSystem* jobSystem, JobCounter& counter)
+	{
+		RunSystem(scene, system);
+
+		for (auto dependent : system->dependents)
+		{
+			if (dependent->pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				LaunchSystem(scene, dependent, jobSystem, counter);
+			}
+		}
+	}
+
+	void SystemScheduler::RunSystem(Scene& scene, System* system)
+	{
+		uint64_t start = Profiler::Now();
+		{
+			AK_PROFILE_SCOPE(system->zoneName);
+			system->function(scene);
+		}
+		system->durationNs = Profiler::Now() - start;
+	}
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include <entt/entt.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Akkad {
+
+	class Scene;
+	class JobSystem;
+	class JobCounter;
+
+	// phases run in this order, every system of a phase finishes before the next phase starts.
+	enum class SystemPhase {
+		PreUpdate,
+		Physics,
+		Update,
+		PostUpdate,
+		RenderPrep,
+		Count
+	};
+
+	// the components a system reads and writes. systems of a phase run in parallel unless one of them writes
+	// a component the other one touches. exclusive systems run alone, on the thread updating the scene,
+	// which is needed for anything that creates or destroys entities or calls into script code.
+	class SystemAccess
+	{
+	public:
+		template<typename... Components>
+		SystemAccess& Read()
+		{
+			(m_Reads.push_back(entt::type_hash<Components>::value()), ...);
+			return *this;
+		}
+
+		template<typename... Components>
+		SystemAccess& Write()
+		{
+			(m_Writes.push_back(entt::type_hash<Components>::value()), ...);
+			return *this;
+		}
+
+		SystemAccess& Exclusive()
+		{
+			m_Exclusive = true;
+			return *this;
+		}
+
+		bool IsExclusive() const { return m_Exclusive; }
+		bool ConflictsWith(const SystemAccess& other) const;
+
+	private:
+		std::vector<entt::id_type> m_Reads;
+		std::vector<entt::id_type> m_Writes;
+		bool m_Exclusive = false;
+	};
+
+	// runs the systems of a scene on the job system. a system that conflicts with an earlier system of its
+	// phase waits for it, the others start as soon as their dependencies are done.
+	class SystemScheduler
+	{
+	public:
+		using SystemFunction = std::function<void(Scene& scene)>;
+
+		struct SystemTiming
+		{
+			std::string name;
+			SystemPhase phase;
+			// time of the last run.
+			uint64_t durationNs;
+		};
+
+		// systems of a phase keep the order they were added in when they conflict.
+		void AddSystem(const std::string& name, SystemPhase phase, const SystemAccess& access, SystemFunction function);
+		bool RemoveSystem(const std::string& name);
+		bool HasSystem(const std::string& name);
+
+		void Run(Scene& scene);
+
+		std::vector<SystemTiming> GetTimings();
+		static const char* GetPhaseName(SystemPhase phase);
+
+	private:
+		struct System
+		{
+			std::string name;
+			// the name of the system's profiler zone.
+			const char* zoneName;
+			SystemPhase phase;
+			SystemAccess access;
+			SystemFunction function;
+			uint64_t durationNs = 0;
+
+			// systems of the same phase that wait for this one.
+			std::vector<System*> dependents;
+			unsigned int dependencyCount = 0;
+			std::atomic<unsigned int> pendingDependencies{ 0 };
+		};
+
+		void BuildGraph();
+		void RunPhase(Scene& scene, std::vector<System*>& systems);
+		void LaunchSystem(Scene& scene, System* system, JobSystem* jobSystem, JobCounter& counter);
+		void RunAndRelease(Scene& scene, System* system, JobSystem* jobSystem, JobCounter& counter);
+		void RunSystem(Scene& scene, System* system);
+
+		std::vector<std::unique_ptr<System>> m_Systems;
+		std::vector<System*> m_Phases[(int)SystemPhase::Count];
+		bool m_GraphDirty = true;
+
+		// exclusive systems that are ready, run by the thread of Run().
+		std::vector<System*> m_ReadyExclusiveSystems;
+		std::mutex m_ReadyMutex;
+	};
+}
@@ -4,6 +4,11 @@ namespace Akkad {
 	namespace GUI {
 		void GUICheckBox::SetBoxUIRect(GUIRect rect)
 		{
+			if (rect != m_BoxUIRect)
+			{
+				m_Version++;
+			}
+
 			m_BoxUIRect = rect;
 
 			m_MarkUIRect.SetParent(m_BoxUIRect.GetRect());
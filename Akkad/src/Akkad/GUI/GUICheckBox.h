@@ -8,16 +8,18 @@ namespace Akkad {
 		{
 		public:
 			void SetBoxUIRect(GUIRect rect);
-			void SetBoxColor(glm::vec3 color) { m_BoxColor = color; }
-			void SetMarkColor(glm::vec3 color) { m_MarkColor = color; }
+			void SetBoxColor(glm::vec3 color) { if (color != m_BoxColor) { m_BoxColor = color; m_Version++; } }
+			void SetMarkColor(glm::vec3 color) { if (color != m_MarkColor) { m_MarkColor = color; m_Version++; } }
 
 			bool IsChecked() { return m_IsChecked; };
-			void SetCheckStatus(bool check) { m_IsChecked = check; }
+			void SetCheckStatus(bool check) { if (check != m_IsChecked) { m_IsChecked = check; m_Version++; } }
 
 			glm::vec3 GetBoxColor() { return m_BoxColor; }
 			glm::vec3 GetMarkColor() { return m_MarkColor; }
 			GUIRect GetBoxUIRect() { return m_BoxUIRect; }
 			GUIRect GetMarkUIRect() { return m_MarkUIRect; }
+			// incremented whenever something that is drawn changes.
+			unsigned int GetVersion() { return m_Version; }
 		private:
 			GUIRect m_BoxUIRect;
 			GUIRect m_MarkUIRect;
@@ -25,6 +27,7 @@ namespace Akkad {
 			glm::vec3 m_BoxColor = { 1 ,1, 1 };
 			glm::vec3 m_MarkColor = { 0,0,0 };
 			bool m_IsChecked = false;
+			unsigned int m_Version = 0;
 		};
 	}
 }
\ No newline at end of file
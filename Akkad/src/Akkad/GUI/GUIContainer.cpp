@@ -9,6 +9,31 @@ namespace Akkad {
 			m_Projection = glm::ortho(0.0f, size.x, size.y, 0.0f);
 			m_ScreenSize = size;
 		}
+
+		bool GUIContainer::HitTest(glm::vec2 point, uint32_t& id)
+		{
+			// the last rect drawn is on top.
+			for (auto it = m_HitRects.rbegin(); it != m_HitRects.rend(); it++)
+			{
+				glm::vec2 min = it->rect.GetMin();
+				glm::vec2 max = it->rect.GetMax();
+
+				if (point.x >= min.x && point.y >= min.y && point.x <= max.x && point.y <= max.y)
+				{
+					id = it->id;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		void GUIContainer::ClearDrawLists()
+		{
+			m_DrawList.Clear();
+			m_PickingDrawList.Clear();
+			m_HitRects.clear();
+		}
 	}
 }
 
@@ -1,6 +1,10 @@
 #pragma once
+#include "GUIDrawList.h"
 
 #include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
 namespace Akkad {
 
 	namespace GUI {
@@ -11,11 +15,36 @@ namespace Akkad {
 			void SetScreenSize(glm::vec2 size);
 			glm::mat4 GetProjection() { return m_Projection; }
 			glm::vec2 GetScreenSize() { return m_ScreenSize; }
+
+			// cached geometry of the container's children, see Scene::RenderGUI.
+			GUIDrawList& GetDrawList() { return m_DrawList; }
+			GUIDrawList& GetPickingDrawList() { return m_PickingDrawList; }
+
+			// the draw lists are rebuilt when the signature of the widgets they were built from changes.
+			bool IsDrawListValid(uint64_t signature) { return m_HasDrawList && m_DrawListSignature == signature; }
+			void SetDrawListSignature(uint64_t signature) { m_DrawListSignature = signature; m_HasDrawList = true; }
+
+			// interactive rects in draw order, rebuilt with the draw lists.
+			void AddHitRect(uint32_t id, Graphics::Rect rect) { m_HitRects.push_back({ id, rect }); }
+			// finds the top most rect under a point in screen pixels.
+			bool HitTest(glm::vec2 point, uint32_t& id);
+			void ClearDrawLists();
 		private:
-			glm::mat4 m_Projection;
-			glm::vec2 m_ScreenSize;
+			glm::mat4 m_Projection = glm::mat4(1.0f);
+			glm::vec2 m_ScreenSize = { 0,0 };
+
+			GUIDrawList m_DrawList;
+			GUIDrawList m_PickingDrawList;
+			uint64_t m_DrawListSignature = 0;
+
+			struct HitRect
+			{
+				uint32_t id;
+				Graphics::Rect rect;
+			};
+			std::vector<HitRect> m_HitRects;
+			bool m_HasDrawList = false;
 		};
 	}
 }
 
-
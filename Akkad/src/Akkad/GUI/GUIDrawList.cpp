@@ -0,0 +1,94 @@
+#include "GUIDrawList.h"
+#include "GUIText.h"
+
+#include "Akkad/Graphics/Texture.h"
+
+namespace Akkad {
+	namespace GUI {
+
+		uint32_t GUIDrawList::PackColor(glm::vec3 color)
+		{
+			glm::uvec3 bytes = glm::uvec3(glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f);
+			return bytes.r | (bytes.g << 8) | (bytes.b << 16) | (0xFFu << 24);
+		}
+
+		void GUIDrawList::AddRect(Graphics::Rect rect, uint32_t color)
+		{
+			GetCommand(nullptr).quadCount++;
+			AddQuad(rect.GetMin(), rect.GetMax(), { -1.0f, -1.0f }, { -1.0f, -1.0f }, color);
+		}
+
+		void GUIDrawList::AddRectOutline(Graphics::Rect rect, glm::vec3 color)
+		{
+			uint32_t packedColor = PackColor(color);
+			glm::vec2 min = rect.GetMin();
+			glm::vec2 max = rect.GetMax();
+
+			auto& command = GetCommand(nullptr);
+			command.quadCount += 4;
+
+			AddQuad({ min.x, min.y }, { max.x, min.y + 1.0f }, { -1.0f, -1.0f }, { -1.0f, -1.0f }, packedColor); // top
+			AddQuad({ min.x, max.y - 1.0f }, { max.x, max.y }, { -1.0f, -1.0f }, { -1.0f, -1.0f }, packedColor); // bottom
+			AddQuad({ min.x, min.y }, { min.x + 1.0f, max.y }, { -1.0f, -1.0f }, { -1.0f, -1.0f }, packedColor); // left
+			AddQuad({ max.x - 1.0f, min.y }, { max.x, max.y }, { -1.0f, -1.0f }, { -1.0f, -1.0f }, packedColor); // right
+		}
+
+		void GUIDrawList::AddText(GUIText& text)
+		{
+			if (!text.IsValid() || text.GetGlyphCount() == 0)
+			{
+				return;
+			}
+
+			auto& command = GetCommand(text.GetFont()->GetTextureAtlas());
+			command.quadCount += text.GetGlyphCount();
+
+			uint32_t color = PackColor(text.GetColor());
+			for (auto& glyphVertex : text.GetGlyphVertices())
+			{
+				m_Vertices.push_back({ glm::vec2(glyphVertex.position), glyphVertex.textureCoords, color });
+			}
+		}
+
+		void GUIDrawList::Clear()
+		{
+			m_Vertices.clear();
+			m_Commands.clear();
+		}
+
+		void GUIDrawList::AddQuad(glm::vec2 min, glm::vec2 max, glm::vec2 minTextureCoords, glm::vec2 maxTextureCoords, uint32_t color)
+		{
+			// same winding as the glyph quads : top right, bottom right, bottom left, top left.
+			m_Vertices.push_back({ { max.x, min.y }, { maxTextureCoords.x, minTextureCoords.y }, color });
+			m_Vertices.push_back({ { max.x, max.y }, { maxTextureCoords.x, maxTextureCoords.y }, color });
+			m_Vertices.push_back({ { min.x, max.y }, { minTextureCoords.x, maxTextureCoords.y }, color });
+			m_Vertices.push_back({ { min.x, min.y }, { minTextureCoords.x, minTextureCoords.y }, color });
+		}
+
+		GUIDrawList::DrawCommand& GUIDrawList::GetCommand(const SharedPtr<Graphics::Texture>& texture)
+		{
+			// solid quads do not sample, they join whatever command is open.
+			if (!m_Commands.empty())
+			{
+				auto& last = m_Commands.back();
+
+				if (texture == nullptr || last.texture == nullptr || last.texture == texture)
+				{
+					if (last.texture == nullptr)
+					{
+						last.texture = texture;
+					}
+					return last;
+				}
+			}
+
+			DrawCommand command;
+			command.texture = texture;
+			command.firstQuad = GetQuadCount();
+			command.quadCount = 0;
+			m_Commands.push_back(command);
+
+			return m_Commands.back();
+		}
+	}
+}
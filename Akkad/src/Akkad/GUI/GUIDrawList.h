@@ -0,0 +1,61 @@
+#pragma once
+#include "Akkad/core.h"
+#include "Akkad/Graphics/Rect.h"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace Akkad {
+
+	namespace Graphics {
+		class Texture;
+	}
+
+	namespace GUI {
+
+		class GUIText;
+
+		// flattened geometry of a GUI hierarchy, rebuilt only when a widget changes and replayed every frame.
+		// every element is a quad with its color in the vertices, solid quads have negative texture coords
+		// so they can share a draw with the glyphs of any font. a new command starts when the texture changes.
+		class GUIDrawList
+		{
+		public:
+			// matches the layout of Renderer2D's GUI vertex buffer and r2d_guiShader.
+			struct Vertex {
+				glm::vec2 position;
+				glm::vec2 textureCoords;
+				uint32_t color; // RGBA8
+			};
+
+			struct DrawCommand {
+				SharedPtr<Graphics::Texture> texture;
+				unsigned int firstQuad;
+				unsigned int quadCount;
+			};
+
+			static uint32_t PackColor(glm::vec3 color);
+
+			void AddRect(Graphics::Rect rect, uint32_t color);
+			void AddRect(Graphics::Rect rect, glm::vec3 color) { AddRect(rect, PackColor(color)); }
+			// 1 pixel border, replaces the line polygon mode rects of the debug view.
+			void AddRectOutline(Graphics::Rect rect, glm::vec3 color);
+			void AddText(GUIText& text);
+
+			void Clear();
+
+			const std::vector<Vertex>& GetVertices() { return m_Vertices; }
+			const std::vector<DrawCommand>& GetCommands() { return m_Commands; }
+			unsigned int GetQuadCount() { return (unsigned int)m_Vertices.size() / 4; }
+
+		private:
+			void AddQuad(glm::vec2 min, glm::vec2 max, glm::vec2 minTextureCoords, glm::vec2 maxTextureCoords, uint32_t color);
+			DrawCommand& GetCommand(const SharedPtr<Graphics::Texture>& texture);
+
+			std::vector<Vertex> m_Vertices;
+			std::vector<DrawCommand> m_Commands;
+		};
+	}
+}
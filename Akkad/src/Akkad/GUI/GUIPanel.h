@@ -7,17 +7,20 @@ namespace Akkad {
 		class GUIPanel
 		{
 		public:
-			void SetUIRect(GUIRect rect) { m_UIRect = rect; }
-			void SetColor(glm::vec3 color) { m_Color = color; }
+			void SetUIRect(GUIRect rect) { if (rect != m_UIRect) { m_UIRect = rect; m_Version++; } }
+			void SetColor(glm::vec3 color) { if (color != m_Color) { m_Color = color; m_Version++; } }
 
 			glm::vec3 GetColor() { return m_Color; }
 			GUIRect GetUIRect() { return m_UIRect; }
-			void SetTransparent(bool transparent) { m_IsTransparent = transparent; };
+			void SetTransparent(bool transparent) { if (transparent != m_IsTransparent) { m_IsTransparent = transparent; m_Version++; } };
 			bool IsTransparent() { return m_IsTransparent; };
+			// incremented whenever something that is drawn changes.
+			unsigned int GetVersion() { return m_Version; }
 		private:
 			GUIRect m_UIRect;
 			glm::vec3 m_Color = { 1 ,1, 1 };
 			bool m_IsTransparent = false;
+			unsigned int m_Version = 0;
 		};
 	}
 }
@@ -23,6 +23,7 @@ namespace Akkad {
 			if (m_ParentRect != parent)
 			{
 				m_ParentRect = parent;
+				m_IsDirty = true;
 			}
 		}
 
@@ -31,6 +32,7 @@ namespace Akkad {
 			if (m_PreviousChild != child)
 			{
 				m_PreviousChild = child;
+				m_IsDirty = true;
 			}
 		}
 
@@ -284,24 +286,28 @@ namespace Akkad {
 		void GUIRect::SetWidthConstraint(Constraint constraint)
 		{
 			m_widthConstraint = constraint;
+			m_IsDirty = true;
 			RecalculateRect();
 		}
 
 		void GUIRect::SetHeightConstraint(Constraint constraint)
 		{
 			m_heightConstraint = constraint;
+			m_IsDirty = true;
 			RecalculateRect();
 		}
 
 		void GUIRect::SetXConstraint(Constraint constraint)
 		{
 			m_xConstraint = constraint;
+			m_IsDirty = true;
 			RecalculateRect();
 		}
 
 		void GUIRect::SetYConstraint(Constraint constraint)
 		{
 			m_yConstraint = constraint;
+			m_IsDirty = true;
 			RecalculateRect();
 		}
 
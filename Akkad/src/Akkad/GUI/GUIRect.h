@@ -46,12 +46,16 @@ namespace Akkad {
 			Constraint GetYConstraint() { return m_yConstraint; }
 
 			AnchorType GetAnchorType() { return m_AnchorType; };
-			void SetAnchorType(AnchorType type) { m_AnchorType = type; };
+			void SetAnchorType(AnchorType type) { if (type != m_AnchorType) { m_AnchorType = type; m_IsDirty = true; } };
 
 
 
-			Graphics::Rect GetRect() { return m_Rect; }
-			Graphics::Rect GetParentRect() { return m_ParentRect; }
+			Graphics::Rect GetRect() const { return m_Rect; }
+			Graphics::Rect GetParentRect() const { return m_ParentRect; }
+
+			// set when the constraints, the anchor, the parent or the previous child change,
+			// the scene's layout pass recomputes dirty rects and the subtrees under them.
+			bool IsDirty() { return m_IsDirty; }
 
 			bool operator!=(GUIRect& other)
 			{
@@ -80,6 +84,9 @@ namespace Akkad {
 			Graphics::Rect m_ParentRect;
 			Graphics::Rect m_PreviousChild;
 
+			bool m_IsDirty = true;
+			bool m_HasDirtyChildren = false;
+
 			friend class ::Akkad::Scene;
 		};
 	}
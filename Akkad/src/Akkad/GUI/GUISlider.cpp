@@ -4,6 +4,12 @@ namespace Akkad {
 	namespace GUI {
 		void GUISlider::SetSliderRect(GUIRect rect)
 		{
+			Graphics::Rect previousKnobRect = m_KnobRect.GetRect();
+			if (rect != m_SliderRect)
+			{
+				m_Version++;
+			}
+
 			m_SliderRect = rect;
 			m_KnobRect.SetParent(m_SliderRect.GetRect());
 
@@ -14,7 +20,11 @@ namespace Akkad {
 			m_KnobRect.SetYConstraint({ ConstraintType::CENTER_CONSTRAINT, 0 });
 
 			m_SliderValue = (m_KnobRect.GetRect().GetPosition().x - m_SliderRect.GetRect().GetMin().x) / m_SliderRect.GetRect().GetWidth();
-			
+
+			if (m_KnobRect.GetRect() != previousKnobRect)
+			{
+				m_Version++;
+			}
 		}
 
 		void GUISlider::SetKnobX(float x)
@@ -12,18 +12,21 @@ namespace Akkad {
 			glm::vec3 GetSliderColor() { return m_SliderColor; }
 			glm::vec3 GetKnobColor() { return m_KnobColor; }
 
-			void SetSliderColor(glm::vec3 color) { m_SliderColor = color; }
-			void SetKnobColor(glm::vec3 color) { m_KnobColor = color; }
+			void SetSliderColor(glm::vec3 color) { if (color != m_SliderColor) { m_SliderColor = color; m_Version++; } }
+			void SetKnobColor(glm::vec3 color) { if (color != m_KnobColor) { m_KnobColor = color; m_Version++; } }
 			void SetSliderRect(GUIRect rect);
 			void SetKnobX(float x);
 
 			float GetSliderValue() { return m_SliderValue; };
+			// incremented whenever something that is drawn changes.
+			unsigned int GetVersion() { return m_Version; }
 
 		private:
 			glm::vec3 m_SliderColor;
 			glm::vec3 m_KnobColor;
 			float m_SliderValue = 0.0f;
 			float m_KnobX = 0.0f;
+			unsigned int m_Version = 0;
 
 			GUIRect m_SliderRect;
 			GUIRect m_KnobRect;
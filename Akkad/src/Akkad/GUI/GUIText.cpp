@@ -11,6 +11,7 @@ namespace Akkad {
 		{
 			m_Font = CreateSharedPtr<Font>(filepath);
 			m_FontFilePath = filepath;
+			RecalculateTextPosition();
 		}
 
 		void GUIText::SetFontSize(unsigned int sizePixels)
@@ -73,6 +74,7 @@ namespace Akkad {
 			{
 				return;
 			}
+
 			m_Lines.clear();
 			TextLine firstLine;
 			firstLine.yOffset = GetPosition().y + (m_Font->GetFontSize() / 1.5);
@@ -92,6 +94,30 @@ namespace Akkad {
 			default:
 				break;
 			}
+
+			BuildGlyphVertices();
+			m_Version++;
+		}
+
+		void GUIText::BuildGlyphVertices()
+		{
+			m_GlyphVertices.clear();
+
+			for (auto& line : m_Lines)
+			{
+				for (auto& character : line.characters)
+				{
+					auto min = character.CharacterRect.GetMin();
+					auto max = character.CharacterRect.GetMax();
+					auto mintex = character.CharacterRect.GetMinTextureCoords();
+					auto maxtex = character.CharacterRect.GetMaxTextureCoords();
+
+					m_GlyphVertices.push_back({ { max.x, min.y, 0.0f }, { maxtex.x, mintex.y } }); // top right
+					m_GlyphVertices.push_back({ { max.x, max.y, 0.0f }, { maxtex.x, maxtex.y } }); // bottom right
+					m_GlyphVertices.push_back({ { min.x, max.y, 0.0f }, { mintex.x, maxtex.y } }); // bottom left
+					m_GlyphVertices.push_back({ { min.x, min.y, 0.0f }, { mintex.x, mintex.y } }); // top left
+				}
+			}
 		}
 
 		void GUIText::PositionTextScaleToFit()
@@ -22,6 +22,12 @@ namespace Akkad {
 				LEFT, CENTER
 			};
 
+			// matches the rect vertex layout of Renderer2D : position, texture coords.
+			struct GlyphVertex {
+				glm::vec3 position;
+				glm::vec2 textureCoords;
+			};
+
 			struct TextLine {
 				float yOffset;
 				std::vector<Font::FontCharacter> characters;
@@ -33,7 +39,7 @@ namespace Akkad {
 			void SetFont(std::string filepath);
 			void SetText(std::string text);
 			void SetBoundingBox(GUIRect boundingBox);
-			void SetColor(glm::vec3 color) { m_Color = color; };
+			void SetColor(glm::vec3 color) { if (color != m_Color) { m_Color = color; m_Version++; } };
 			void SetAlignment(Alignment alignment);
 			void SetFittingMode(FittingMode mode);
 			
@@ -43,9 +49,14 @@ namespace Akkad {
 			Graphics::Rect GetBoundingBox() { return m_BoundingBox.GetRect(); }
 			SharedPtr<Font> GetFont() { return m_Font; }
 			std::string GetText() { return m_Text; }
-			std::vector<TextLine> GetLines() { return m_Lines; }
+			const std::vector<TextLine>& GetLines() { return m_Lines; }
+			// 4 vertices per glyph, rebuilt when the text is positioned.
+			const std::vector<GlyphVertex>& GetGlyphVertices() { return m_GlyphVertices; }
+			unsigned int GetGlyphCount() { return (unsigned int)m_GlyphVertices.size() / 4; }
 			glm::vec3 GetColor() { return m_Color; }
 			glm::vec2 GetPosition();
+			// incremented whenever the glyphs or their color change.
+			unsigned int GetVersion() { return m_Version; }
 
 			bool IsValid();
 
@@ -56,6 +67,7 @@ namespace Akkad {
 			void PositionTextScaleToFit();
 			void PositionTextKeepFtSize();
 			void SetFontSize(unsigned int sizePixels);
+			void BuildGlyphVertices();
 
 			FittingMode m_FittingMode = FittingMode::KEEP_FONT_SIZE;
 			Alignment m_Alignment = Alignment::LEFT;
@@ -64,9 +76,11 @@ namespace Akkad {
 			std::string m_Text;
 			std::string m_FontFilePath;
 			std::vector<TextLine> m_Lines;
+			std::vector<GlyphVertex> m_GlyphVertices;
 			GUIRect m_BoundingBox;
 			
 			glm::vec3 m_Color = { 1.0f, 1.0f, 1.0f };
+			unsigned int m_Version = 0;
 
 			friend class ::Akkad::Scene;
 			friend class GUITextInput;
@@ -8,7 +8,11 @@ namespace Akkad {
 
 		void GUITextInput::SetTextInputColor(glm::vec3 color)
 		{
-			m_TextInputColor = color;
+			if (color != m_TextInputColor)
+			{
+				m_TextInputColor = color;
+				m_Version++;
+			}
 		}
 
 		void GUITextInput::SetTextColor(glm::vec3 color)
@@ -20,6 +24,7 @@ namespace Akkad {
 		void GUITextInput::SetTextInputRect(GUIRect rect)
 		{
 			m_TextInputRect = rect;
+			m_Version++;
 			if (m_uitext.GetFittingMode() != GUIText::FittingMode::SCALE_TO_FIT)
 			{
 				m_uitext.SetFittingMode(GUIText::FittingMode::SCALE_TO_FIT);
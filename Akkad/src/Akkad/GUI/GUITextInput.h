@@ -31,6 +31,8 @@ namespace Akkad {
 			glm::vec3 GetTextInputColor() { return m_TextInputColor; }
 			glm::vec3 GetTextColor() { return m_TextColor; }
 			GUIRect GetTextInputRect();
+			// incremented whenever something that is drawn changes, the text has its own version.
+			unsigned int GetVersion() { return m_Version; }
 			std::string GetText() { return m_TextValue; }
 		private:
 			glm::vec3 m_TextInputColor = { 1,1,1 };
@@ -39,6 +41,7 @@ namespace Akkad {
 			GUIText m_uitext;
 			unsigned int m_Flags;
 			std::string m_TextValue;
+			unsigned int m_Version = 0;
 
 		};
 	}
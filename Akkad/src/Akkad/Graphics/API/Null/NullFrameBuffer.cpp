@@ -0,0 +1,94 @@
+#include "NullFrameBuffer.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+#include <algorithm>
+
+namespace Akkad {
+	namespace Graphics {
+
+		NullFrameBuffer::NullFrameBuffer(FrameBufferDescriptor desc)
+		{
+			m_desc = desc;
+			m_StorageWidth = FitStorageSize(desc.width, 0);
+			m_StorageHeight = FitStorageSize(desc.height, 0);
+		}
+
+		void NullFrameBuffer::Bind()
+		{
+			if (m_StorageDirty)
+			{
+				RenderStats::AddFramebufferResize();
+				m_StorageDirty = false;
+			}
+		}
+
+		void NullFrameBuffer::SetSize(unsigned int width, unsigned int height)
+		{
+			m_desc.width = width;
+			m_desc.height = height;
+
+			unsigned int storageWidth = FitStorageSize(width, m_StorageWidth);
+			unsigned int storageHeight = FitStorageSize(height, m_StorageHeight);
+
+			if (storageWidth != m_StorageWidth || storageHeight != m_StorageHeight)
+			{
+				m_StorageWidth = storageWidth;
+				m_StorageHeight = storageHeight;
+				m_StorageDirty = true;
+			}
+		}
+
+		glm::ivec2 NullFrameBuffer::GetStorageSize()
+		{
+			return { m_StorageWidth, m_StorageHeight };
+		}
+
+		unsigned int NullFrameBuffer::RequestPixels(int x, int y, int width, int height)
+		{
+			std::lock_guard<std::mutex> lock(m_ReadbackMutex);
+
+			PixelReadback readback;
+			readback.id = m_NextReadbackID++;
+			readback.x = x;
+			readback.y = y;
+			readback.width = width;
+			readback.height = height;
+			m_QueuedReadbacks.push_back(readback);
+
+			return readback.id;
+		}
+
+		bool NullFrameBuffer::GetRequestedPixels(unsigned int requestID, std::vector<float>& pixels)
+		{
+			std::lock_guard<std::mutex> lock(m_ReadbackMutex);
+
+			auto it = m_CompletedReadbacks.find(requestID);
+			if (it == m_CompletedReadbacks.end())
+			{
+				return false;
+			}
+
+			pixels = std::move(it->second);
+			m_CompletedReadbacks.erase(it);
+			return true;
+		}
+
+		void NullFrameBuffer::UpdateReadbacks()
+		{
+			std::lock_guard<std::mutex> lock(m_ReadbackMutex);
+
+			for (auto& readback : m_QueuedReadbacks)
+			{
+				// same clipping as the GL buffers, only the pixels inside of the buffer are returned.
+				int x0 = std::max(readback.x, 0);
+				int y0 = std::max(readback.y, 0);
+				int x1 = std::min(readback.x + readback.width, m_desc.width);
+				int y1 = std::min(readback.y + readback.height, m_desc.height);
+
+				auto& pixels = m_CompletedReadbacks[readback.id];
+				pixels.assign(std::max(x1 - x0, 0) * std::max(y1 - y0, 0), 0.0f);
+			}
+			m_QueuedReadbacks.clear();
+		}
+	}
+}
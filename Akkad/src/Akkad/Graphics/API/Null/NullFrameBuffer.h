@@ -0,0 +1,47 @@
+#pragma once
+#include "Akkad/Graphics/FrameBuffer.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Akkad {
+	namespace Graphics {
+
+		// nothing is drawn into it, reads complete on the next UpdateReadbacks() with zeroed pixels.
+		class NullFrameBuffer : public FrameBuffer
+		{
+		public:
+			NullFrameBuffer(FrameBufferDescriptor desc);
+
+			virtual void Bind() override;
+			virtual void Unbind() override {}
+			virtual void SetSize(unsigned int width, unsigned int height) override;
+			virtual glm::ivec2 GetStorageSize() override;
+
+			virtual unsigned int GetColorAttachmentTexture() override { return 0; }
+			virtual glm::vec4 ReadPixels(int x, int y) override { return glm::vec4(0.0f); }
+
+			virtual unsigned int RequestPixels(int x, int y, int width = 1, int height = 1) override;
+			virtual bool GetRequestedPixels(unsigned int requestID, std::vector<float>& pixels) override;
+			virtual void UpdateReadbacks() override;
+
+			virtual FrameBufferDescriptor& GetDescriptor() override { return m_desc; }
+
+		private:
+			struct PixelReadback {
+				unsigned int id;
+				int x, y, width, height;
+			};
+
+			FrameBufferDescriptor m_desc;
+			unsigned int m_StorageWidth, m_StorageHeight;
+			bool m_StorageDirty = false;
+
+			std::mutex m_ReadbackMutex;
+			unsigned int m_NextReadbackID = 1;
+			std::vector<PixelReadback> m_QueuedReadbacks;
+			std::unordered_map<unsigned int, std::vector<float>> m_CompletedReadbacks;
+		};
+	}
+}
@@ -0,0 +1,20 @@
+#include "NullIndexBuffer.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+#include <cstring>
+
+namespace Akkad {
+	namespace Graphics {
+
+		void NullIndexBuffer::SetData(const void* data, unsigned int size)
+		{
+			m_Data.resize(size);
+			if (data != nullptr)
+			{
+				memcpy(m_Data.data(), data, size);
+			}
+
+			RenderStats::AddBufferUpload(size);
+		}
+	}
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "Akkad/Graphics/Buffer.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		class NullIndexBuffer : public IndexBuffer
+		{
+		public:
+			virtual void Bind() override {}
+			virtual void Unbind() override {}
+			virtual void SetData(const void* data, unsigned int size) override;
+
+			const std::vector<unsigned char>& GetData() { return m_Data; }
+
+		private:
+			std::vector<unsigned char> m_Data;
+		};
+	}
+}
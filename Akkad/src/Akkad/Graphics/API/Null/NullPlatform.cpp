@@ -0,0 +1,81 @@
+#include "NullPlatform.h"
+#include "NullRenderContext.h"
+#include "NullRenderCommand.h"
+#include "NullIndexBuffer.h"
+#include "NullVertexBuffer.h"
+#include "NullShader.h"
+#include "NullTexture.h"
+#include "NullFrameBuffer.h"
+#include "NullUniformBuffer.h"
+#include "NullStreamingBuffer.h"
+
+namespace Akkad {
+	namespace Graphics {
+		NullPlatform::~NullPlatform()
+		{
+			delete m_Command;
+		}
+
+		void NullPlatform::Init()
+		{
+			m_RenderContext = CreateSharedPtr<NullRenderContext>();
+			m_RenderContext->Init(RenderAPI::NONE);
+
+			m_Command = new NullRenderCommand();
+		}
+
+		void NullPlatform::OnWindowResize(unsigned int width, unsigned int height)
+		{
+		}
+
+		SharedPtr<VertexBuffer> NullPlatform::CreateVertexBuffer()
+		{
+			return CreateSharedPtr<NullVertexBuffer>();
+		}
+
+		SharedPtr<IndexBuffer> NullPlatform::CreateIndexBuffer()
+		{
+			return CreateSharedPtr<NullIndexBuffer>();
+		}
+
+		SharedPtr<Shader> NullPlatform::CreateShader(const char* path)
+		{
+			return CreateSharedPtr<NullShader>(path);
+		}
+
+		SharedPtr<Texture> NullPlatform::CreateTexture(const char* path)
+		{
+			return CreateSharedPtr<NullTexture>(path);
+		}
+
+		SharedPtr<Texture> NullPlatform::CreateTexture(TextureDescriptor desc)
+		{
+			return CreateSharedPtr<NullTexture>(desc);
+		}
+
+		SharedPtr<Texture> NullPlatform::CreateTexture(const char* path, float tileWidth, float tileHeight)
+		{
+			return CreateSharedPtr<NullTexture>(path, tileWidth, tileHeight);
+		}
+
+		SharedPtr<FrameBuffer> NullPlatform::CreateFrameBuffer(FrameBufferDescriptor desc)
+		{
+			return CreateSharedPtr<NullFrameBuffer>(desc);
+		}
+
+		SharedPtr<RenderContext> NullPlatform::GetRenderContext()
+		{
+			return m_RenderContext;
+		}
+
+		SharedPtr<UniformBuffer> NullPlatform::CreateUniformBuffer(UniformBufferLayout layout)
+		{
+			return CreateSharedPtr<NullUniformBuffer>(layout);
+		}
+
+		SharedPtr<StreamingBuffer> NullPlatform::CreateStreamingBuffer(unsigned int size)
+		{
+			return CreateSharedPtr<NullStreamingBuffer>(size);
+		}
+	}
+}
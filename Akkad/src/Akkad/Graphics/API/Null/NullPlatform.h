@@ -0,0 +1,35 @@
+#pragma once
+#include "Akkad/Graphics/RenderPlatform.h"
+namespace Akkad {
+	namespace Graphics {
+
+		// headless platform, no window and no GPU. resources are CPU side stubs that keep what was submitted,
+		// so scenes can be loaded, simulated and rendered by the CPU side of the renderer on a machine without a display.
+		class NullPlatform : public RenderPlatform
+		{
+		public:
+			~NullPlatform();
+
+			virtual RenderAPI GetRenderAPI() override { return RenderAPI::NONE; }
+			virtual RenderCommand* GetRenderCommand() override { return m_Command; }
+
+			virtual void Init() override;
+			virtual void OnWindowResize(unsigned int width, unsigned int height) override;
+
+			virtual SharedPtr<VertexBuffer> CreateVertexBuffer() override;
+			virtual SharedPtr<IndexBuffer> CreateIndexBuffer() override;
+			virtual SharedPtr<Shader> CreateShader(const char* path) override;
+			virtual SharedPtr<Texture> CreateTexture(const char* path) override;
+			virtual SharedPtr<Texture> CreateTexture(TextureDescriptor desc) override;
+			virtual SharedPtr<Texture> CreateTexture(const char* path, float tileWidth, float tileHeight) override;
+			virtual SharedPtr<FrameBuffer> CreateFrameBuffer(FrameBufferDescriptor desc) override;
+			virtual SharedPtr<RenderContext> GetRenderContext() override;
+			virtual SharedPtr<UniformBuffer> CreateUniformBuffer(UniformBufferLayout layout) override;
+			virtual SharedPtr<StreamingBuffer> CreateStreamingBuffer(unsigned int size) override;
+
+		private:
+			SharedPtr<RenderContext> m_RenderContext;
+			RenderCommand* m_Command = nullptr;
+		};
+	}
+}
@@ -0,0 +1,63 @@
+#include "NullRenderCommand.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		void NullRenderCommand::Clear()
+		{
+		}
+
+		void NullRenderCommand::SetClearColor(float r, float g, float b)
+		{
+		}
+
+		void NullRenderCommand::DrawArrays(PrimitiveType type, unsigned int count)
+		{
+			m_DrawCalls.push_back({ type, count, 0, false });
+			RenderStats::AddDraw(count);
+		}
+
+		void NullRenderCommand::DrawIndexed(PrimitiveType type, unsigned int count)
+		{
+			m_DrawCalls.push_back({ type, count, 0, true });
+			RenderStats::AddDraw(count);
+		}
+
+		void NullRenderCommand::SetPolygonMode(PolygonMode mode)
+		{
+			m_Stats.issuedCalls++;
+		}
+
+		void NullRenderCommand::EnableBlending()
+		{
+			m_Stats.issuedCalls++;
+		}
+
+		void NullRenderCommand::DisableBlending()
+		{
+			m_Stats.issuedCalls++;
+		}
+
+		void NullRenderCommand::SetBlendState(BlendSourceFactor sfactor, BlendDestFactor dfactor)
+		{
+			m_Stats.issuedCalls++;
+		}
+
+		void NullRenderCommand::DrawElementsInstanced(PrimitiveType type, unsigned int count, unsigned int amount)
+		{
+			m_DrawCalls.push_back({ type, count, amount, true });
+			RenderStats::AddInstancedDraw(count, amount);
+		}
+
+		void NullRenderCommand::EndFrame()
+		{
+			// swapping keeps the capacity of both lists, a steady frame does not allocate.
+			m_LastFrameDrawCalls.swap(m_DrawCalls);
+			m_DrawCalls.clear();
+
+			m_LastFrameStats = m_Stats;
+			m_Stats = StateCacheStats();
+		}
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "Akkad/Graphics/RenderCommand.h"
+
+#include <vector>
+
+namespace Akkad {
+	namespace Graphics {
+
+		struct NullDrawCall {
+			PrimitiveType primitive;
+			unsigned int count;
+			unsigned int instanceCount; // 0 for a draw that is not instanced
+			bool indexed;
+		};
+
+		// records the draws of the frame instead of issuing them, every state call counts as issued.
+		class NullRenderCommand : public RenderCommand
+		{
+		public:
+			virtual void Clear() override;
+			virtual void SetClearColor(float r, float g, float b) override;
+			virtual void DrawArrays(PrimitiveType type, unsigned int count) override;
+			virtual void DrawIndexed(PrimitiveType type, unsigned int count) override;
+			virtual void SetPolygonMode(PolygonMode mode) override;
+			virtual void EnableBlending() override;
+			virtual void DisableBlending() override;
+			virtual void SetBlendState(BlendSourceFactor sfactor, BlendDestFactor dfactor) override;
+			virtual void DrawElementsInstanced(PrimitiveType type, unsigned int count, unsigned int amount) override;
+
+			virtual StateCacheStats GetStateCacheStats() override { return m_LastFrameStats; }
+			virtual void EndFrame() override;
+
+			// the draws of the last finished frame, in submission order.
+			const std::vector<NullDrawCall>& GetLastFrameDrawCalls() { return m_LastFrameDrawCalls; }
+
+		private:
+			std::vector<NullDrawCall> m_DrawCalls;
+			std::vector<NullDrawCall> m_LastFrameDrawCalls;
+
+			StateCacheStats m_Stats;
+			StateCacheStats m_LastFrameStats;
+		};
+	}
+}
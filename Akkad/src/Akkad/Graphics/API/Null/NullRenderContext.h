@@ -0,0 +1,18 @@
+#pragma once
+#include "Akkad/Graphics/RenderContext.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		// there is no context to make current, the render thread can run the null platform as is.
+		class NullRenderContext : public RenderContext
+		{
+		public:
+			virtual void Init(RenderAPI api) override {}
+			virtual void SwapWindowBuffers() override {}
+			virtual void SetVsync(bool status) override {}
+
+			virtual bool SupportsThreadedRendering() override { return true; }
+		};
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include "Akkad/Graphics/Shader.h"
+
+#include <algorithm>
+namespace Akkad {
+	namespace Graphics {
+
+		// nothing is compiled, only the path and the uniform buffers attached to it are kept.
+		class NullShader : public Shader
+		{
+		public:
+			NullShader(const char* path) : m_Path(path) {}
+
+			virtual void Bind() override {}
+			virtual void Unbind() override {}
+			virtual void SetMat4(const char* location, glm::mat4& value) override {}
+			virtual void SetVec3(const char* location, glm::vec3& value) override {}
+
+			virtual void SetUniformBuffer(SharedPtr<UniformBuffer> buffer) override
+			{
+				if (std::find(m_UniformBuffers.begin(), m_UniformBuffers.end(), buffer) == m_UniformBuffers.end())
+				{
+					m_UniformBuffers.push_back(buffer);
+				}
+			}
+
+			const std::string& GetPath() { return m_Path; }
+
+		private:
+			std::string m_Path;
+			std::vector<SharedPtr<UniformBuffer>> m_UniformBuffers;
+		};
+	}
+}
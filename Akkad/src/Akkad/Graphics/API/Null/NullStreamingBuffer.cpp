@@ -0,0 +1,57 @@
+#include "NullStreamingBuffer.h"
+#include "Akkad/Logging.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+#include <cstring>
+
+namespace Akkad {
+	namespace Graphics {
+
+		NullStreamingBuffer::NullStreamingBuffer(unsigned int size)
+		{
+			m_SegmentSize = size / SEGMENT_COUNT;
+			m_SegmentSize -= m_SegmentSize % ALLOCATION_ALIGNMENT;
+			m_Size = m_SegmentSize * SEGMENT_COUNT;
+
+			m_Data.resize(m_Size);
+		}
+
+		unsigned int NullStreamingBuffer::Push(const void* data, unsigned int size)
+		{
+			if (size > m_SegmentSize)
+			{
+				AK_ERROR("Streaming buffer push of {} bytes is bigger than a segment ({} bytes) !", size, m_SegmentSize);
+				return INVALID_OFFSET;
+			}
+
+			unsigned int alignedOffset = (m_SegmentOffset + ALLOCATION_ALIGNMENT - 1) & ~(ALLOCATION_ALIGNMENT - 1);
+			if (alignedOffset + size > m_SegmentSize)
+			{
+				NextSegment();
+				alignedOffset = 0;
+			}
+
+			unsigned int offset = m_Segment * m_SegmentSize + alignedOffset;
+			m_SegmentOffset = alignedOffset + size;
+
+			memcpy(m_Data.data() + offset, data, size);
+			RenderStats::AddBufferUpload(size);
+
+			return offset;
+		}
+
+		void NullStreamingBuffer::EndFrame()
+		{
+			if (m_SegmentOffset > 0)
+			{
+				NextSegment();
+			}
+		}
+
+		void NullStreamingBuffer::NextSegment()
+		{
+			m_Segment = (m_Segment + 1) % SEGMENT_COUNT;
+			m_SegmentOffset = 0;
+		}
+	}
+}
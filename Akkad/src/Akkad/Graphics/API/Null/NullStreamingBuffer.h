@@ -0,0 +1,33 @@
+#pragma once
+#include "Akkad/Graphics/StreamingBuffer.h"
+
+#include <vector>
+
+namespace Akkad {
+	namespace Graphics {
+
+		// same ring and segments as the GL buffers, the storage is plain memory.
+		class NullStreamingBuffer : public StreamingBuffer
+		{
+		public:
+			NullStreamingBuffer(unsigned int size);
+
+			virtual unsigned int Push(const void* data, unsigned int size) override;
+			virtual void EndFrame() override;
+
+			virtual unsigned int GetID() override { return 0; }
+			virtual unsigned int GetSize() override { return m_Size; }
+
+			const std::vector<unsigned char>& GetData() { return m_Data; }
+
+		private:
+			void NextSegment();
+
+			std::vector<unsigned char> m_Data;
+			unsigned int m_Size;
+			unsigned int m_SegmentSize;
+			unsigned int m_Segment = 0;
+			unsigned int m_SegmentOffset = 0;
+		};
+	}
+}
@@ -0,0 +1,55 @@
+#include "NullTexture.h"
+#include "Akkad/Logging.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+#include <stb_image.h>
+
+namespace Akkad {
+	namespace Graphics {
+
+		// ids are only handed out so textures can be told apart, 0 stays the "no texture" id.
+		unsigned int NullTexture::s_LastID = 0;
+
+		NullTexture::NullTexture(const char* path)
+		{
+			m_ID = ++s_LastID;
+			ReadImageInfo(path);
+		}
+
+		NullTexture::NullTexture(TextureDescriptor desc)
+		{
+			m_ID = ++s_LastID;
+			m_desc = desc;
+			m_desc.Data = nullptr;
+		}
+
+		NullTexture::NullTexture(const char* path, float tileWidth, float tileHeight)
+		{
+			m_ID = ++s_LastID;
+			ReadImageInfo(path);
+			m_desc.IsTilemap = true;
+			m_desc.TileWidth = tileWidth;
+			m_desc.TileHeight = tileHeight;
+		}
+
+		void NullTexture::ReadImageInfo(const char* path)
+		{
+			m_desc.Type = TextureType::TEXTURE2D;
+			m_desc.Format = TextureFormat::RGB8;
+			m_desc.Data = nullptr;
+
+			if (!stbi_info(path, &m_desc.Width, &m_desc.Height, &m_desc.nChannels))
+			{
+				AK_WARNING("unable to read the image {}, the texture is 1x1", path);
+				m_desc.Width = 1;
+				m_desc.Height = 1;
+				m_desc.nChannels = 4;
+			}
+		}
+
+		void NullTexture::Bind(unsigned int unit)
+		{
+			RenderStats::AddTextureBind();
+		}
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "Akkad/Graphics/Texture.h"
+
+#include <string>
+
+namespace Akkad {
+	namespace Graphics {
+
+		// only the image header is read, the descriptor has the real size and channel count but no pixels.
+		class NullTexture : public Texture
+		{
+		public:
+			NullTexture(const char* path);
+			NullTexture(TextureDescriptor desc);
+			NullTexture(const char* path, float tileWidth, float tileHeight);
+
+			virtual void Bind(unsigned int unit) override;
+			virtual void Unbind() override {}
+			virtual unsigned int GetID() override { return m_ID; }
+			virtual void SetSubData(int x, int y, unsigned int width, unsigned int height, void* data) override {}
+			virtual TextureDescriptor GetDescriptor() override { return m_desc; };
+
+		private:
+			void ReadImageInfo(const char* path);
+
+			unsigned int m_ID;
+			TextureDescriptor m_desc;
+
+			static unsigned int s_LastID;
+		};
+	}
+}
@@ -0,0 +1,56 @@
+#include "NullUniformBuffer.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		NullUniformBuffer::NullUniformBuffer(UniformBufferLayout layout)
+		{
+			m_Layout = layout;
+			CookLayout();
+
+			m_BufferData.resize(m_Layout.m_BufferSize, '\0');
+		}
+
+		void NullUniformBuffer::UploadData(unsigned int offset, unsigned int size)
+		{
+			RenderStats::AddUniformUpload(size);
+		}
+
+		void NullUniformBuffer::CookLayout()
+		{
+			unsigned int lastOffset = 0;
+			unsigned int lastSize = 0;
+
+			for (auto& it : m_Layout.m_DataMap)
+			{
+				auto& element = it.second;
+				unsigned int alignment = GetBaseAlignmentSTD140(element.GetType());
+
+				element.offset = (lastOffset + lastSize + alignment - 1) / alignment * alignment;
+				element.memoryAlignment = alignment;
+				lastOffset = element.offset;
+				lastSize = GetSizeOfType(element.GetType());
+			}
+
+			m_Layout.m_BufferSize = lastOffset + lastSize;
+		}
+
+		unsigned int NullUniformBuffer::GetBaseAlignmentSTD140(ShaderDataType type)
+		{
+			unsigned int N = 4;
+			switch (type)
+			{
+			case ShaderDataType::FLOAT2:
+				return 2 * N;
+			case ShaderDataType::FLOAT3:
+			case ShaderDataType::FLOAT4:
+			case ShaderDataType::MAT3:
+			case ShaderDataType::MAT4:
+				return 4 * N;
+			default:
+				return N;
+			}
+		}
+	}
+}
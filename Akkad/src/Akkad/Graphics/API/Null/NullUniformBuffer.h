@@ -0,0 +1,29 @@
+#pragma once
+#include "Akkad/Graphics/UniformBuffer.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		// the layout is cooked like the GL buffers so the offsets and the CPU copy match, uploads only count.
+		class NullUniformBuffer : public UniformBuffer
+		{
+		public:
+			NullUniformBuffer(UniformBufferLayout layout);
+			virtual UniformBufferLayout& GetLayout() override { return m_Layout; }
+
+			virtual std::string GetName() override { return m_Name; };
+			virtual void SetName(std::string name) override { m_Name = name; };
+
+			virtual void SetReservedBindingPoint(RESERVED_BINDING_POINTS point) override {}
+
+		protected:
+			virtual void UploadData(unsigned int offset, unsigned int size) override;
+
+		private:
+			void CookLayout(); // cooks the layout according to the std140 specs
+			unsigned int GetBaseAlignmentSTD140(ShaderDataType type);
+
+			std::string m_Name;
+		};
+	}
+}
@@ -0,0 +1,51 @@
+#include "NullVertexBuffer.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+#include <cstring>
+
+namespace Akkad {
+	namespace Graphics {
+
+		void NullVertexBuffer::SetData(const void* data, unsigned int size)
+		{
+			m_Data.resize(size);
+			if (data != nullptr)
+			{
+				memcpy(m_Data.data(), data, size);
+			}
+
+			RenderStats::AddBufferUpload(size);
+		}
+
+		void NullVertexBuffer::SetSubData(unsigned int offset, const void* data, unsigned int size)
+		{
+			AK_ASSERT(m_Layout.isDynamic, "trying to modify a static buffer subdata");
+			AK_ASSERT(offset + size <= m_Data.size(), "vertex buffer write out of bounds !");
+
+			memcpy(m_Data.data() + offset, data, size);
+			RenderStats::AddBufferUpload(size);
+		}
+
+		void NullVertexBuffer::ExtendLayout(SharedPtr<VertexBuffer> vb)
+		{
+			AK_ASSERT(vb->GetLayout().isStaticBuffer, "Other buffer must be a static buffer in order to extend it's layout !");
+			AK_ASSERT(!m_Layout.isStaticBuffer, "buffer must not be a static buffer in order to extend it's layout !");
+
+			m_ExtendedLayout = vb->GetLayout();
+		}
+
+		void NullVertexBuffer::SetStreamSource(SharedPtr<StreamingBuffer> stream, unsigned int offset)
+		{
+			AK_ASSERT(!m_Layout.isStaticBuffer, "a static buffer has no vertex array, stream it through the buffer it extends !");
+
+			m_Stream = stream;
+			m_StreamOffset = offset;
+		}
+
+		void NullVertexBuffer::SetExtendedStreamSource(SharedPtr<StreamingBuffer> stream, unsigned int offset)
+		{
+			m_ExtendedStream = stream;
+			m_ExtendedStreamOffset = offset;
+		}
+	}
+}
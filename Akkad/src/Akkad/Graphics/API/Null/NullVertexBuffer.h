@@ -0,0 +1,32 @@
+#pragma once
+#include "Akkad/Graphics/Buffer.h"
+
+namespace Akkad {
+	namespace Graphics {
+		class NullVertexBuffer : public VertexBuffer
+		{
+		public:
+			virtual void Bind() override {}
+			virtual void UnBind() override {}
+			virtual void SetData(const void* data, unsigned int size) override;
+			virtual void SetSubData(unsigned int offset, const void* data, unsigned int size) override;
+			virtual void SetLayout(VertexBufferLayout layout) override { m_Layout = layout; }
+			virtual void ExtendLayout(SharedPtr<VertexBuffer> vb) override;
+			virtual void SetStreamSource(SharedPtr<StreamingBuffer> stream, unsigned int offset) override;
+			virtual void SetExtendedStreamSource(SharedPtr<StreamingBuffer> stream, unsigned int offset) override;
+			virtual VertexBufferLayout& GetLayout() override { return m_Layout; }
+
+			const std::vector<unsigned char>& GetData() { return m_Data; }
+
+		private:
+			VertexBufferLayout m_Layout;
+			VertexBufferLayout m_ExtendedLayout;
+			std::vector<unsigned char> m_Data;
+
+			SharedPtr<StreamingBuffer> m_Stream;
+			unsigned int m_StreamOffset = 0;
+			SharedPtr<StreamingBuffer> m_ExtendedStream;
+			unsigned int m_ExtendedStreamOffset = 0;
+		};
+	}
+}
@@ -1,15 +1,25 @@
 #include "GLFrameBuffer.h"
+#include "GLStateCache.h"
 #include "GLTexture.h"
 
+#include "Akkad/Logging.h"
+#include "Akkad/Graphics/RenderStats.h"
+
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 namespace Akkad {
 	namespace Graphics {
 
 		GLFrameBuffer::GLFrameBuffer(FrameBufferDescriptor desc)
 		{
 			m_desc = desc;
+			m_StorageWidth = FitStorageSize(desc.width, 0);
+			m_StorageHeight = FitStorageSize(desc.height, 0);
+
 			glGenFramebuffers(1, &m_ResourceID);
 			Bind();
 			if (desc.hasColorAttachment)
@@ -29,31 +39,47 @@ namespace Akkad {
 
 		GLFrameBuffer::~GLFrameBuffer()
 		{
+			for (auto& readback : m_PendingReadbacks)
+			{
+				glDeleteSync((GLsync)readback.fence);
+				m_FreePixelBuffers.push_back(readback.pixelBuffer);
+			}
+
+			if (!m_FreePixelBuffers.empty())
+			{
+				for (auto pixelBuffer : m_FreePixelBuffers)
+				{
+					GLStateCache::ForgetBuffer(pixelBuffer);
+				}
+				glDeleteBuffers((GLsizei)m_FreePixelBuffers.size(), m_FreePixelBuffers.data());
+			}
 		}
 
 		void GLFrameBuffer::UpdateTexture()
 		{
+			m_StorageDirty = false;
+
 			if (m_desc.hasColorAttachment)
 			{
 				Bind();
 				if (m_desc.usesRenderBuffer)
 				{
 					glBindRenderbuffer(GL_RENDERBUFFER, m_ColorAttachmentTextureID);
-					glRenderbufferStorage(GL_RENDERBUFFER, GLTexture::TextureFormatToGLFormat(m_desc.ColorAttachmentFormat), m_desc.width, m_desc.height);
+					glRenderbufferStorage(GL_RENDERBUFFER, GLTexture::TextureFormatToGLFormat(m_desc.ColorAttachmentFormat), m_StorageWidth, m_StorageHeight);
 					glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_ColorAttachmentTextureID);
 					glBindRenderbuffer(GL_RENDERBUFFER, 0);
 				}
 				else
 				{
-					glBindTexture(GL_TEXTURE_2D, m_ColorAttachmentTextureID);
+					GLStateCache::BindTexture(0, GL_TEXTURE_2D, m_ColorAttachmentTextureID);
 					
-					glTexImage2D(GL_TEXTURE_2D, 0, GLTexture::TextureFormatToGLFormat(m_desc.ColorAttachmentFormat), m_desc.width, m_desc.height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+					glTexImage2D(GL_TEXTURE_2D, 0, GLTexture::TextureFormatToGLFormat(m_desc.ColorAttachmentFormat), m_StorageWidth, m_StorageHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
 					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
 					glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_ColorAttachmentTextureID, 0);
 
-					glBindTexture(GL_TEXTURE_2D, 0);
+					GLStateCache::BindTexture(0, GL_TEXTURE_2D, 0);
 				}
 				Unbind();
 			}
@@ -62,13 +88,19 @@ namespace Akkad {
 
 		void GLFrameBuffer::Bind()
 		{
-			glBindFramebuffer(GL_FRAMEBUFFER, m_ResourceID);
-			glViewport(0, 0, m_desc.width, m_desc.height);
+			if (m_StorageDirty)
+			{
+				RenderStats::AddFramebufferResize();
+				UpdateTexture();
+			}
+
+			GLStateCache::BindFramebuffer(GL_FRAMEBUFFER, m_ResourceID);
+			GLStateCache::SetViewport(0, 0, m_desc.width, m_desc.height);
 		}
 
 		void GLFrameBuffer::Unbind()
 		{
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLStateCache::BindFramebuffer(GL_FRAMEBUFFER, 0);
 		}
 
 		void GLFrameBuffer::SetSize(unsigned int width, unsigned int height)
@@ -76,7 +108,20 @@ namespace Akkad {
 			m_desc.width = width;
 			m_desc.height = height;
 
-			UpdateTexture();
+			unsigned int storageWidth = FitStorageSize(width, m_StorageWidth);
+			unsigned int storageHeight = FitStorageSize(height, m_StorageHeight);
+
+			if (storageWidth != m_StorageWidth || storageHeight != m_StorageHeight)
+			{
+				m_StorageWidth = storageWidth;
+				m_StorageHeight = storageHeight;
+				m_StorageDirty = true;
+			}
+		}
+
+		glm::ivec2 GLFrameBuffer::GetStorageSize()
+		{
+			return { m_StorageWidth, m_StorageHeight };
 		}
 
 		unsigned int GLFrameBuffer::GetColorAttachmentTexture()
@@ -88,15 +133,144 @@ namespace Akkad {
 		{
 			glm::vec4 pixelData;
 
-			glBindFramebuffer(GL_READ_FRAMEBUFFER, m_ResourceID);
+			GLStateCache::BindFramebuffer(GL_READ_FRAMEBUFFER, m_ResourceID);
 
 			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 			glReadPixels(x, y, 1, 1, GL_RED, GL_FLOAT, glm::value_ptr(pixelData));
 
-			glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+			GLStateCache::BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
 			return pixelData;
 		}
 
+		unsigned int GLFrameBuffer::RequestPixels(int x, int y, int width, int height)
+		{
+			std::lock_guard<std::mutex> lock(m_ReadbackMutex);
+
+			if (m_QueuedReadbacks.size() + m_PendingReadbacks.size() >= MAX_PENDING_READBACKS)
+			{
+				AK_WARNING("too many pixel reads in flight, the request is dropped.");
+				return 0;
+			}
+
+			PixelReadback readback;
+			readback.id = m_NextReadbackID++;
+			readback.x = x;
+			readback.y = y;
+			readback.width = width;
+			readback.height = height;
+			m_QueuedReadbacks.push_back(readback);
+
+			return readback.id;
+		}
+
+		bool GLFrameBuffer::GetRequestedPixels(unsigned int requestID, std::vector<float>& pixels)
+		{
+			std::lock_guard<std::mutex> lock(m_ReadbackMutex);
+
+			auto it = m_CompletedReadbacks.find(requestID);
+			if (it == m_CompletedReadbacks.end())
+			{
+				return false;
+			}
+
+			pixels = std::move(it->second);
+			m_CompletedReadbacks.erase(it);
+			return true;
+		}
+
+		void GLFrameBuffer::UpdateReadbacks()
+		{
+			std::lock_guard<std::mutex> lock(m_ReadbackMutex);
+
+			// oldest first, a fence is only checked, never waited on.
+			auto pending = m_PendingReadbacks.begin();
+			while (pending != m_PendingReadbacks.end())
+			{
+				GLenum result = glClientWaitSync((GLsync)pending->fence, 0, 0);
+				if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+				{
+					break;
+				}
+
+				CompleteReadback(*pending);
+				++pending;
+			}
+			m_PendingReadbacks.erase(m_PendingReadbacks.begin(), pending);
+
+			for (auto& readback : m_QueuedReadbacks)
+			{
+				IssueReadback(readback);
+			}
+			m_QueuedReadbacks.clear();
+		}
+
+		void GLFrameBuffer::IssueReadback(PixelReadback& readback)
+		{
+			// keep the region inside of the buffer.
+			int minX = std::max(readback.x, 0);
+			int minY = std::max(readback.y, 0);
+			int maxX = std::min(readback.x + readback.width, m_desc.width);
+			int maxY = std::min(readback.y + readback.height, m_desc.height);
+
+			if (maxX <= minX || maxY <= minY)
+			{
+				m_CompletedReadbacks[readback.id].clear();
+				return;
+			}
+
+			readback.x = minX;
+			readback.y = minY;
+			readback.width = maxX - minX;
+			readback.height = maxY - minY;
+
+			if (m_FreePixelBuffers.empty())
+			{
+				unsigned int pixelBuffer;
+				glGenBuffers(1, &pixelBuffer);
+				m_FreePixelBuffers.push_back(pixelBuffer);
+			}
+
+			readback.pixelBuffer = m_FreePixelBuffers.back();
+			m_FreePixelBuffers.pop_back();
+
+			GLStateCache::BindBuffer(GL_PIXEL_PACK_BUFFER, readback.pixelBuffer);
+			glBufferData(GL_PIXEL_PACK_BUFFER, readback.width * readback.height * sizeof(float), NULL, GL_STREAM_READ);
+
+			GLStateCache::BindFramebuffer(GL_READ_FRAMEBUFFER, m_ResourceID);
+			glPixelStorei(GL_PACK_ALIGNMENT, 1);
+			// with a pack buffer bound the copy is queued and the pointer is an offset into the buffer.
+			glReadPixels(readback.x, readback.y, readback.width, readback.height, GL_RED, GL_FLOAT, nullptr);
+			GLStateCache::BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+			GLStateCache::BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+			readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			// the fence has to reach the GPU, otherwise it may never be signaled while we only poll it.
+			glFlush();
+
+			m_PendingReadbacks.push_back(readback);
+		}
+
+		void GLFrameBuffer::CompleteReadback(PixelReadback& readback)
+		{
+			auto& pixels = m_CompletedReadbacks[readback.id];
+			pixels.resize(readback.width * readback.height);
+
+			unsigned int size = (unsigned int)(pixels.size() * sizeof(float));
+
+			GLStateCache::BindBuffer(GL_PIXEL_PACK_BUFFER, readback.pixelBuffer);
+			void* data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+			if (data != nullptr)
+			{
+				memcpy(pixels.data(), data, size);
+				glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			}
+			GLStateCache::BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+			glDeleteSync((GLsync)readback.fence);
+			m_FreePixelBuffers.push_back(readback.pixelBuffer);
+		}
+
 		FrameBufferDescriptor& GLFrameBuffer::GetDescriptor()
 		{
 			return m_desc;
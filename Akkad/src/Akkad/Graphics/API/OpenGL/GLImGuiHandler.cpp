@@ -1,4 +1,6 @@
 #include "GLImGuiHandler.h"
+#include "GLStateCache.h"
+
 #include <glad/glad.h>
 #include <backends/imgui_impl_opengl3.cpp>
 
@@ -34,6 +36,8 @@ namespace Akkad {
 		{
 			ImGui::Render();
 			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+			// the backend sets its state directly.
+			GLStateCache::Invalidate();
 		}
 
 		void GLImGuiHandler::ShutDown()
@@ -43,6 +47,7 @@ namespace Akkad {
 		void GLImGuiHandler::UpdateRenderPlatforms()
 		{
 			ImGuiWindowHandler::UpdateRenderPlatforms();
+			GLStateCache::Invalidate();
 		}
 	}
 }
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "GLIndexBuffer.h"
+#include "GLStateCache.h"
+#include "Akkad/Graphics/RenderStats.h"
 #include <glad/glad.h>
 
 namespace Akkad {
@@ -12,23 +14,25 @@ namespace Akkad {
 
 		GLIndexBuffer::~GLIndexBuffer()
 		{
+			GLStateCache::ForgetBuffer(m_ResourceID);
 			glDeleteBuffers(1, &m_ResourceID);
 		}
 
 		void GLIndexBuffer::Bind()
 		{
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ResourceID);
+			GLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ResourceID);
 		}
 
 		void GLIndexBuffer::Unbind()
 		{
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ResourceID);
+			GLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ResourceID);
 		}
 
 		void GLIndexBuffer::SetData(const void* data, unsigned int size)
 		{
 			Bind();
 			glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+			RenderStats::AddBufferUpload(size);
 			Unbind();
 		}
 	}
@@ -1,4 +1,6 @@
 #include "GLRenderCommand.h"
+#include "GLStateCache.h"
+#include "Akkad/Graphics/RenderStats.h"
 #include <glad/glad.h>
 
 namespace Akkad {
@@ -65,37 +67,51 @@ namespace Akkad {
 		void GLRenderCommand::DrawArrays(PrimitiveType type, unsigned int count)
 		{
 			glDrawArrays(PrimitiveTypeToGLType(type), 0, count);
+			RenderStats::AddDraw(count);
 		}
 
 		void GLRenderCommand::DrawIndexed(PrimitiveType type, unsigned int count)
 		{
 			glDrawElements(PrimitiveTypeToGLType(type), count, GL_UNSIGNED_INT, 0);
+			RenderStats::AddDraw(count);
 		}
 
 		void GLRenderCommand::SetPolygonMode(PolygonMode mode)
 		{
-			glPolygonMode(GL_FRONT_AND_BACK, PolygonModeToGLPolygonMode(mode));
+			GLStateCache::SetPolygonMode(PolygonModeToGLPolygonMode(mode));
 		}
 
 		void GLRenderCommand::EnableBlending()
 		{
-			glEnable(GL_BLEND);
+			GLStateCache::SetBlending(true);
 		}
 
 		void GLRenderCommand::DisableBlending()
 		{
-			glDisable(GL_BLEND);
+			GLStateCache::SetBlending(false);
 		}
 
 		void GLRenderCommand::SetBlendState(BlendSourceFactor sfactor, BlendDestFactor dfactor)
 		{
 			unsigned int sourcefactor = BlendSrcToGLSrc(sfactor);
 			unsigned int destfactor = BlendDestToGLDest(dfactor);
-			glBlendFunc(sourcefactor, destfactor);
+			GLStateCache::SetBlendFunc(sourcefactor, destfactor);
 		}
 		void GLRenderCommand::DrawElementsInstanced(PrimitiveType type, unsigned int count, unsigned int amount)
 		{
 			glDrawElementsInstanced(PrimitiveTypeToGLType(type), count, GL_UNSIGNED_INT, 0, amount);
+			RenderStats::AddInstancedDraw(count, amount);
+		}
+
+		StateCacheStats GLRenderCommand::GetStateCacheStats()
+		{
+			auto stats = GLStateCache::GetFrameStats();
+			return { stats.issuedCalls, stats.elidedCalls };
+		}
+
+		void GLRenderCommand::EndFrame()
+		{
+			GLStateCache::EndFrame();
 		}
 	}
 }
\ No newline at end of file
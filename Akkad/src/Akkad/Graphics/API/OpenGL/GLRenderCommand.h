@@ -16,6 +16,9 @@ namespace Akkad {
 			virtual void DisableBlending() override;
 			virtual void SetBlendState(BlendSourceFactor sfactor, BlendDestFactor dfactor) override;
 			virtual void DrawElementsInstanced(PrimitiveType type, unsigned int count, unsigned int amount) override;
+
+			virtual StateCacheStats GetStateCacheStats() override;
+			virtual void EndFrame() override;
 		};
 	}
 }
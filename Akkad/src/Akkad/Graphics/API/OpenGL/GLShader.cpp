@@ -1,4 +1,5 @@
 #include "GLShader.h"
+#include "GLStateCache.h"
 #include "GLUniformBuffer.h"
 
 #include <glad/glad.h>
@@ -63,17 +64,18 @@ namespace Akkad {
 
 		GLShader::~GLShader()
 		{
+			GLStateCache::ForgetProgram(m_ResourceID);
 			glDeleteProgram(m_ResourceID);
 		}
 
 		void GLShader::Bind()
 		{
-			glUseProgram(m_ResourceID);
+			GLStateCache::UseProgram(m_ResourceID);
 		}
 
 		void GLShader::Unbind()
 		{
-			glUseProgram(0);
+			GLStateCache::UseProgram(0);
 		}
 		void GLShader::SetMat4(const char* location, glm::mat4& value)
 		{
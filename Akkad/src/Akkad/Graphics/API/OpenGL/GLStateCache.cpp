@@ -0,0 +1,282 @@
+#include "GLStateCache.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+#include <glad/glad.h>
+
+namespace Akkad {
+	namespace Graphics {
+
+		GLStateCache GLStateCache::s_Instance;
+
+		bool GLStateCache::Update(unsigned int& cached, unsigned int value)
+		{
+			if (cached == value)
+			{
+				m_Stats.elidedCalls++;
+				return false;
+			}
+
+			cached = value;
+			m_Stats.issuedCalls++;
+			return true;
+		}
+
+		int GLStateCache::GetBufferTargetIndex(unsigned int target)
+		{
+			switch (target)
+			{
+			case GL_ARRAY_BUFFER:
+				return ARRAY_BUFFER;
+			case GL_ELEMENT_ARRAY_BUFFER:
+				return ELEMENT_ARRAY_BUFFER;
+			case GL_UNIFORM_BUFFER:
+				return UNIFORM_BUFFER;
+			case GL_PIXEL_PACK_BUFFER:
+				return PIXEL_PACK_BUFFER;
+			default:
+				return -1;
+			}
+		}
+
+		void GLStateCache::UseProgramImpl(unsigned int program)
+		{
+			if (Update(m_Program, program))
+			{
+				glUseProgram(program);
+			}
+		}
+
+		void GLStateCache::BindVertexArrayImpl(unsigned int vertexArray)
+		{
+			if (Update(m_VertexArray, vertexArray))
+			{
+				glBindVertexArray(vertexArray);
+				// the element buffer binding is part of the vertex array.
+				m_Buffers[ELEMENT_ARRAY_BUFFER] = UNKNOWN;
+			}
+		}
+
+		void GLStateCache::BindBufferImpl(unsigned int target, unsigned int buffer)
+		{
+			int index = GetBufferTargetIndex(target);
+			if (index == -1)
+			{
+				m_Stats.issuedCalls++;
+				glBindBuffer(target, buffer);
+				return;
+			}
+
+			if (Update(m_Buffers[index], buffer))
+			{
+				glBindBuffer(target, buffer);
+			}
+		}
+
+		void GLStateCache::BindBufferRangeImpl(unsigned int target, unsigned int index, unsigned int buffer, long long offset, long long size)
+		{
+			m_Stats.issuedCalls++;
+			glBindBufferRange(target, index, buffer, (GLintptr)offset, (GLsizeiptr)size);
+
+			int targetIndex = GetBufferTargetIndex(target);
+			if (targetIndex != -1)
+			{
+				m_Buffers[targetIndex] = buffer;
+			}
+		}
+
+		void GLStateCache::BindTextureImpl(unsigned int unit, unsigned int target, unsigned int texture)
+		{
+			if (unit >= MAX_TEXTURE_UNITS)
+			{
+				m_Stats.issuedCalls += 2;
+				RenderStats::AddTextureBind();
+				glActiveTexture(GL_TEXTURE0 + unit);
+				glBindTexture(target, texture);
+				m_ActiveTextureUnit = unit;
+				return;
+			}
+
+			// a unit holds one texture per target, only the last one is tracked. binding another target
+			// is always issued, which keeps the cache conservative.
+			if (m_TextureTargets[unit] == target && m_Textures[unit] == texture)
+			{
+				m_Stats.elidedCalls++;
+				return;
+			}
+
+			if (Update(m_ActiveTextureUnit, unit))
+			{
+				glActiveTexture(GL_TEXTURE0 + unit);
+			}
+
+			m_Stats.issuedCalls++;
+			RenderStats::AddTextureBind();
+			glBindTexture(target, texture);
+			m_TextureTargets[unit] = target;
+			m_Textures[unit] = texture;
+		}
+
+		void GLStateCache::BindFramebufferImpl(unsigned int target, unsigned int framebuffer)
+		{
+			switch (target)
+			{
+			case GL_DRAW_FRAMEBUFFER:
+				if (Update(m_DrawFramebuffer, framebuffer))
+				{
+					glBindFramebuffer(target, framebuffer);
+				}
+				break;
+			case GL_READ_FRAMEBUFFER:
+				if (Update(m_ReadFramebuffer, framebuffer))
+				{
+					glBindFramebuffer(target, framebuffer);
+				}
+				break;
+			default:
+				if (m_DrawFramebuffer == framebuffer && m_ReadFramebuffer == framebuffer)
+				{
+					m_Stats.elidedCalls++;
+					return;
+				}
+
+				m_Stats.issuedCalls++;
+				glBindFramebuffer(target, framebuffer);
+				m_DrawFramebuffer = framebuffer;
+				m_ReadFramebuffer = framebuffer;
+				break;
+			}
+		}
+
+		void GLStateCache::SetViewportImpl(int x, int y, int width, int height)
+		{
+			if (m_Viewport[0] == x && m_Viewport[1] == y && m_Viewport[2] == width && m_Viewport[3] == height)
+			{
+				m_Stats.elidedCalls++;
+				return;
+			}
+
+			m_Stats.issuedCalls++;
+			glViewport(x, y, width, height);
+			m_Viewport[0] = x;
+			m_Viewport[1] = y;
+			m_Viewport[2] = width;
+			m_Viewport[3] = height;
+		}
+
+		void GLStateCache::SetBlendingImpl(bool enabled)
+		{
+			if (Update(m_Blending, enabled))
+			{
+				if (enabled)
+				{
+					glEnable(GL_BLEND);
+				}
+				else
+				{
+					glDisable(GL_BLEND);
+				}
+			}
+		}
+
+		void GLStateCache::SetBlendFuncImpl(unsigned int source, unsigned int dest)
+		{
+			if (m_BlendSource == source && m_BlendDest == dest)
+			{
+				m_Stats.elidedCalls++;
+				return;
+			}
+
+			m_Stats.issuedCalls++;
+			glBlendFunc(source, dest);
+			m_BlendSource = source;
+			m_BlendDest = dest;
+		}
+
+		void GLStateCache::SetPolygonModeImpl(unsigned int mode)
+		{
+			if (Update(m_PolygonMode, mode))
+			{
+				glPolygonMode(GL_FRONT_AND_BACK, mode);
+			}
+		}
+
+		void GLStateCache::ForgetProgramImpl(unsigned int program)
+		{
+			if (m_Program == program)
+			{
+				m_Program = UNKNOWN;
+			}
+		}
+
+		void GLStateCache::ForgetVertexArrayImpl(unsigned int vertexArray)
+		{
+			if (m_VertexArray == vertexArray)
+			{
+				m_VertexArray = UNKNOWN;
+				m_Buffers[ELEMENT_ARRAY_BUFFER] = UNKNOWN;
+			}
+		}
+
+		void GLStateCache::ForgetBufferImpl(unsigned int buffer)
+		{
+			for (auto& cached : m_Buffers)
+			{
+				if (cached == buffer)
+				{
+					cached = UNKNOWN;
+				}
+			}
+		}
+
+		void GLStateCache::ForgetTextureImpl(unsigned int texture)
+		{
+			for (unsigned int i = 0; i < MAX_TEXTURE_UNITS; i++)
+			{
+				if (m_Textures[i] == texture)
+				{
+					m_Textures[i] = UNKNOWN;
+				}
+			}
+		}
+
+		void GLStateCache::ForgetFramebufferImpl(unsigned int framebuffer)
+		{
+			if (m_DrawFramebuffer == framebuffer)
+			{
+				m_DrawFramebuffer = UNKNOWN;
+			}
+
+			if (m_ReadFramebuffer == framebuffer)
+			{
+				m_ReadFramebuffer = UNKNOWN;
+			}
+		}
+
+		void GLStateCache::InvalidateImpl()
+		{
+			m_Program = UNKNOWN;
+			m_VertexArray = UNKNOWN;
+
+			for (auto& buffer : m_Buffers)
+			{
+				buffer = UNKNOWN;
+			}
+
+			m_ActiveTextureUnit = UNKNOWN;
+			for (unsigned int i = 0; i < MAX_TEXTURE_UNITS; i++)
+			{
+				m_TextureTargets[i] = UNKNOWN;
+				m_Textures[i] = UNKNOWN;
+			}
+
+			m_DrawFramebuffer = UNKNOWN;
+			m_ReadFramebuffer = UNKNOWN;
+			m_Viewport[0] = m_Viewport[1] = m_Viewport[2] = m_Viewport[3] = -1;
+
+			m_Blending = UNKNOWN;
+			m_BlendSource = UNKNOWN;
+			m_BlendDest = UNKNOWN;
+			m_PolygonMode = UNKNOWN;
+		}
+	}
+}
@@ -0,0 +1,135 @@
+#include "GLStreamingBuffer.h"
+#include "GLStateCache.h"
+#include "Akkad/Logging.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+#include <glad/glad.h>
+#include <cstring>
+
+namespace Akkad {
+	namespace Graphics {
+
+		GLStreamingBuffer::GLStreamingBuffer(unsigned int size)
+		{
+			m_SegmentSize = size / SEGMENT_COUNT;
+			m_SegmentSize -= m_SegmentSize % ALLOCATION_ALIGNMENT;
+			m_Size = m_SegmentSize * SEGMENT_COUNT;
+
+			m_PersistentlyMapped = GLAD_GL_VERSION_4_4;
+
+			glGenBuffers(1, &m_ResourceID);
+			Allocate();
+		}
+
+		GLStreamingBuffer::~GLStreamingBuffer()
+		{
+			for (auto& fence : m_SegmentFences)
+			{
+				if (fence)
+				{
+					glDeleteSync((GLsync)fence);
+				}
+			}
+
+			if (m_PersistentlyMapped)
+			{
+				GLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_ResourceID);
+				glUnmapBuffer(GL_ARRAY_BUFFER);
+			}
+
+			GLStateCache::ForgetBuffer(m_ResourceID);
+			glDeleteBuffers(1, &m_ResourceID);
+		}
+
+		void GLStreamingBuffer::Allocate()
+		{
+			GLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_ResourceID);
+
+			if (m_PersistentlyMapped)
+			{
+				GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+				glBufferStorage(GL_ARRAY_BUFFER, m_Size, NULL, flags);
+				m_MappedData = (char*)glMapBufferRange(GL_ARRAY_BUFFER, 0, m_Size, flags);
+			}
+			else
+			{
+				glBufferData(GL_ARRAY_BUFFER, m_Size, NULL, GL_STREAM_DRAW);
+			}
+		}
+
+		unsigned int GLStreamingBuffer::Push(const void* data, unsigned int size)
+		{
+			if (size > m_SegmentSize)
+			{
+				AK_ERROR("Streaming buffer push of {} bytes is bigger than a segment ({} bytes) !", size, m_SegmentSize);
+				return INVALID_OFFSET;
+			}
+
+			unsigned int alignedOffset = (m_SegmentOffset + ALLOCATION_ALIGNMENT - 1) & ~(ALLOCATION_ALIGNMENT - 1);
+			if (alignedOffset + size > m_SegmentSize)
+			{
+				NextSegment();
+				alignedOffset = 0;
+			}
+
+			unsigned int offset = m_Segment * m_SegmentSize + alignedOffset;
+			m_SegmentOffset = alignedOffset + size;
+
+			if (m_PersistentlyMapped)
+			{
+				memcpy(m_MappedData + offset, data, size);
+			}
+			else
+			{
+				GLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_ResourceID);
+				glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+			}
+
+			RenderStats::AddBufferUpload(size);
+
+			return offset;
+		}
+
+		void GLStreamingBuffer::EndFrame()
+		{
+			if (m_SegmentOffset > 0)
+			{
+				NextSegment();
+			}
+		}
+
+		void GLStreamingBuffer::NextSegment()
+		{
+			if (m_PersistentlyMapped)
+			{
+				m_SegmentFences[m_Segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			}
+
+			m_Segment = (m_Segment + 1) % SEGMENT_COUNT;
+			m_SegmentOffset = 0;
+
+			if (m_PersistentlyMapped)
+			{
+				// wait until the GPU is done reading the segment we are about to overwrite.
+				GLsync fence = (GLsync)m_SegmentFences[m_Segment];
+				if (fence)
+				{
+					GLenum result;
+					do
+					{
+						result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+					} while (result == GL_TIMEOUT_EXPIRED);
+
+					glDeleteSync(fence);
+					m_SegmentFences[m_Segment] = nullptr;
+				}
+			}
+			else if (m_Segment == 0)
+			{
+				// orphan the storage, the driver hands us a fresh block while the old one is still in use.
+				GLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_ResourceID);
+				glBufferData(GL_ARRAY_BUFFER, m_Size, NULL, GL_STREAM_DRAW);
+			}
+		}
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "Akkad/Graphics/StreamingBuffer.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		class GLStreamingBuffer : public StreamingBuffer
+		{
+		public:
+			GLStreamingBuffer(unsigned int size);
+			~GLStreamingBuffer();
+
+			virtual unsigned int Push(const void* data, unsigned int size) override;
+			virtual void EndFrame() override;
+
+			virtual unsigned int GetID() override { return m_ResourceID; }
+			virtual unsigned int GetSize() override { return m_Size; }
+
+		private:
+			void NextSegment();
+			void Allocate();
+
+			unsigned int m_ResourceID;
+			unsigned int m_Size;
+			unsigned int m_SegmentSize;
+			unsigned int m_Segment = 0;
+			unsigned int m_SegmentOffset = 0;
+
+			// GL 4.4 buffer storage, otherwise the buffer is orphaned each time the ring wraps.
+			bool m_PersistentlyMapped = false;
+			char* m_MappedData = nullptr;
+			void* m_SegmentFences[SEGMENT_COUNT] = {};
+		};
+	}
+}
@@ -1,4 +1,5 @@
 #include "GLTexture.h"
+#include "GLStateCache.h"
 #include "Akkad/core.h"
 
 #include <glad/glad.h>
@@ -25,9 +26,9 @@ namespace Akkad {
 
 			InitilizeTexture();
 
-			glBindTexture(textureType, m_ResourceID);
+			GLStateCache::BindTexture(0, textureType, m_ResourceID);
 			glTexImage2D(textureType, 0, textureFormat, desc.Width, desc.Height, 0, textureFormat, GL_UNSIGNED_BYTE, 0);
-			glBindTexture(textureType, 0);
+			GLStateCache::BindTexture(0, textureType, 0);
 
 		}
 
@@ -51,19 +52,19 @@ namespace Akkad {
 		{
 			unsigned int textureType = TextureTypeToGLType(m_desc.Type);
 			glGenTextures(1, &m_ResourceID);
-			glBindTexture(textureType, m_ResourceID);
+			GLStateCache::BindTexture(0, textureType, m_ResourceID);
 			glTexParameteri(textureType, GL_TEXTURE_WRAP_S, GL_REPEAT);
 			glTexParameteri(textureType, GL_TEXTURE_WRAP_T, GL_REPEAT);
 			glTexParameteri(textureType, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 			glTexParameteri(textureType, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-			glBindTexture(textureType, 0);
+			GLStateCache::BindTexture(0, textureType, 0);
 
 		}
 
 		void GLTexture::SetTextureImageData()
 		{
 			unsigned int textureType = TextureTypeToGLType(m_desc.Type);
-			glBindTexture(textureType, m_ResourceID);
+			GLStateCache::BindTexture(0, textureType, m_ResourceID);
 			if (m_desc.nChannels == 3)
 			{
 				glTexImage2D(textureType, 0, GL_RGB, m_desc.Width, m_desc.Height, 0, GL_RGB, GL_UNSIGNED_BYTE, m_desc.Data);
@@ -78,29 +79,28 @@ namespace Akkad {
 			{
 				AK_ASSERT((false), "number of channels is not supported !");
 			}
-			glBindTexture(textureType, 0);
+			GLStateCache::BindTexture(0, textureType, 0);
 			stbi_image_free(m_desc.Data);
 		}
 
 		void GLTexture::Bind(unsigned int unit)
 		{
-			glActiveTexture(GL_TEXTURE0 + unit);
-			glBindTexture(GL_TEXTURE_2D, m_ResourceID);
+			GLStateCache::BindTexture(unit, GL_TEXTURE_2D, m_ResourceID);
 		}
 
 		void GLTexture::Unbind()
 		{
-			glBindTexture(GL_TEXTURE_2D, 0);
+			GLStateCache::BindTexture(0, GL_TEXTURE_2D, 0);
 		}
 
 		void GLTexture::SetSubData(int x, int y, unsigned int width, unsigned int height, void* data)
 		{
 			unsigned int textureType = TextureTypeToGLType(m_desc.Type);
 			unsigned int textureFormat = TextureFormatToGLFormat(m_desc.Format);
-			glBindTexture(textureType, m_ResourceID);
+			GLStateCache::BindTexture(0, textureType, m_ResourceID);
 			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 			glTexSubImage2D(textureType, 0, x, y, width, height, textureFormat, GL_UNSIGNED_BYTE, data);
-			glBindTexture(textureType, 0);
+			GLStateCache::BindTexture(0, textureType, 0);
 		}
 
 		unsigned int GLTexture::TextureFormatToGLFormat(TextureFormat format)
@@ -1,4 +1,6 @@
 #include "GLUniformBuffer.h"
+#include "GLStateCache.h"
+#include "Akkad/Graphics/RenderStats.h"
 #include <glad/glad.h>
 
 #include <iostream>
@@ -15,9 +17,9 @@ namespace Akkad {
 			glGenBuffers(1, &m_ResourceID);
 
 			CookLayout();
-			glBindBuffer(GL_UNIFORM_BUFFER, m_ResourceID);
+			GLStateCache::BindBuffer(GL_UNIFORM_BUFFER, m_ResourceID);
 			glBufferData(GL_UNIFORM_BUFFER, m_Layout.m_BufferSize, NULL, GL_DYNAMIC_DRAW); //allocate memory for the buffer on the GPU side
-			glBindBuffer(GL_UNIFORM_BUFFER, 0);
+			GLStateCache::BindBuffer(GL_UNIFORM_BUFFER, 0);
 
 			for (int i = 0; i < m_Layout.m_BufferSize; i++)
 			{
@@ -37,6 +39,7 @@ namespace Akkad {
 			{
 				s_LastBindingPoint -= 1;
 			}
+			GLStateCache::ForgetBuffer(m_ResourceID);
 			glDeleteBuffers(1, &m_ResourceID);
 		}
 
@@ -45,25 +48,26 @@ namespace Akkad {
 			return m_Layout;
 		}
 
-		void GLUniformBuffer::ResetData()
+		void GLUniformBuffer::UploadData(unsigned int offset, unsigned int size)
 		{
-			glBindBuffer(GL_UNIFORM_BUFFER, m_ResourceID);
+			GLStateCache::BindBuffer(GL_UNIFORM_BUFFER, m_ResourceID);
 
 			//void* data = glMapBuffer(GL_UNIFORM_BUFFER, GL_WRITE_ONLY);
 			//memcpy(data, m_BufferData.data(), m_Layout.m_BufferSize);
 			//glUnmapBuffer(GL_UNIFORM_BUFFER);
 
-			glBufferSubData(GL_UNIFORM_BUFFER, 0, m_Layout.m_BufferSize, m_BufferData.data());
+			glBufferSubData(GL_UNIFORM_BUFFER, offset, size, m_BufferData.data() + offset);
+			RenderStats::AddUniformUpload(size);
 
-			glBindBuffer(GL_UNIFORM_BUFFER, 0);
+			GLStateCache::BindBuffer(GL_UNIFORM_BUFFER, 0);
 		}
 
 		void GLUniformBuffer::SetReservedBindingPoint(RESERVED_BINDING_POINTS point)
 		{
 			AK_ASSERT(point != RESERVED_BINDING_POINTS::_POINTS_MIN, "Trying to set an invalid binding point '_POINTS_MIN !'");
 			AK_ASSERT(point != RESERVED_BINDING_POINTS::_POINTS_MAX, "Trying to set an invalid binding point '_POINTS_MAX !'");
-			glBindBufferRange(GL_UNIFORM_BUFFER, point, NULL, 0, 0);
-			glBindBufferRange(GL_UNIFORM_BUFFER, point, m_ResourceID, 0, m_Layout.m_BufferSize);
+			GLStateCache::BindBufferRange(GL_UNIFORM_BUFFER, point, NULL, 0, 0);
+			GLStateCache::BindBufferRange(GL_UNIFORM_BUFFER, point, m_ResourceID, 0, m_Layout.m_BufferSize);
 			m_BindingPoint = point;
 		}
 
@@ -81,7 +85,7 @@ namespace Akkad {
 			}
 			else
 			{
-				glBindBufferRange(GL_UNIFORM_BUFFER, s_LastBindingPoint, m_ResourceID, 0, m_Layout.m_BufferSize);
+				GLStateCache::BindBufferRange(GL_UNIFORM_BUFFER, s_LastBindingPoint, m_ResourceID, 0, m_Layout.m_BufferSize);
 				m_BindingPoint = s_LastBindingPoint;
 				s_LastBindingPoint += 1;
 			}
@@ -1,5 +1,8 @@
 #include "GLVertexBuffer.h"
+#include "GLStateCache.h"
+#include "Akkad/Graphics/StreamingBuffer.h"
 #include "Akkad/core.h"
+#include "Akkad/Graphics/RenderStats.h"
 
 #include <glad/glad.h>
 namespace Akkad {
@@ -17,6 +20,10 @@ namespace Akkad {
 				return GL_FLOAT;
 			case ShaderDataType::UNISGNED_INT:
 				return GL_UNSIGNED_INT;
+			case ShaderDataType::UNSIGNED_BYTE:
+				return GL_UNSIGNED_BYTE;
+			case ShaderDataType::UNSIGNED_SHORT:
+				return GL_UNSIGNED_SHORT;
 			default:
 				break;
 			}
@@ -32,8 +39,10 @@ namespace Akkad {
 		{
 			if (!m_Layout.isStaticBuffer)
 			{
+				GLStateCache::ForgetVertexArray(m_VA);
 				glDeleteVertexArrays(1, &m_VA);
 			}
+			GLStateCache::ForgetBuffer(m_ResourceID);
 			glDeleteBuffers(1, &m_ResourceID);
 		}
 
@@ -41,15 +50,15 @@ namespace Akkad {
 		{
 			if (!m_Layout.isStaticBuffer)
 			{
-				glBindVertexArray(m_VA);
+				GLStateCache::BindVertexArray(m_VA);
 			}
-			glBindBuffer(GL_ARRAY_BUFFER, m_ResourceID);
+			GLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_ResourceID);
 		}
 
 		void GLVertexBuffer::UnBind()
 		{
-			glBindVertexArray(0);
-			glBindBuffer(GL_ARRAY_BUFFER, 0);
+			GLStateCache::BindVertexArray(0);
+			GLStateCache::BindBuffer(GL_ARRAY_BUFFER, 0);
 		}
 
 		void GLVertexBuffer::SetData(const void* data, unsigned int size)
@@ -63,6 +72,7 @@ namespace Akkad {
 			{
 				glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
 			}
+			RenderStats::AddBufferUpload(size);
 			UnBind();
 		}
 
@@ -71,6 +81,7 @@ namespace Akkad {
 			AK_ASSERT(m_Layout.isDynamic, "trying to modify a static buffer subdata");
 			Bind();
 			glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+			RenderStats::AddBufferUpload(size);
 			UnBind();
 		}
 
@@ -114,7 +125,10 @@ namespace Akkad {
 			AK_ASSERT(!m_Layout.isStaticBuffer, "buffer must not be a static buffer in order to extend it's layout !");
 
 			vb->Bind();
-			glBindVertexArray(m_VA);
+			GLStateCache::BindVertexArray(m_VA);
+
+			m_ExtendedLayout = otherLayout;
+			m_ExtendedAttributeStart = m_AvailableVertexAttribute;
 
 			auto& elements = otherLayout.GetElements();
 
@@ -137,6 +151,38 @@ namespace Akkad {
 
 		}
 
+		void GLVertexBuffer::SetStreamSource(SharedPtr<StreamingBuffer> stream, unsigned int offset)
+		{
+			AK_ASSERT(!m_Layout.isStaticBuffer, "a static buffer has no vertex array, stream it through the buffer it extends !");
+
+			GLStateCache::BindVertexArray(m_VA);
+			GLStateCache::BindBuffer(GL_ARRAY_BUFFER, stream->GetID());
+			SetAttributePointers(m_Layout, 0, offset);
+			GLStateCache::BindVertexArray(0);
+		}
+
+		void GLVertexBuffer::SetExtendedStreamSource(SharedPtr<StreamingBuffer> stream, unsigned int offset)
+		{
+			GLStateCache::BindVertexArray(m_VA);
+			GLStateCache::BindBuffer(GL_ARRAY_BUFFER, stream->GetID());
+			SetAttributePointers(m_ExtendedLayout, m_ExtendedAttributeStart, offset);
+			GLStateCache::BindVertexArray(0);
+		}
+
+		void GLVertexBuffer::SetAttributePointers(VertexBufferLayout& layout, unsigned int firstAttribute, unsigned int baseOffset)
+		{
+			auto& elements = layout.GetElements();
+
+			for (unsigned int i = 0; i < elements.size(); i++)
+			{
+				auto& element = elements[i];
+				auto glType = ElementTypeToGLType(element.type);
+				auto glNormalized = element.normalized ? GL_TRUE : GL_FALSE;
+
+				glVertexAttribPointer(firstAttribute + i, element.count, glType, glNormalized, layout.GetStride(), (const void*)(uintptr_t)(baseOffset + element.offset));
+			}
+		}
+
 		VertexBufferLayout& GLVertexBuffer::GetLayout()
 		{
 			return m_Layout;
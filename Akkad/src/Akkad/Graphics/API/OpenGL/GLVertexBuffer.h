@@ -14,12 +14,19 @@ namespace Akkad {
 			virtual void SetSubData(unsigned int offset, const void* data, unsigned int size) override;
 			virtual void SetLayout(VertexBufferLayout layout) override;
 			virtual void ExtendLayout(SharedPtr<VertexBuffer> vb) override;
+			virtual void SetStreamSource(SharedPtr<StreamingBuffer> stream, unsigned int offset) override;
+			virtual void SetExtendedStreamSource(SharedPtr<StreamingBuffer> stream, unsigned int offset) override;
 			virtual VertexBufferLayout& GetLayout() override;
 		private:
 			VertexBufferLayout m_Layout;
 			unsigned int m_VA;
 			unsigned int m_ResourceID;
 			unsigned int m_AvailableVertexAttribute = 0;
+
+			VertexBufferLayout m_ExtendedLayout;
+			unsigned int m_ExtendedAttributeStart = 0;
+
+			void SetAttributePointers(VertexBufferLayout& layout, unsigned int firstAttribute, unsigned int baseOffset);
 		};
 	}
 }
@@ -1,4 +1,5 @@
 #include "OpenGLPlatform.h"
+#include "GLStateCache.h"
 #include "Akkad/Application/Application.h"
 #include "GLIndexBuffer.h"
 #include "GLVertexBuffer.h"
@@ -7,6 +8,7 @@
 #include "GLRenderCommand.h"
 #include "GLFrameBuffer.h"
 #include "GLUniformBuffer.h"
+#include "GLStreamingBuffer.h"
 
 #include <glad/glad.h>
 
@@ -29,7 +31,7 @@ namespace Akkad {
 
 		void OpenGLPlatform::OnWindowResize(unsigned int width, unsigned int height)
 		{
-			glViewport(0, 0, width, height);
+			GLStateCache::SetViewport(0, 0, width, height);
 		}
 
 		SharedPtr<VertexBuffer> OpenGLPlatform::CreateVertexBuffer()
@@ -76,5 +78,10 @@ namespace Akkad {
 		{
 			return CreateSharedPtr<GLUniformBuffer>(layout);
 		}
+
+		SharedPtr<StreamingBuffer> OpenGLPlatform::CreateStreamingBuffer(unsigned int size)
+		{
+			return CreateSharedPtr<GLStreamingBuffer>(size);
+		}
 	}
 }
\ No newline at end of file
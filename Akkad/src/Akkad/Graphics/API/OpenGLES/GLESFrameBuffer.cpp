@@ -1,16 +1,25 @@
 #include "GLESFrameBuffer.h"
+#include "GLESStateCache.h"
 #include "GLESTexture.h"
 
+#include "Akkad/Logging.h"
+#include "Akkad/Graphics/RenderStats.h"
+
 #include <GLES3/gl3.h>
 #include <glm/gtc/type_ptr.hpp>
 #include <iostream>
 
+#include <algorithm>
+
 namespace Akkad {
 	namespace Graphics {
 
 		GLESFrameBuffer::GLESFrameBuffer(FrameBufferDescriptor desc)
 		{
 			m_desc = desc;
+			m_StorageWidth = FitStorageSize(desc.width, 0);
+			m_StorageHeight = FitStorageSize(desc.height, 0);
+
 			glGenFramebuffers(1, &m_ResourceID);
 			Bind();
 			if (m_desc.hasColorAttachment)
@@ -34,27 +43,29 @@ namespace Akkad {
 
 		void GLESFrameBuffer::UpdateTexture()
 		{
+			m_StorageDirty = false;
+
 			if (m_desc.hasColorAttachment)
 			{
 				Bind();
 				if (m_desc.usesRenderBuffer)
 				{
 					glBindRenderbuffer(GL_RENDERBUFFER, m_ColorAttachmentTextureID);
-					glRenderbufferStorage(GL_RENDERBUFFER, GLESTexture::TextureFormatToGLFormat(m_desc.ColorAttachmentFormat), m_desc.width, m_desc.height);
+					glRenderbufferStorage(GL_RENDERBUFFER, GLESTexture::TextureFormatToGLFormat(m_desc.ColorAttachmentFormat), m_StorageWidth, m_StorageHeight);
 					glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_ColorAttachmentTextureID);
 					glBindRenderbuffer(GL_RENDERBUFFER, 0);
 				}
 				else
 				{
-					glBindTexture(GL_TEXTURE_2D, m_ColorAttachmentTextureID);
+					GLESStateCache::BindTexture(0, GL_TEXTURE_2D, m_ColorAttachmentTextureID);
 
-					glTexImage2D(GL_TEXTURE_2D, 0, GLESTexture::TextureFormatToGLFormat(m_desc.ColorAttachmentFormat), m_desc.width, m_desc.height, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+					glTexImage2D(GL_TEXTURE_2D, 0, GLESTexture::TextureFormatToGLFormat(m_desc.ColorAttachmentFormat), m_StorageWidth, m_StorageHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
 					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 					glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
 					glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_ColorAttachmentTextureID, 0);
 
-					glBindTexture(GL_TEXTURE_2D, 0);
+					GLESStateCache::BindTexture(0, GL_TEXTURE_2D, 0);
 				}
 				Unbind();
 			}
@@ -63,13 +74,19 @@ namespace Akkad {
 
 		void GLESFrameBuffer::Bind()
 		{
-			glBindFramebuffer(GL_FRAMEBUFFER, m_ResourceID);
-			glViewport(0, 0, m_desc.width, m_desc.height);
+			if (m_StorageDirty)
+			{
+				RenderStats::AddFramebufferResize();
+				UpdateTexture();
+			}
+
+			GLESStateCache::BindFramebuffer(GL_FRAMEBUFFER, m_ResourceID);
+			GLESStateCache::SetViewport(0, 0, m_desc.width, m_desc.height);
 		}
 
 		void GLESFrameBuffer::Unbind()
 		{
-			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			GLESStateCache::BindFramebuffer(GL_FRAMEBUFFER, 0);
 		}
 
 		void GLESFrameBuffer::SetSize(unsigned int width, unsigned int height)
@@ -77,7 +94,20 @@ namespace Akkad {
 			m_desc.width = width;
 			m_desc.height = height;
 
-			UpdateTexture();
+			unsigned int storageWidth = FitStorageSize(width, m_StorageWidth);
+			unsigned int storageHeight = FitStorageSize(height, m_StorageHeight);
+
+			if (storageWidth != m_StorageWidth || storageHeight != m_StorageHeight)
+			{
+				m_StorageWidth = storageWidth;
+				m_StorageHeight = storageHeight;
+				m_StorageDirty = true;
+			}
+		}
+
+		glm::ivec2 GLESFrameBuffer::GetStorageSize()
+		{
+			return { m_StorageWidth, m_StorageHeight };
 		}
 
 		unsigned int GLESFrameBuffer::GetColorAttachmentTexture()
@@ -89,15 +119,81 @@ namespace Akkad {
 		{
 			glm::vec4 pixelData;
 
-			glBindFramebuffer(GL_READ_FRAMEBUFFER, m_ResourceID);
+			GLESStateCache::BindFramebuffer(GL_READ_FRAMEBUFFER, m_ResourceID);
 
 			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 			glReadPixels(x, y, 1, 1, GL_RED, GL_FLOAT, glm::value_ptr(pixelData));
 
-			glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+			GLESStateCache::BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
 			return pixelData;
 		}
 
+		unsigned int GLESFrameBuffer::RequestPixels(int x, int y, int width, int height)
+		{
+			std::lock_guard<std::mutex> lock(m_ReadbackMutex);
+
+			if (m_QueuedReadbacks.size() >= MAX_PENDING_READBACKS)
+			{
+				AK_WARNING("too many pixel reads in flight, the request is dropped.");
+				return 0;
+			}
+
+			PixelReadback readback;
+			readback.id = m_NextReadbackID++;
+			readback.x = x;
+			readback.y = y;
+			readback.width = width;
+			readback.height = height;
+			m_QueuedReadbacks.push_back(readback);
+
+			return readback.id;
+		}
+
+		bool GLESFrameBuffer::GetRequestedPixels(unsigned int requestID, std::vector<float>& pixels)
+		{
+			std::lock_guard<std::mutex> lock(m_ReadbackMutex);
+
+			auto it = m_CompletedReadbacks.find(requestID);
+			if (it == m_CompletedReadbacks.end())
+			{
+				return false;
+			}
+
+			pixels = std::move(it->second);
+			m_CompletedReadbacks.erase(it);
+			return true;
+		}
+
+		void GLESFrameBuffer::UpdateReadbacks()
+		{
+			std::lock_guard<std::mutex> lock(m_ReadbackMutex);
+
+			// WebGL can not map buffers, so the reads stay synchronous here. they are still batched
+			// at the end of the picking pass, the result is available on the next poll.
+			for (auto& readback : m_QueuedReadbacks)
+			{
+				int minX = std::max(readback.x, 0);
+				int minY = std::max(readback.y, 0);
+				int maxX = std::min(readback.x + readback.width, m_desc.width);
+				int maxY = std::min(readback.y + readback.height, m_desc.height);
+
+				auto& pixels = m_CompletedReadbacks[readback.id];
+				if (maxX <= minX || maxY <= minY)
+				{
+					pixels.clear();
+					continue;
+				}
+
+				pixels.resize((maxX - minX) * (maxY - minY));
+
+				GLESStateCache::BindFramebuffer(GL_READ_FRAMEBUFFER, m_ResourceID);
+				glPixelStorei(GL_PACK_ALIGNMENT, 1);
+				glReadPixels(minX, minY, maxX - minX, maxY - minY, GL_RED, GL_FLOAT, pixels.data());
+				GLESStateCache::BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+			}
+			m_QueuedReadbacks.clear();
+		}
+
 		FrameBufferDescriptor& GLESFrameBuffer::GetDescriptor()
 		{
 			return m_desc;
@@ -1,4 +1,6 @@
 #include "GLESIndexBuffer.h"
+#include "GLESStateCache.h"
+#include "Akkad/Graphics/RenderStats.h"
 #include <GLES3/gl3.h>
 
 namespace Akkad {
@@ -12,23 +14,25 @@ namespace Akkad {
 
 		GLESIndexBuffer::~GLESIndexBuffer()
 		{
+			GLESStateCache::ForgetBuffer(m_ResourceID);
 			glDeleteBuffers(1, &m_ResourceID);
 		}
 
 		void GLESIndexBuffer::Bind()
 		{
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ResourceID);
+			GLESStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ResourceID);
 		}
 
 		void GLESIndexBuffer::Unbind()
 		{
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ResourceID);
+			GLESStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ResourceID);
 		}
 
 		void GLESIndexBuffer::SetData(const void* data, unsigned int size)
 		{
 			Bind();
 			glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
+			RenderStats::AddBufferUpload(size);
 			Unbind();
 		}
 	}
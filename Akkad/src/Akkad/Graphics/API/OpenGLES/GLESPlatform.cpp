@@ -1,4 +1,5 @@
 #include "GLESPlatform.h"
+#include "GLESStateCache.h"
 #include "Akkad/Application/Application.h"
 #include "GLESIndexBuffer.h"
 #include "GLESVertexBuffer.h"
@@ -7,6 +8,7 @@
 #include "GLESRenderCommand.h"
 #include "GLESFrameBuffer.h"
 #include "GLESUniformBuffer.h"
+#include "GLESStreamingBuffer.h"
 
 #include <GLES3/gl3.h>
 namespace Akkad {
@@ -24,7 +26,7 @@ namespace Akkad {
 
 		void GLESPlatform::OnWindowResize(unsigned int width, unsigned int height)
 		{
-			glViewport(0, 0, width, height);
+			GLESStateCache::SetViewport(0, 0, width, height);
 		}
 
 		SharedPtr<VertexBuffer> GLESPlatform::CreateVertexBuffer()
@@ -71,5 +73,10 @@ namespace Akkad {
 		{
 			return CreateSharedPtr<GLESUniformBuffer>(layout);
 		}
+
+		SharedPtr<StreamingBuffer> GLESPlatform::CreateStreamingBuffer(unsigned int size)
+		{
+			return CreateSharedPtr<GLESStreamingBuffer>(size);
+		}
 	}
 }
\ No newline at end of file
@@ -23,6 +23,7 @@ namespace Akkad {
 			virtual SharedPtr<FrameBuffer> CreateFrameBuffer(FrameBufferDescriptor desc) override;
 			virtual SharedPtr<RenderContext> GetRenderContext() override;
 			virtual SharedPtr<UniformBuffer> CreateUniformBuffer(UniformBufferLayout layout) override;
+			virtual SharedPtr<StreamingBuffer> CreateStreamingBuffer(unsigned int size) override;
 
 		private:
 			RenderAPI m_API = RenderAPI::OPENGL;
@@ -1,4 +1,6 @@
 #include "GLESRenderCommand.h"
+#include "GLESStateCache.h"
+#include "Akkad/Graphics/RenderStats.h"
 
 #include <GLES3/gl3.h>
 
@@ -68,11 +70,13 @@ namespace Akkad {
 		void GLESRenderCommand::DrawArrays(PrimitiveType type, unsigned int count)
 		{
 			glDrawArrays(PrimitiveTypeToGLType(type), 0, count);
+			RenderStats::AddDraw(count);
 		}
 
 		void GLESRenderCommand::DrawIndexed(PrimitiveType type, unsigned int count)
 		{
 			glDrawElements(PrimitiveTypeToGLType(type), count, GL_UNSIGNED_INT, 0);
+			RenderStats::AddDraw(count);
 		}
 
 		void GLESRenderCommand::SetPolygonMode(PolygonMode mode)
@@ -82,24 +86,36 @@ namespace Akkad {
 
 		void GLESRenderCommand::EnableBlending()
 		{
-			glEnable(GL_BLEND);
+			GLESStateCache::SetBlending(true);
 		}
 
 		void GLESRenderCommand::DisableBlending()
 		{
-			glDisable(GL_BLEND);
+			GLESStateCache::SetBlending(false);
 		}
 
 		void GLESRenderCommand::SetBlendState(BlendSourceFactor sfactor, BlendDestFactor dfactor)
 		{
 			unsigned int sourcefactor = BlendSrcToGLSrc(sfactor);
 			unsigned int destfactor = BlendDestToGLDest(dfactor);
-			glBlendFunc(sourcefactor, destfactor);
+			GLESStateCache::SetBlendFunc(sourcefactor, destfactor);
 		}
 
 		void GLESRenderCommand::DrawElementsInstanced(PrimitiveType type, unsigned int count, unsigned int amount)
 		{
 			glDrawElementsInstanced(PrimitiveTypeToGLType(type), count, GL_UNSIGNED_INT, 0, amount);
+			RenderStats::AddInstancedDraw(count, amount);
+		}
+
+		StateCacheStats GLESRenderCommand::GetStateCacheStats()
+		{
+			auto stats = GLESStateCache::GetFrameStats();
+			return { stats.issuedCalls, stats.elidedCalls };
+		}
+
+		void GLESRenderCommand::EndFrame()
+		{
+			GLESStateCache::EndFrame();
 		}
 	}
 }
\ No newline at end of file
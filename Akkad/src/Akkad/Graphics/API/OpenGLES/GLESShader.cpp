@@ -1,4 +1,5 @@
 #include "GLESShader.h"
+#include "GLESStateCache.h"
 #include "GLESUniformBuffer.h"
 
 #include <GLES3/gl3.h>
@@ -63,17 +64,18 @@ namespace Akkad {
 
 		GLESShader::~GLESShader()
 		{
+			GLESStateCache::ForgetProgram(m_ResourceID);
 			glDeleteProgram(m_ResourceID);
 		}
 
 		void GLESShader::Bind()
 		{
-			glUseProgram(m_ResourceID);
+			GLESStateCache::UseProgram(m_ResourceID);
 		}
 
 		void GLESShader::Unbind()
 		{
-			glUseProgram(0);
+			GLESStateCache::UseProgram(0);
 		}
 		void GLESShader::SetMat4(const char* location, glm::mat4& value)
 		{
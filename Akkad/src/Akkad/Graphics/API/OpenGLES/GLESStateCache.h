@@ -0,0 +1,94 @@
+#pragma once
+#include "Akkad/core.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		// same as GLStateCache for the GLES backend, there is no polygon mode to track.
+		class GLESStateCache
+		{
+		public:
+			enum { MAX_TEXTURE_UNITS = 16, UNKNOWN = 0xFFFFFFFF };
+
+			struct Stats {
+				unsigned int issuedCalls = 0;
+				unsigned int elidedCalls = 0;
+			};
+
+			static GLESStateCache& GetInstance() { return s_Instance; }
+
+			static void UseProgram(unsigned int program) { GetInstance().UseProgramImpl(program); }
+			static void BindVertexArray(unsigned int vertexArray) { GetInstance().BindVertexArrayImpl(vertexArray); }
+			static void BindBuffer(unsigned int target, unsigned int buffer) { GetInstance().BindBufferImpl(target, buffer); }
+			// also binds the generic target, always issued.
+			static void BindBufferRange(unsigned int target, unsigned int index, unsigned int buffer, long long offset, long long size) { GetInstance().BindBufferRangeImpl(target, index, buffer, offset, size); }
+			static void BindTexture(unsigned int unit, unsigned int target, unsigned int texture) { GetInstance().BindTextureImpl(unit, target, texture); }
+			static void BindFramebuffer(unsigned int target, unsigned int framebuffer) { GetInstance().BindFramebufferImpl(target, framebuffer); }
+			static void SetViewport(int x, int y, int width, int height) { GetInstance().SetViewportImpl(x, y, width, height); }
+			static void SetBlending(bool enabled) { GetInstance().SetBlendingImpl(enabled); }
+			static void SetBlendFunc(unsigned int source, unsigned int dest) { GetInstance().SetBlendFuncImpl(source, dest); }
+
+			static void ForgetProgram(unsigned int program) { GetInstance().ForgetProgramImpl(program); }
+			static void ForgetVertexArray(unsigned int vertexArray) { GetInstance().ForgetVertexArrayImpl(vertexArray); }
+			static void ForgetBuffer(unsigned int buffer) { GetInstance().ForgetBufferImpl(buffer); }
+			static void ForgetTexture(unsigned int texture) { GetInstance().ForgetTextureImpl(texture); }
+			static void ForgetFramebuffer(unsigned int framebuffer) { GetInstance().ForgetFramebufferImpl(framebuffer); }
+
+			// the next call of every kind is issued.
+			static void Invalidate() { GetInstance().InvalidateImpl(); }
+
+			// counters of the last finished frame.
+			static Stats GetFrameStats() { return GetInstance().m_LastFrameStats; }
+			static void EndFrame() { GetInstance().m_LastFrameStats = GetInstance().m_Stats; GetInstance().m_Stats = Stats(); }
+
+		private:
+			GLESStateCache() { InvalidateImpl(); };
+			~GLESStateCache() {};
+
+			static GLESStateCache s_Instance;
+
+			enum BufferTarget { ARRAY_BUFFER, ELEMENT_ARRAY_BUFFER, UNIFORM_BUFFER, PIXEL_PACK_BUFFER, BUFFER_TARGET_COUNT };
+
+			void UseProgramImpl(unsigned int program);
+			void BindVertexArrayImpl(unsigned int vertexArray);
+			void BindBufferImpl(unsigned int target, unsigned int buffer);
+			void BindBufferRangeImpl(unsigned int target, unsigned int index, unsigned int buffer, long long offset, long long size);
+			void BindTextureImpl(unsigned int unit, unsigned int target, unsigned int texture);
+			void BindFramebufferImpl(unsigned int target, unsigned int framebuffer);
+			void SetViewportImpl(int x, int y, int width, int height);
+			void SetBlendingImpl(bool enabled);
+			void SetBlendFuncImpl(unsigned int source, unsigned int dest);
+
+			void ForgetProgramImpl(unsigned int program);
+			void ForgetVertexArrayImpl(unsigned int vertexArray);
+			void ForgetBufferImpl(unsigned int buffer);
+			void ForgetTextureImpl(unsigned int texture);
+			void ForgetFramebufferImpl(unsigned int framebuffer);
+
+			void InvalidateImpl();
+
+			// returns true when the call has to be issued, and counts it.
+			bool Update(unsigned int& cached, unsigned int value);
+			static int GetBufferTargetIndex(unsigned int target);
+
+			unsigned int m_Program;
+			unsigned int m_VertexArray;
+			unsigned int m_Buffers[BUFFER_TARGET_COUNT];
+
+			unsigned int m_ActiveTextureUnit;
+			unsigned int m_TextureTargets[MAX_TEXTURE_UNITS];
+			unsigned int m_Textures[MAX_TEXTURE_UNITS];
+
+			unsigned int m_DrawFramebuffer;
+			unsigned int m_ReadFramebuffer;
+			int m_Viewport[4];
+
+			unsigned int m_Blending;
+			unsigned int m_BlendSource;
+			unsigned int m_BlendDest;
+
+			Stats m_Stats;
+			Stats m_LastFrameStats;
+		};
+	}
+}
@@ -0,0 +1,73 @@
+#include "GLESStreamingBuffer.h"
+#include "GLESStateCache.h"
+#include "Akkad/Logging.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+#include <GLES3/gl3.h>
+
+namespace Akkad {
+	namespace Graphics {
+
+		GLESStreamingBuffer::GLESStreamingBuffer(unsigned int size)
+		{
+			m_SegmentSize = size / SEGMENT_COUNT;
+			m_SegmentSize -= m_SegmentSize % ALLOCATION_ALIGNMENT;
+			m_Size = m_SegmentSize * SEGMENT_COUNT;
+
+			glGenBuffers(1, &m_ResourceID);
+			GLESStateCache::BindBuffer(GL_ARRAY_BUFFER, m_ResourceID);
+			glBufferData(GL_ARRAY_BUFFER, m_Size, NULL, GL_STREAM_DRAW);
+		}
+
+		GLESStreamingBuffer::~GLESStreamingBuffer()
+		{
+			GLESStateCache::ForgetBuffer(m_ResourceID);
+			glDeleteBuffers(1, &m_ResourceID);
+		}
+
+		unsigned int GLESStreamingBuffer::Push(const void* data, unsigned int size)
+		{
+			if (size > m_SegmentSize)
+			{
+				AK_ERROR("Streaming buffer push of {} bytes is bigger than a segment ({} bytes) !", size, m_SegmentSize);
+				return INVALID_OFFSET;
+			}
+
+			unsigned int alignedOffset = (m_SegmentOffset + ALLOCATION_ALIGNMENT - 1) & ~(ALLOCATION_ALIGNMENT - 1);
+			if (alignedOffset + size > m_SegmentSize)
+			{
+				NextSegment();
+				alignedOffset = 0;
+			}
+
+			unsigned int offset = m_Segment * m_SegmentSize + alignedOffset;
+			m_SegmentOffset = alignedOffset + size;
+
+			GLESStateCache::BindBuffer(GL_ARRAY_BUFFER, m_ResourceID);
+			glBufferSubData(GL_ARRAY_BUFFER, offset, size, data);
+			RenderStats::AddBufferUpload(size);
+
+			return offset;
+		}
+
+		void GLESStreamingBuffer::EndFrame()
+		{
+			if (m_SegmentOffset > 0)
+			{
+				NextSegment();
+			}
+		}
+
+		void GLESStreamingBuffer::NextSegment()
+		{
+			m_Segment = (m_Segment + 1) % SEGMENT_COUNT;
+			m_SegmentOffset = 0;
+
+			if (m_Segment == 0)
+			{
+				GLESStateCache::BindBuffer(GL_ARRAY_BUFFER, m_ResourceID);
+				glBufferData(GL_ARRAY_BUFFER, m_Size, NULL, GL_STREAM_DRAW);
+			}
+		}
+	}
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "Akkad/Graphics/StreamingBuffer.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		// GLES and WebGL have no persistent mapping, the ring is uploaded with glBufferSubData
+		// and the storage is orphaned each time the ring wraps.
+		class GLESStreamingBuffer : public StreamingBuffer
+		{
+		public:
+			GLESStreamingBuffer(unsigned int size);
+			~GLESStreamingBuffer();
+
+			virtual unsigned int Push(const void* data, unsigned int size) override;
+			virtual void EndFrame() override;
+
+			virtual unsigned int GetID() override { return m_ResourceID; }
+			virtual unsigned int GetSize() override { return m_Size; }
+
+		private:
+			void NextSegment();
+
+			unsigned int m_ResourceID;
+			unsigned int m_Size;
+			unsigned int m_SegmentSize;
+			unsigned int m_Segment = 0;
+			unsigned int m_SegmentOffset = 0;
+		};
+	}
+}
@@ -14,11 +14,12 @@ namespace Akkad {
 			virtual std::string GetName() override { return m_Name; };
 			virtual void SetName(std::string name) override { m_Name = name; };
 
-			virtual void ResetData() override;
-
 			unsigned int GetBindingPoint() { return m_BindingPoint; };
 			virtual void SetReservedBindingPoint(RESERVED_BINDING_POINTS point) override;
 
+		protected:
+			virtual void UploadData(unsigned int offset, unsigned int size) override;
+
 		private:
 			void SetBindingPoint();
 			void CookLayout(); // cooks the layout according to the std140 specs
@@ -11,6 +11,7 @@
 namespace Akkad {
 	namespace Graphics {
 		class VertexBuffer;
+		class StreamingBuffer;
 		struct BufferElement {
 			ShaderDataType type;
 			unsigned int count;
@@ -32,6 +33,20 @@ namespace Akkad {
 			}
 
 			std::vector<BufferElement>& GetElements() { return m_Elements; }
+
+			// packed per instance layout of the 2D quad instancing path :
+			// translation + rotation (vec3), scale (vec2), RGBA8 color (normalized), texture rect (4 x normalized uint16).
+			static VertexBufferLayout CreateQuadInstance2DLayout()
+			{
+				VertexBufferLayout layout;
+				layout.isDynamic = true;
+				layout.isStaticBuffer = true;
+				layout.Push(ShaderDataType::FLOAT, 2, true);
+				layout.Push(ShaderDataType::FLOAT, 4, true);
+				layout.Push(ShaderDataType::UNSIGNED_BYTE, 4, true, true);
+				layout.Push(ShaderDataType::UNSIGNED_SHORT, 4, true, true);
+				return layout;
+			}
 		private:
 			unsigned int m_Stride = 0;
 			std::vector<BufferElement> m_Elements;
@@ -47,6 +62,10 @@ namespace Akkad {
 			virtual void SetSubData(unsigned int offset, const void* data, unsigned int size) = 0;
 			virtual void SetLayout(VertexBufferLayout layout) = 0;
 			virtual void ExtendLayout(SharedPtr<VertexBuffer> vb) = 0;
+			// points the attributes of the layout at the given offset of a streaming buffer instead of this buffer's storage.
+			virtual void SetStreamSource(SharedPtr<StreamingBuffer> stream, unsigned int offset) = 0;
+			// same as SetStreamSource, for the attributes appended by ExtendLayout.
+			virtual void SetExtendedStreamSource(SharedPtr<StreamingBuffer> stream, unsigned int offset) = 0;
 			virtual VertexBufferLayout& GetLayout() = 0;
 		};
 
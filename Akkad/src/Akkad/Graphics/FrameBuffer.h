@@ -3,6 +3,8 @@
 #include "Texture.h"
 
 #include <glm/glm.hpp>
+
+#include <vector>
 namespace Akkad {
 	namespace Graphics {
 
@@ -21,12 +23,44 @@ namespace Akkad {
 		public:
 			virtual void Bind() = 0;
 			virtual void Unbind() = 0;
+			// only records the size, the storage is reallocated on the next Bind() when it no longer fits.
 			virtual void SetSize(unsigned int width, unsigned int height) = 0;
+			// size of the allocated attachments, at least the descriptor size. the content is in its bottom left corner.
+			virtual glm::ivec2 GetStorageSize() = 0;
+			// blocking read of the red channel, stalls until the GPU finished every queued command.
 			virtual glm::vec4 ReadPixels(int x, int y) = 0;
 
+			// queues a read of the red channel of a region and returns its id (0 when the request is refused).
+			// can be called from any thread, the read itself is issued by the next UpdateReadbacks().
+			virtual unsigned int RequestPixels(int x, int y, int width = 1, int height = 1) = 0;
+			// returns true once the request is done and moves its values into pixels, rows go from bottom to top.
+			// pixels outside of the buffer are left out, so a request entirely outside of it completes empty.
+			virtual bool GetRequestedPixels(unsigned int requestID, std::vector<float>& pixels) = 0;
+			// issues the queued reads and collects the finished ones without waiting on the GPU,
+			// call it on the render thread once the content of the buffer is complete for the frame.
+			virtual void UpdateReadbacks() = 0;
+
 			virtual unsigned int GetColorAttachmentTexture() = 0;
 
 			virtual FrameBufferDescriptor& GetDescriptor() = 0;
+
+			// grows the storage to the next power of two so a panel being resized does not reallocate every frame,
+			// it only shrinks back once the size falls to a quarter of it.
+			static unsigned int FitStorageSize(unsigned int size, unsigned int storageSize)
+			{
+				unsigned int newStorageSize = 64;
+				while (newStorageSize < size)
+				{
+					newStorageSize *= 2;
+				}
+
+				if (storageSize >= newStorageSize && storageSize < newStorageSize * 4)
+				{
+					return storageSize;
+				}
+
+				return newStorageSize;
+			}
 		};
 	}
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "Material.h"
 #include "Renderer2D.h"
 #include "RenderPlatform.h"
+#include "RenderThread.h"
 
 #include "Akkad/Logging.h"
 #include "Akkad/Application/Application.h"
@@ -18,36 +19,41 @@ namespace Akkad {
 		void Material::SetShader(std::string assetID)
 		{
 			m_ShaderID = assetID;
+			m_BatchKeyDirty = true;
 
 			auto assetManager = Application::GetAssetManager();
 			m_Shader = assetManager->GetShader(assetID);
 
-			m_Shader->SetUniformBuffer(Renderer2D::GetSystemUniforms());
+			auto shader = m_Shader;
+			RenderThread::Submit([shader]() { shader->SetUniformBuffer(Renderer2D::GetSystemUniforms()); });
 
 		}
 
-		void Material::BindTextures()
+		void Material::ResolveTextures(std::vector<TextureBinding>& bindings)
 		{
-			for (auto it : m_Textures)
+			for (auto& it : m_Textures)
 			{
 				if (!it.second.assetID.empty())
 				{
-					auto texture = Application::GetAssetManager()->GetTexture(it.second.assetID);
-					texture->Bind(it.second.textureBindingUnit);
+					TextureBinding binding;
+					binding.texture = Application::GetAssetManager()->GetTexture(it.second.assetID);
+					binding.textureBindingUnit = it.second.textureBindingUnit;
+					bindings.push_back(binding);
 				}
 			}
 		}
 
-		void Material::BindShaders()
+		void Material::BindShaders(Shader* shader)
 		{
-			if (m_Shader != nullptr)
+			if (shader != nullptr)
 			{
 				if (m_PropertyBuffer != nullptr)
 				{
 					m_PropertyBuffer->SetReservedBindingPoint(UniformBuffer::RESERVED_BINDING_POINTS::MATERIAL_POINT);
-					m_Shader->SetUniformBuffer(m_PropertyBuffer);
+					shader->SetUniformBuffer(m_PropertyBuffer);
+					m_PropertyBuffer->Flush();
 				}
-				m_Shader->Bind();
+				shader->Bind();
 			}
 		}
 
@@ -55,6 +61,7 @@ namespace Akkad {
 		{
 			m_Textures.clear();
 			m_PropertyBuffer.reset();
+			m_BatchKeyDirty = true;
 		}
 
 		bool Material::isValid()
@@ -84,13 +91,85 @@ namespace Akkad {
 			if (HasTexture(samplerName))
 			{
 				auto& textureprop = m_Textures[samplerName];
-				textureprop.assetID = assetID;
+				if (textureprop.assetID != assetID)
+				{
+					textureprop.assetID = assetID;
+					m_BatchKeyDirty = true;
+				}
 				return true;
 			}
 			AK_WARNING("Material doesn't have the specified texture sampler {}", samplerName);
 			return false;
 		}
 
+		uint64_t Material::GetBatchKey()
+		{
+			// cached, every setter of the material marks it dirty.
+			if (m_BatchKeyDirty)
+			{
+				std::hash<std::string> hasher;
+				uint64_t key = hasher(m_ShaderID);
+
+				for (auto& it : m_Textures)
+				{
+					key = (key * 31) ^ hasher(it.second.assetID);
+					key = (key * 31) ^ it.second.textureBindingUnit;
+				}
+
+				key = (key * 31) ^ m_RenderFlags;
+
+				// property values (FNV-1a).
+				uint64_t propertiesKey = 14695981039346656037ull;
+				if (m_PropertyBuffer != nullptr)
+				{
+					for (char byte : m_PropertyBuffer->GetBufferData())
+					{
+						propertiesKey ^= (unsigned char)byte;
+						propertiesKey *= 1099511628211ull;
+					}
+				}
+
+				m_BatchKey = (key * 31) ^ propertiesKey;
+				m_BatchKeyDirty = false;
+			}
+
+			return m_BatchKey;
+		}
+
+		bool Material::IsBatchCompatible(Material& other)
+		{
+			if (this == &other)
+			{
+				return true;
+			}
+
+			if (GetBatchKey() != other.GetBatchKey() || m_ShaderID != other.m_ShaderID || m_RenderFlags != other.m_RenderFlags)
+			{
+				return false;
+			}
+
+			if (m_Textures.size() != other.m_Textures.size())
+			{
+				return false;
+			}
+
+			for (auto it = m_Textures.begin(), otherIt = other.m_Textures.begin(); it != m_Textures.end(); ++it, ++otherIt)
+			{
+				if (it->first != otherIt->first || it->second.assetID != otherIt->second.assetID ||
+					it->second.textureBindingUnit != otherIt->second.textureBindingUnit)
+				{
+					return false;
+				}
+			}
+
+			if (m_PropertyBuffer == nullptr || other.m_PropertyBuffer == nullptr)
+			{
+				return m_PropertyBuffer == other.m_PropertyBuffer;
+			}
+
+			return m_PropertyBuffer->GetBufferData() == other.m_PropertyBuffer->GetBufferData();
+		}
+
 		SharedPtr<Texture> Material::GetTexture(std::string samplerName)
 		{
 			auto it = m_Textures[samplerName];
@@ -242,31 +321,31 @@ namespace Akkad {
 							case ShaderDataType::FLOAT:
 							{
 								float value = props_float[elementName];
-								material->m_PropertyBuffer->SetData(elementName, value);
+								material->SetProperty(elementName, value);
 								break;
 							}
 							case ShaderDataType::FLOAT2:
 							{
 								glm::vec2 value = props_float2[elementName];
-								material->m_PropertyBuffer->SetData(elementName, value);
+								material->SetProperty(elementName, value);
 								break;
 							}
 							case ShaderDataType::FLOAT3:
 							{
 								glm::vec3 value = props_float3[elementName];
-								material->m_PropertyBuffer->SetData(elementName, value);
+								material->SetProperty(elementName, value);
 								break;
 							}
 							case ShaderDataType::FLOAT4:
 							{
 								glm::vec4 value = props_float4[elementName];
-								material->m_PropertyBuffer->SetData(elementName, value);
+								material->SetProperty(elementName, value);
 								break;
 							}
 							case ShaderDataType::UNISGNED_INT:
 							{
 								unsigned int value = props_unsignedints[elementName];
-								material->m_PropertyBuffer->SetData(elementName, value);
+								material->SetProperty(elementName, value);
 								break;
 							}
 							}
@@ -405,7 +484,8 @@ namespace Akkad {
 								}
 							}
 
-							auto propertyBuffer = Application::GetRenderPlatform()->CreateUniformBuffer(uniformLayout);
+							SharedPtr<UniformBuffer> propertyBuffer;
+							RenderThread::Execute([&]() { propertyBuffer = Application::GetRenderPlatform()->CreateUniformBuffer(uniformLayout); });
 
 							propertyBuffer->SetName(BufferName);
 							m_PropertyBuffer = propertyBuffer;
@@ -1,9 +1,12 @@
 #pragma once
 #include "Shader.h"
 #include "Texture.h"
+#include "UniformBuffer.h"
 
 #include <string>
 #include <map>
+#include <cstdint>
+#include <vector>
 
 namespace Akkad {
 	namespace Graphics {
@@ -15,6 +18,12 @@ namespace Akkad {
 			std::string assetID;
 		};
 
+		struct TextureBinding
+		{
+			SharedPtr<Texture> texture;
+			unsigned int textureBindingUnit;
+		};
+
 		class Material
 		{
 		public:
@@ -32,19 +41,38 @@ namespace Akkad {
 			~Material() {};
 
 			void SetShader(std::string assetID);
-			void BindTextures();
-			void BindShaders();
+			// looks the textures up in the asset manager, only on the thread recording the draws.
+			void ResolveTextures(std::vector<TextureBinding>& bindings);
+			// binds the shader resolved when the draw was recorded along with the property buffer.
+			void BindShaders(Shader* shader);
 			void ClearResources();
 			bool isValid();
 			bool HasTexture(std::string samplerName);
 			bool SetTexture(std::string samplerName, std::string assetID);
 
 			unsigned int GetRenderFlags() { return m_RenderFlags; };
-			void SetRenderFlags(unsigned int flags) { m_RenderFlags = flags; };
-			void AppendRenderFlag(unsigned int flag) { m_RenderFlags |= flag; };
-			void ClearRenderFlags() { m_RenderFlags = 0; };
+			void SetRenderFlags(unsigned int flags) { m_RenderFlags = flags; m_BatchKeyDirty = true; };
+			void AppendRenderFlag(unsigned int flag) { m_RenderFlags |= flag; m_BatchKeyDirty = true; };
+			void ClearRenderFlags() { m_RenderFlags = 0; m_BatchKeyDirty = true; };
+
+			// materials that share a shader, a texture set, render flags and property values
+			// return the same key, so the renderer can draw them in a single instanced batch.
+			uint64_t GetBatchKey();
+			// compares what the batch key hashes, two different materials with the same content can share a batch.
+			bool IsBatchCompatible(Material& other);
+
+			// property values go through here so the batch key is hashed again.
+			template<typename T>
+			void SetProperty(const std::string& name, T& value)
+			{
+				if (m_PropertyBuffer != nullptr && m_PropertyBuffer->SetData(name, value))
+				{
+					m_BatchKeyDirty = true;
+				}
+			}
 
 			SharedPtr<Texture> GetTexture(std::string samplerName);
+			SharedPtr<Shader> GetShader() { return m_Shader; }
 			std::string GetName() { return m_Name; }
 			std::string GetShaderID() { return m_ShaderID; }
 			std::string GetTextureID(std::string samplerName);
@@ -65,6 +93,9 @@ namespace Akkad {
 			std::string m_ShaderID;
 			unsigned int m_RenderFlags = 0;
 
+			uint64_t m_BatchKey = 0;
+			bool m_BatchKeyDirty = true;
+
 			static std::string DEFAULT_PROPERTY_BUFFER_NAME;
 
 
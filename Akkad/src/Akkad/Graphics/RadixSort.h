@@ -0,0 +1,62 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Akkad {
+	namespace Graphics {
+
+		// LSD radix sort on a 64 bit "key" member, 8 bits per pass. the sort is stable, and passes where every
+		// key shares the same byte are skipped, which is the common case for the high bytes of render keys.
+		template<typename T>
+		void RadixSort(std::vector<T>& keys, std::vector<T>& scratch)
+		{
+			if (keys.size() < 2)
+			{
+				return;
+			}
+
+			scratch.resize(keys.size());
+
+			T* source = keys.data();
+			T* destination = scratch.data();
+			size_t count = keys.size();
+
+			for (unsigned int shift = 0; shift < 64; shift += 8)
+			{
+				size_t histogram[256] = {};
+				for (size_t i = 0; i < count; i++)
+				{
+					histogram[(source[i].key >> shift) & 0xFF]++;
+				}
+
+				// every key has the same byte, the pass would not move anything.
+				if (histogram[(source[0].key >> shift) & 0xFF] == count)
+				{
+					continue;
+				}
+
+				size_t offset = 0;
+				for (unsigned int i = 0; i < 256; i++)
+				{
+					size_t bucketSize = histogram[i];
+					histogram[i] = offset;
+					offset += bucketSize;
+				}
+
+				for (size_t i = 0; i < count; i++)
+				{
+					destination[histogram[(source[i].key >> shift) & 0xFF]++] = source[i];
+				}
+
+				std::swap(source, destination);
+			}
+
+			if (source != keys.data())
+			{
+				std::copy(source, source + count, keys.data());
+			}
+		}
+	}
+}
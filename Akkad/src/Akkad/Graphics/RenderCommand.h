@@ -20,6 +20,12 @@ namespace Akkad {
 			INVERSE_SRC_ALPHA, ONE
 		};
 
+		// calls that reached the driver and calls dropped because the state was already set.
+		struct StateCacheStats {
+			unsigned int issuedCalls = 0;
+			unsigned int elidedCalls = 0;
+		};
+
 		class RenderCommand
 		{
 		public:
@@ -33,6 +39,11 @@ namespace Akkad {
 			virtual void DisableBlending() = 0;
 			virtual void SetBlendState(BlendSourceFactor sfactor, BlendDestFactor dfactor) = 0;
 			virtual void DrawElementsInstanced(PrimitiveType type, unsigned int count, unsigned int amount) = 0;
+
+			// counters of the last finished frame.
+			virtual StateCacheStats GetStateCacheStats() = 0;
+			// closes the counters of the frame, called after presenting.
+			virtual void EndFrame() = 0;
 		};
 	}
 }
@@ -4,8 +4,9 @@
 namespace Akkad {
 	namespace Graphics {
 
+		// NONE is the headless null platform, see API/Null/NullPlatform.h.
 		enum class RenderAPI {
-			OPENGL, OPENGLES
+			OPENGL, OPENGLES, NONE
 		};
 
 		class RenderContext
@@ -15,6 +16,11 @@ namespace Akkad {
 			virtual void SwapWindowBuffers() = 0;
 			virtual void SetVsync(bool status) = 0;
 
+			// used to hand the context over to the render thread.
+			virtual bool SupportsThreadedRendering() { return false; }
+			virtual void MakeCurrent() {}
+			virtual void ReleaseCurrent() {}
+
 			static SharedPtr<RenderContext> Create();
 		};
 	}
@@ -1,6 +1,7 @@
 #include "RenderPlatform.h"
 #include "API/OpenGL/OpenGLPlatform.h"
 #include "API/OpenGLES/GLESPlatform.h"
+#include "API/Null/NullPlatform.h"
 
 #include "Akkad/PlatformMacros.h"
 namespace Akkad {
@@ -10,18 +11,19 @@ namespace Akkad {
 			switch (api)
 			{
 			case RenderAPI::OPENGL:
-				#if defined(AK_PLATFORM_WINDOWS)
+				#if defined(AK_PLATFORM_WINDOWS) || defined(AK_PLATFORM_LINUX)
 				return CreateSharedPtr<OpenGLPlatform>();
 				#else
 				return nullptr;
-				#endif // AK_PLATFORM_WINDOWS
+				#endif // AK_PLATFORM_WINDOWS || AK_PLATFORM_LINUX
 			case RenderAPI::OPENGLES:
 				#if defined(AK_PLATFORM_WEB) 
 				return CreateSharedPtr<GLESPlatform>();
 				#else
 				return nullptr;
 				#endif // AK_PLATFORM_WEB
-
+			case RenderAPI::NONE:
+				return CreateSharedPtr<NullPlatform>();
 
 			default:
 				break;
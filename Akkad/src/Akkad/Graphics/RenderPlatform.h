@@ -1,12 +1,14 @@
 #pragma once
 #include "Akkad/core.h"
 #include "Buffer.h"
+#include "StreamingBuffer.h"
 #include "UniformBuffer.h"
 #include "Shader.h"
 #include "Texture.h"
 #include "RenderCommand.h"
 #include "FrameBuffer.h"
 #include "RenderContext.h"
+#include "RenderTargetPool.h"
 
 namespace Akkad {
 	namespace Graphics {
@@ -28,8 +30,17 @@ namespace Akkad {
 			virtual SharedPtr<Texture> CreateTexture(const char* path, float tileWidth, float tileHeight) = 0;
 			virtual SharedPtr<FrameBuffer> CreateFrameBuffer(FrameBufferDescriptor desc) = 0;
 			virtual SharedPtr<UniformBuffer> CreateUniformBuffer(UniformBufferLayout layout) = 0;
+			virtual SharedPtr<StreamingBuffer> CreateStreamingBuffer(unsigned int size) = 0;
+
+			// pooled frame buffers, use these for render targets that are resized or recreated often.
+			SharedPtr<FrameBuffer> AcquireRenderTarget(FrameBufferDescriptor desc) { return m_RenderTargetPool.Acquire(this, desc); }
+			void ReleaseRenderTarget(const SharedPtr<FrameBuffer>& target) { m_RenderTargetPool.Release(target); }
+			RenderTargetPool& GetRenderTargetPool() { return m_RenderTargetPool; }
 
 			static SharedPtr<RenderPlatform> Create(RenderAPI api);
+
+		private:
+			RenderTargetPool m_RenderTargetPool;
 		};
 	}
 }
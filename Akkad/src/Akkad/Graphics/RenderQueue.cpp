@@ -0,0 +1,257 @@
+#include "RenderQueue.h"
+#include "Buffer.h"
+#include "Shader.h"
+#include "Material.h"
+#include "Texture.h"
+#include "RenderStats.h"
+
+#include "Akkad/Profiling/Profiler.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		uint64_t RenderQueue::CreateSortKey(RenderPass pass, uint32_t drawOrder, BlendMode blend, uint64_t stateKey)
+		{
+			return ((uint64_t)pass << 62) | ((uint64_t)drawOrder << 30) | ((uint64_t)blend << 28) | (stateKey & 0x0FFFFFFF);
+		}
+
+		uint64_t RenderQueue::CreateStateKey(const void* shader, const void* texture)
+		{
+			// only used to group packets, collisions cost a state change, not a wrong draw.
+			uint64_t key = (uint64_t)(uintptr_t)shader * 0x9E3779B97F4A7C15ull;
+			key ^= (uint64_t)(uintptr_t)texture * 0xC2B2AE3D27D4EB4Full;
+
+			return key ^ (key >> 28) ^ (key >> 56);
+		}
+
+		RenderPacket& RenderQueue::Submit(uint64_t key)
+		{
+			SortKey sortKey;
+			sortKey.key = key;
+			sortKey.index = (uint32_t)m_Packets.size();
+			m_Keys.push_back(sortKey);
+
+			m_Packets.emplace_back();
+			auto& packet = m_Packets.back();
+			packet.firstUniform = (unsigned int)m_Uniforms.size();
+
+			return packet;
+		}
+
+		void RenderQueue::SetMaterial(RenderPacket& packet, const SharedPtr<Material>& material)
+		{
+			AK_ASSERT(&packet == &m_Packets.back(), "a material can only be set on the last submitted packet !");
+
+			auto& batchMaterial = m_BatchMaterials[material->GetBatchKey()];
+			if (batchMaterial == nullptr)
+			{
+				batchMaterial = material;
+			}
+
+			// a key collision keeps the packet's own material.
+			packet.material = batchMaterial->IsBatchCompatible(*material) ? batchMaterial : material;
+			packet.shader = packet.material->GetShader();
+			packet.firstTexture = (unsigned int)m_TextureBindings.size();
+
+			packet.material->ResolveTextures(m_TextureBindings);
+			packet.textureCount = (unsigned int)m_TextureBindings.size() - packet.firstTexture;
+		}
+
+		void RenderQueue::SetVertexData(RenderPacket& packet, SharedPtr<StreamingBuffer> stream, const void* data, unsigned int size)
+		{
+			packet.stream = stream;
+			packet.vertexDataOffset = (unsigned int)m_VertexData.size();
+			packet.vertexDataSize = size;
+
+			const unsigned char* bytes = (const unsigned char*)data;
+			m_VertexData.insert(m_VertexData.end(), bytes, bytes + size);
+		}
+
+		void RenderQueue::PushUniform(RenderPacket& packet, UniformBuffer* buffer, unsigned int offset, const void* data, unsigned int size)
+		{
+			AK_ASSERT(&packet == &m_Packets.back(), "uniforms can only be added to the last submitted packet !");
+
+			UniformWrite write;
+			write.buffer = buffer;
+			write.offset = offset;
+			write.size = size;
+			write.dataOffset = (unsigned int)m_UniformData.size();
+
+			const unsigned char* bytes = (const unsigned char*)data;
+			m_UniformData.insert(m_UniformData.end(), bytes, bytes + size);
+
+			m_Uniforms.push_back(write);
+			packet.uniformCount++;
+		}
+
+		void RenderQueue::Execute(RenderCommand* command)
+		{
+			if (m_Packets.empty())
+			{
+				return;
+			}
+
+			AK_PROFILE_SCOPE("RenderQueue::Execute");
+			RenderStats::AddRenderPackets((unsigned int)m_Packets.size());
+
+			// sorting a copy keeps the submission order around, so the queue can be replayed.
+			m_SortedKeys = m_Keys;
+			RadixSort(m_SortedKeys, m_SortScratch);
+
+			Shader* currentShader = nullptr;
+			Material* currentMaterial = nullptr;
+			Texture* currentTexture = nullptr;
+
+			// the state left by the previous frame is unknown, the first packet always sets it.
+			BlendMode currentBlend = BlendMode::NONE;
+			PolygonMode currentPolygonMode = PolygonMode::FILL;
+			bool stateKnown = false;
+
+			for (auto& sortKey : m_SortedKeys)
+			{
+				auto& packet = m_Packets[sortKey.index];
+
+				if (!stateKnown || packet.blend != currentBlend)
+				{
+					ApplyBlendMode(command, packet.blend);
+					currentBlend = packet.blend;
+				}
+
+				if (!stateKnown || packet.polygonMode != currentPolygonMode)
+				{
+					command->SetPolygonMode(packet.polygonMode);
+					currentPolygonMode = packet.polygonMode;
+				}
+
+				stateKnown = true;
+
+				if (packet.material != nullptr)
+				{
+					// materials with the same content share one instance since SetMaterial(), comparing addresses is enough.
+					if (packet.material.get() != currentMaterial)
+					{
+						packet.material->BindShaders(packet.shader.get());
+
+						for (unsigned int i = 0; i < packet.textureCount; i++)
+						{
+							auto& binding = m_TextureBindings[packet.firstTexture + i];
+							binding.texture->Bind(binding.textureBindingUnit);
+						}
+
+						currentMaterial = packet.material.get();
+						// the material binds its own program and texture units.
+						currentShader = nullptr;
+						currentTexture = nullptr;
+					}
+				}
+
+				else if (packet.shader != nullptr && packet.shader.get() != currentShader)
+				{
+					packet.shader->Bind();
+					currentShader = packet.shader.get();
+					currentMaterial = nullptr;
+				}
+
+				if (packet.texture != nullptr && packet.texture.get() != currentTexture)
+				{
+					packet.texture->Bind(0);
+					currentTexture = packet.texture.get();
+				}
+
+				for (unsigned int i = 0; i < packet.uniformCount; i++)
+				{
+					auto& write = m_Uniforms[packet.firstUniform + i];
+					write.buffer->SetRawData(write.offset, &m_UniformData[write.dataOffset], write.size);
+				}
+
+				// one upload per buffer for all the writes of the packet, a buffer already flushed is skipped.
+				for (unsigned int i = 0; i < packet.uniformCount; i++)
+				{
+					m_Uniforms[packet.firstUniform + i].buffer->Flush();
+				}
+
+				if (packet.vertexBuffer != nullptr)
+				{
+					if (packet.stream != nullptr)
+					{
+						unsigned int streamOffset = packet.stream->Push(&m_VertexData[packet.vertexDataOffset], packet.vertexDataSize);
+						if (streamOffset == StreamingBuffer::INVALID_OFFSET)
+						{
+							// the vertices never reached the GPU, drawing would read the data of another draw.
+							continue;
+						}
+
+						if (packet.streamExtended)
+						{
+							packet.vertexBuffer->SetExtendedStreamSource(packet.stream, streamOffset);
+						}
+						else
+						{
+							packet.vertexBuffer->SetStreamSource(packet.stream, streamOffset);
+						}
+					}
+
+					packet.vertexBuffer->Bind();
+				}
+
+				if (packet.indexBuffer != nullptr)
+				{
+					packet.indexBuffer->Bind();
+				}
+
+				switch (packet.drawType)
+				{
+				case DrawType::ARRAYS:
+					command->DrawArrays(packet.primitive, packet.count);
+					break;
+				case DrawType::INDEXED:
+					command->DrawIndexed(packet.primitive, packet.count);
+					break;
+				case DrawType::INSTANCED:
+					command->DrawElementsInstanced(packet.primitive, packet.count, packet.instanceCount);
+					break;
+				}
+			}
+
+			// leave the defaults the rest of the engine expects.
+			if (currentBlend != BlendMode::NONE)
+			{
+				ApplyBlendMode(command, BlendMode::NONE);
+			}
+
+			if (currentPolygonMode != PolygonMode::FILL)
+			{
+				command->SetPolygonMode(PolygonMode::FILL);
+			}
+		}
+
+		void RenderQueue::Clear()
+		{
+			m_Packets.clear();
+			m_Uniforms.clear();
+			m_TextureBindings.clear();
+			m_BatchMaterials.clear();
+			m_UniformData.clear();
+			m_VertexData.clear();
+			m_Keys.clear();
+		}
+
+		void RenderQueue::ApplyBlendMode(RenderCommand* command, BlendMode blend)
+		{
+			switch (blend)
+			{
+			case BlendMode::NONE:
+				command->DisableBlending();
+				break;
+			case BlendMode::ALPHA:
+				command->EnableBlending();
+				command->SetBlendState(BlendSourceFactor::ALPHA, BlendDestFactor::INVERSE_SRC_ALPHA);
+				break;
+			case BlendMode::ADDITIVE:
+				command->EnableBlending();
+				command->SetBlendState(BlendSourceFactor::ALPHA, BlendDestFactor::ONE);
+				break;
+			}
+		}
+	}
+}
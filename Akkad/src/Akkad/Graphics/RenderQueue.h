@@ -0,0 +1,137 @@
+#pragma once
+#include "RenderCommand.h"
+#include "Material.h"
+#include "StreamingBuffer.h"
+#include "UniformBuffer.h"
+#include "RadixSort.h"
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace Akkad {
+	namespace Graphics {
+
+		class VertexBuffer;
+		class IndexBuffer;
+
+		enum class RenderPass {
+			SCENE, OVERLAY
+		};
+
+		enum class BlendMode {
+			NONE, ALPHA, ADDITIVE
+		};
+
+		enum class DrawType {
+			ARRAYS, INDEXED, INSTANCED
+		};
+
+		// a value written to a uniform buffer right before the packet that owns it is drawn.
+		struct UniformWrite
+		{
+			UniformBuffer* buffer;
+			unsigned int offset;
+			unsigned int size;
+			unsigned int dataOffset; // into the queue's uniform data
+		};
+
+		struct RenderPacket
+		{
+			DrawType drawType = DrawType::INDEXED;
+			PrimitiveType primitive = PrimitiveType::TRIANGLE;
+			unsigned int count = 0;
+			unsigned int instanceCount = 0;
+
+			VertexBuffer* vertexBuffer = nullptr;
+			IndexBuffer* indexBuffer = nullptr;
+
+			// when set, the packet's vertex data is pushed to the stream and the vertex buffer reads it from there.
+			SharedPtr<StreamingBuffer> stream;
+			unsigned int vertexDataOffset = 0;
+			unsigned int vertexDataSize = 0;
+			bool streamExtended = false;
+
+			// everything is resolved and kept alive by the recording thread, the render thread never goes
+			// through the asset manager. a material packet binds the shader with the material's property buffer.
+			SharedPtr<Material> material;
+			SharedPtr<Shader> shader;
+			SharedPtr<Texture> texture; // bound to unit 0
+
+			// the textures of the material, into the queue's texture bindings.
+			unsigned int firstTexture = 0;
+			unsigned int textureCount = 0;
+
+			BlendMode blend = BlendMode::NONE;
+			PolygonMode polygonMode = PolygonMode::FILL;
+
+			unsigned int firstUniform = 0;
+			unsigned int uniformCount = 0;
+		};
+
+		// deferred draw list sitting in front of RenderCommand. draws are recorded as packets with a 64 bit key :
+		// bits 62-63 : pass, bits 30-61 : draw order, bits 28-29 : blend mode, bits 0-27 : shader / texture / material.
+		// Execute() sorts the keys and replays the packets, skipping redundant state changes and uniform uploads.
+		// packets sharing a key keep their submission order. recording does not touch the GPU : vertex data is
+		// copied into the queue and only pushed to the stream on execution, so a queue can be recorded on one
+		// thread, executed on the render thread, and replayed as many times as needed.
+		class RenderQueue
+		{
+		public:
+			static uint64_t CreateSortKey(RenderPass pass, uint32_t drawOrder, BlendMode blend, uint64_t stateKey);
+			static uint64_t CreateStateKey(const void* shader, const void* texture);
+
+			RenderPacket& Submit(uint64_t key);
+
+			// the packet must be the last one submitted.
+			template<typename T>
+			void SetUniform(RenderPacket& packet, UniformBuffer* buffer, const UniformBufferField& field, const T& data)
+			{
+				AK_ASSERT(field.IsValid() && field.size == sizeof(T), "uniform value does not match the buffer field !");
+				PushUniform(packet, buffer, field.offset, &data, sizeof(T));
+			}
+
+			// writes a whole typed block, see UniformBlock.h.
+			template<typename Block>
+			void SetUniformBlock(RenderPacket& packet, UniformBuffer* buffer, const Block& block)
+			{
+				static_assert(IsStd140Layout<Block>(), "uniform block does not follow the std140 layout !");
+				PushUniform(packet, buffer, 0, &block, GetUniformBlockSize<Block>());
+			}
+
+			// resolves the shader and textures of the material now, the packet must be the last one submitted.
+			// materials with the same content are replaced by the first one recorded, so Execute() binds it once.
+			void SetMaterial(RenderPacket& packet, const SharedPtr<Material>& material);
+
+			// copies the data into the queue, it is pushed to the stream right before the packet is drawn.
+			void SetVertexData(RenderPacket& packet, SharedPtr<StreamingBuffer> stream, const void* data, unsigned int size);
+
+			void Execute(RenderCommand* command);
+			void Clear();
+
+			unsigned int GetPacketCount() { return (unsigned int)m_Packets.size(); }
+
+		private:
+			struct SortKey
+			{
+				uint64_t key;
+				uint32_t index;
+			};
+
+			void PushUniform(RenderPacket& packet, UniformBuffer* buffer, unsigned int offset, const void* data, unsigned int size);
+			void ApplyBlendMode(RenderCommand* command, BlendMode blend);
+
+			std::vector<RenderPacket> m_Packets;
+			std::vector<UniformWrite> m_Uniforms;
+			std::vector<TextureBinding> m_TextureBindings;
+			// first material recorded for a batch key.
+			std::unordered_map<uint64_t, SharedPtr<Material>> m_BatchMaterials;
+			std::vector<unsigned char> m_UniformData;
+			std::vector<unsigned char> m_VertexData;
+			std::vector<SortKey> m_Keys;
+			std::vector<SortKey> m_SortedKeys;
+			std::vector<SortKey> m_SortScratch;
+		};
+	}
+}
@@ -0,0 +1,95 @@
+#include "RenderStats.h"
+
+#include <json.hpp>
+
+namespace Akkad {
+	namespace Graphics {
+
+		RenderStats RenderStats::s_Instance;
+
+		void RenderStats::AddDrawImpl(unsigned int vertexCount, unsigned int instanceCount)
+		{
+			m_Frame.drawCalls++;
+
+			if (instanceCount > 0)
+			{
+				m_Frame.instancedDrawCalls++;
+				m_Frame.instances += instanceCount;
+				m_Frame.vertices += vertexCount * instanceCount;
+			}
+			else
+			{
+				m_Frame.vertices += vertexCount;
+			}
+		}
+
+		void RenderStats::AddBufferUploadImpl(unsigned int size)
+		{
+			m_Frame.bufferUploads++;
+			m_Frame.bufferBytesUploaded += size;
+		}
+
+		void RenderStats::EndFrameImpl()
+		{
+			uint64_t frame = m_Frame.frame;
+
+			{
+				std::lock_guard<std::mutex> lock(m_LastFrameMutex);
+				m_LastFrame = m_Frame;
+			}
+
+			m_Frame = RenderFrameStats();
+			m_Frame.frame = frame + 1;
+		}
+
+		RenderFrameStats RenderStats::GetLastFrameImpl()
+		{
+			std::lock_guard<std::mutex> lock(m_LastFrameMutex);
+			return m_LastFrame;
+		}
+
+		std::string RenderStats::GetCSVHeader()
+		{
+			return "frame,drawCalls,instancedDrawCalls,instances,vertices,renderPackets,stateChanges,elidedStateChanges,"
+				"textureBinds,bufferUploads,bufferBytesUploaded,uniformUploads,framebufferResizes";
+		}
+
+		std::string RenderStats::ToCSV(const RenderFrameStats& stats)
+		{
+			std::string row;
+			row += std::to_string(stats.frame) + ",";
+			row += std::to_string(stats.drawCalls) + ",";
+			row += std::to_string(stats.instancedDrawCalls) + ",";
+			row += std::to_string(stats.instances) + ",";
+			row += std::to_string(stats.vertices) + ",";
+			row += std::to_string(stats.renderPackets) + ",";
+			row += std::to_string(stats.stateChanges) + ",";
+			row += std::to_string(stats.elidedStateChanges) + ",";
+			row += std::to_string(stats.textureBinds) + ",";
+			row += std::to_string(stats.bufferUploads) + ",";
+			row += std::to_string(stats.bufferBytesUploaded) + ",";
+			row += std::to_string(stats.uniformUploads) + ",";
+			row += std::to_string(stats.framebufferResizes);
+			return row;
+		}
+
+		std::string RenderStats::ToJSON(const RenderFrameStats& stats)
+		{
+			nlohmann::json json;
+			json["frame"] = stats.frame;
+			json["drawCalls"] = stats.drawCalls;
+			json["instancedDrawCalls"] = stats.instancedDrawCalls;
+			json["instances"] = stats.instances;
+			json["vertices"] = stats.vertices;
+			json["renderPackets"] = stats.renderPackets;
+			json["stateChanges"] = stats.stateChanges;
+			json["elidedStateChanges"] = stats.elidedStateChanges;
+			json["textureBinds"] = stats.textureBinds;
+			json["bufferUploads"] = stats.bufferUploads;
+			json["bufferBytesUploaded"] = stats.bufferBytesUploaded;
+			json["uniformUploads"] = stats.uniformUploads;
+			json["framebufferResizes"] = stats.framebufferResizes;
+			return json.dump();
+		}
+	}
+}
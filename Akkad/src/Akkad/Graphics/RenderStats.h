@@ -0,0 +1,73 @@
+#pragma once
+#include "Akkad/core.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace Akkad {
+	namespace Graphics {
+
+		// what the GPU was asked to do during one frame.
+		struct RenderFrameStats {
+			uint64_t frame = 0; // numbered from 1, 0 until a frame is finished
+
+			unsigned int drawCalls = 0; // instanced draws included
+			unsigned int instancedDrawCalls = 0;
+			unsigned int instances = 0;
+			unsigned int vertices = 0; // indices for indexed draws, times the instance count
+			unsigned int renderPackets = 0;
+
+			unsigned int stateChanges = 0;
+			unsigned int elidedStateChanges = 0;
+			unsigned int textureBinds = 0;
+
+			unsigned int bufferUploads = 0;
+			uint64_t bufferBytesUploaded = 0; // uniform uploads included
+			unsigned int uniformUploads = 0;
+
+			unsigned int framebufferResizes = 0;
+		};
+
+		// per frame counters of the renderer and the GL backends. the counters are only written by the thread
+		// owning the context, the last finished frame can be read from any thread.
+		class RenderStats
+		{
+		public:
+			static RenderStats& GetInstance() { return s_Instance; }
+
+			static void AddDraw(unsigned int vertexCount) { GetInstance().AddDrawImpl(vertexCount, 0); }
+			static void AddInstancedDraw(unsigned int vertexCount, unsigned int instanceCount) { GetInstance().AddDrawImpl(vertexCount, instanceCount); }
+			static void AddRenderPackets(unsigned int count) { GetInstance().m_Frame.renderPackets += count; }
+			static void AddTextureBind() { GetInstance().m_Frame.textureBinds++; }
+			static void AddBufferUpload(unsigned int size) { GetInstance().AddBufferUploadImpl(size); }
+			static void AddUniformUpload(unsigned int size) { GetInstance().m_Frame.uniformUploads++; GetInstance().AddBufferUploadImpl(size); }
+			static void AddFramebufferResize() { GetInstance().m_Frame.framebufferResizes++; }
+			static void SetStateChanges(unsigned int issued, unsigned int elided) { GetInstance().m_Frame.stateChanges = issued; GetInstance().m_Frame.elidedStateChanges = elided; }
+
+			// closes the counters of the frame, called after presenting.
+			static void EndFrame() { GetInstance().EndFrameImpl(); }
+			static RenderFrameStats GetLastFrame() { return GetInstance().GetLastFrameImpl(); }
+
+			static std::string GetCSVHeader();
+			static std::string ToCSV(const RenderFrameStats& stats);
+			static std::string ToJSON(const RenderFrameStats& stats);
+
+		private:
+			RenderStats() { m_Frame.frame = 1; };
+			~RenderStats() {};
+
+			static RenderStats s_Instance;
+
+			void AddDrawImpl(unsigned int vertexCount, unsigned int instanceCount);
+			void AddBufferUploadImpl(unsigned int size);
+			void EndFrameImpl();
+			RenderFrameStats GetLastFrameImpl();
+
+			RenderFrameStats m_Frame;
+
+			std::mutex m_LastFrameMutex;
+			RenderFrameStats m_LastFrame;
+		};
+	}
+}
@@ -0,0 +1,90 @@
+#include "RenderTargetPool.h"
+#include "RenderPlatform.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		SharedPtr<FrameBuffer> RenderTargetPool::Acquire(RenderPlatform* platform, FrameBufferDescriptor desc)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			// prefer a target whose storage already fits, it can be reused without reallocating.
+			PooledTarget* match = nullptr;
+			for (auto& pooled : m_Targets)
+			{
+				if (pooled.inUse || !IsCompatible(pooled.target->GetDescriptor(), desc))
+				{
+					continue;
+				}
+
+				glm::ivec2 storageSize = pooled.target->GetStorageSize();
+				bool fits = storageSize.x >= desc.width && storageSize.y >= desc.height;
+
+				if (match == nullptr || fits)
+				{
+					match = &pooled;
+				}
+
+				if (fits)
+				{
+					break;
+				}
+			}
+
+			if (match != nullptr)
+			{
+				match->inUse = true;
+				match->target->SetSize(desc.width, desc.height);
+				return match->target;
+			}
+
+			PooledTarget pooled;
+			pooled.target = platform->CreateFrameBuffer(desc);
+			pooled.inUse = true;
+			m_Targets.push_back(pooled);
+
+			return pooled.target;
+		}
+
+		void RenderTargetPool::Release(const SharedPtr<FrameBuffer>& target)
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			for (auto& pooled : m_Targets)
+			{
+				if (pooled.target == target)
+				{
+					pooled.inUse = false;
+					return;
+				}
+			}
+		}
+
+		void RenderTargetPool::Clear()
+		{
+			std::lock_guard<std::mutex> lock(m_Mutex);
+
+			auto it = m_Targets.begin();
+			while (it != m_Targets.end())
+			{
+				if (!it->inUse)
+				{
+					it = m_Targets.erase(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+		}
+
+		bool RenderTargetPool::IsCompatible(FrameBufferDescriptor& a, FrameBufferDescriptor& b)
+		{
+			return a.hasColorAttachment == b.hasColorAttachment &&
+				a.hasDepthAttachment == b.hasDepthAttachment &&
+				a.hasStencilAttachment == b.hasStencilAttachment &&
+				a.usesRenderBuffer == b.usesRenderBuffer &&
+				a.ColorAttachmentFormat == b.ColorAttachmentFormat;
+		}
+	}
+}
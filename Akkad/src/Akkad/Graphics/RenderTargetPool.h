@@ -0,0 +1,38 @@
+#pragma once
+#include "Akkad/core.h"
+#include "FrameBuffer.h"
+
+#include <mutex>
+#include <vector>
+
+namespace Akkad {
+	namespace Graphics {
+
+		class RenderPlatform;
+
+		// frame buffers handed out by descriptor. a released target goes back to the pool and is given to the
+		// next request with the same attachments, its size is changed through the deferred FrameBuffer::SetSize.
+		class RenderTargetPool
+		{
+		public:
+			SharedPtr<FrameBuffer> Acquire(RenderPlatform* platform, FrameBufferDescriptor desc);
+			void Release(const SharedPtr<FrameBuffer>& target);
+
+			// frees the targets nobody holds, the ones in use stay alive through their owners.
+			void Clear();
+
+			unsigned int GetTargetCount() { return (unsigned int)m_Targets.size(); }
+
+		private:
+			struct PooledTarget {
+				SharedPtr<FrameBuffer> target;
+				bool inUse;
+			};
+
+			static bool IsCompatible(FrameBufferDescriptor& a, FrameBufferDescriptor& b);
+
+			std::mutex m_Mutex;
+			std::vector<PooledTarget> m_Targets;
+		};
+	}
+}
@@ -0,0 +1,150 @@
+#include "RenderThread.h"
+#include "RenderPlatform.h"
+#include "Renderer2D.h"
+
+#include "Akkad/Application/Application.h"
+#include "Akkad/Logging.h"
+#include "Akkad/Profiling/Profiler.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		RenderThread RenderThread::s_Instance;
+
+		void RenderThread::StartImpl()
+		{
+			if (m_Running)
+			{
+				return;
+			}
+
+			auto context = Application::GetRenderPlatform()->GetRenderContext();
+			if (!context->SupportsThreadedRendering())
+			{
+				AK_WARNING("the render context can not be shared with another thread, rendering stays on the main thread.");
+				return;
+			}
+
+			m_StopRequested = false;
+			m_Running = true;
+			m_ProducerThread = std::this_thread::get_id();
+
+			// a context can only be current on one thread at a time.
+			context->ReleaseCurrent();
+			m_Thread = std::thread(&RenderThread::ThreadLoop, this);
+		}
+
+		void RenderThread::StopImpl()
+		{
+			if (!m_Running)
+			{
+				return;
+			}
+
+			SyncImpl();
+
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_StopRequested = true;
+			}
+
+			m_JobAvailable.notify_one();
+			m_Thread.join();
+			m_Running = false;
+
+			Application::GetRenderPlatform()->GetRenderContext()->MakeCurrent();
+		}
+
+		void RenderThread::SubmitImpl(Job job)
+		{
+			// jobs submitted from a job (scene loading) run right away.
+			if (!m_Running || std::this_thread::get_id() == m_Thread.get_id())
+			{
+				job();
+				return;
+			}
+
+			AK_ASSERT(std::this_thread::get_id() == m_ProducerThread, "render jobs can only be submitted by the thread that started the render thread !");
+			m_Jobs.enqueue(std::move(job));
+			m_SubmittedJobs++;
+
+			// taking the lock orders the enqueue with the wait predicate, so the wake up can not be lost.
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+			}
+
+			m_JobAvailable.notify_one();
+		}
+
+		void RenderThread::SyncImpl()
+		{
+			if (!m_Running || std::this_thread::get_id() == m_Thread.get_id())
+			{
+				return;
+			}
+
+			AK_PROFILE_SCOPE("RenderThread::Sync");
+			uint64_t target = m_SubmittedJobs;
+
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_JobCompleted.wait(lock, [this, target]() { return m_CompletedJobs >= target; });
+		}
+
+		void RenderThread::EndFrameImpl()
+		{
+			m_FramesInFlight++;
+
+			SubmitImpl([this]()
+			{
+				AK_PROFILE_SCOPE("RenderThread::Present");
+				Application::GetRenderPlatform()->GetRenderContext()->SwapWindowBuffers();
+				Renderer2D::EndFrame();
+				m_FramesInFlight--;
+			});
+
+			if (m_Running)
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_JobCompleted.wait(lock, [this]() { return m_FramesInFlight < MAX_FRAMES_IN_FLIGHT; });
+			}
+		}
+
+		void RenderThread::ThreadLoop()
+		{
+			AK_PROFILE_THREAD("Render Thread");
+
+			auto context = Application::GetRenderPlatform()->GetRenderContext();
+			context->MakeCurrent();
+
+			while (true)
+			{
+				Job job;
+				if (m_Jobs.try_dequeue(job))
+				{
+					{
+						AK_PROFILE_SCOPE("RenderThread::Job");
+						job();
+					}
+
+					{
+						std::lock_guard<std::mutex> lock(m_Mutex);
+						m_CompletedJobs++;
+					}
+
+					m_JobCompleted.notify_all();
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				if (m_StopRequested && m_Jobs.size_approx() == 0)
+				{
+					break;
+				}
+
+				m_JobAvailable.wait(lock, [this]() { return m_Jobs.size_approx() > 0 || m_StopRequested; });
+			}
+
+			context->ReleaseCurrent();
+		}
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Akkad/core.h"
+
+#include <concurrentqueue.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Akkad {
+	namespace Graphics {
+
+		// optional thread owning the graphics context. the main thread records frame N+1 while the render thread
+		// executes the jobs of frame N, at most MAX_FRAMES_IN_FLIGHT frames are queued before EndFrame() blocks.
+		// while it is not running every job is executed inline, so callers do not need to check IsRunning().
+		// any GPU work issued outside of Renderer2D (frame buffer binds, reads, resource creation) has to go
+		// through Submit() or Execute() once the thread is started.
+		// the queue only keeps FIFO order per producer, so jobs are submitted by the thread that started the
+		// render thread and by the render thread itself (which runs them inline), never by other threads.
+		class RenderThread
+		{
+		public:
+			enum { MAX_FRAMES_IN_FLIGHT = 2 };
+			using Job = std::function<void()>;
+
+			static RenderThread& GetInstance() { return s_Instance; }
+
+			static void Start() { GetInstance().StartImpl(); }
+			static void Stop() { GetInstance().StopImpl(); }
+			static bool IsRunning() { return GetInstance().m_Running; }
+
+			static void Submit(Job job) { GetInstance().SubmitImpl(std::move(job)); }
+			// submits the job and waits for it, used when the main thread needs a result (picking reads).
+			static void Execute(Job job) { GetInstance().SubmitImpl(std::move(job)); GetInstance().SyncImpl(); }
+			// waits until every submitted job is done, resources used by recorded frames can be freed after it.
+			static void Sync() { GetInstance().SyncImpl(); }
+			// presents the frame and limits the amount of frames in flight.
+			static void EndFrame() { GetInstance().EndFrameImpl(); }
+
+		private:
+			RenderThread() {};
+			~RenderThread() {};
+
+			static RenderThread s_Instance;
+
+			void StartImpl();
+			void StopImpl();
+			void SubmitImpl(Job job);
+			void SyncImpl();
+			void EndFrameImpl();
+
+			void ThreadLoop();
+
+			moodycamel::ConcurrentQueue<Job> m_Jobs;
+			std::thread m_Thread;
+
+			std::mutex m_Mutex;
+			std::condition_variable m_JobAvailable;
+			std::condition_variable m_JobCompleted;
+
+			// only touched by the main thread.
+			std::thread::id m_ProducerThread;
+			uint64_t m_SubmittedJobs = 0;
+			std::atomic<uint64_t> m_CompletedJobs{ 0 };
+			std::atomic<unsigned int> m_FramesInFlight{ 0 };
+
+			bool m_Running = false;
+			std::atomic<bool> m_StopRequested{ false };
+		};
+	}
+}
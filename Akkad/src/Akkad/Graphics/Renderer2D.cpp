@@ -1,8 +1,14 @@
 #include "Renderer2D.h"
+#include "RenderThread.h"
+#include "RenderStats.h"
 
 #include "Akkad/Application/Application.h"
 #include "Akkad/Asset/AssetManager.h"
 #include "Akkad/GUI/GUIText.h"
+#include "Akkad/GUI/GUIDrawList.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace Akkad {
 
@@ -10,6 +16,27 @@ namespace Akkad {
 		// TODO : CLEAN THIS SHIT UP
 		Renderer2D Renderer2D::s_Instance;
 
+		static_assert(sizeof(Renderer2D::QuadInstance) == 36, "QuadInstance must match VertexBufferLayout::CreateQuadInstance2DLayout !");
+
+		void Renderer2D::QuadInstance::SetTransform(const glm::mat4& transform)
+		{
+			// 2D transforms only, the z axis is dropped. the 2x2 part is kept as it is, so scale, rotation and
+			// the shear of a non uniform parent scale are drawn the way the transforms compose them.
+			translation = transform[3];
+			xAxis = transform[0];
+			yAxis = transform[1];
+		}
+
+		void Renderer2D::QuadInstance::SetTextureRect(glm::vec2 minTextureCoords, glm::vec2 maxTextureCoords)
+		{
+			glm::vec4 rect = glm::clamp(glm::vec4(minTextureCoords, maxTextureCoords), 0.0f, 1.0f);
+
+			for (int i = 0; i < 4; i++)
+			{
+				textureRect[i] = (uint16_t)(rect[i] * 65535.0f + 0.5f);
+			}
+		}
+
 		void Renderer2D::InitImpl()
 		{
 			// During init, enable debug output
@@ -27,6 +54,8 @@ namespace Akkad {
 			};
 
 			auto platform = Application::GetRenderPlatform();
+			m_StreamingBuffer = platform->CreateStreamingBuffer(STREAMING_BUFFER_SIZE);
+			m_RenderQueue = CreateSharedPtr<RenderQueue>();
 			// setting up quad vertex buffer
 			{
 				VertexBufferLayout layout;
@@ -55,25 +84,33 @@ namespace Akkad {
 				auto vertexbuffer = platform->CreateVertexBuffer();
 				vertexbuffer->SetLayout(layout);
 				m_LineVB = vertexbuffer;
-				glm::vec3 dummyvertex = { 0,0,0 };
-				m_LineVB->SetData(0, sizeof(LineVertex) * (MAX_BATCH_VERTS));
 			}
 
-			UniformBufferLayout scenePropsLayout;
-			scenePropsLayout.Push("sys_transform", ShaderDataType::MAT4);
-			scenePropsLayout.Push("sys_viewProjection", ShaderDataType::MAT4);
+			// setting up GUI vertex buffer, see GUI::GUIDrawList::Vertex
+			{
+				VertexBufferLayout layout;
+				layout.isDynamic = true;
+				layout.Push(ShaderDataType::FLOAT, 2); // positions
+				layout.Push(ShaderDataType::FLOAT, 2); // texture coords
+				layout.Push(ShaderDataType::UNSIGNED_BYTE, 4, false, true); // RGBA8 colors
+				m_GUIVB = platform->CreateVertexBuffer();
+				m_GUIVB->SetLayout(layout);
+			}
 
-			m_SceneProps = platform->CreateUniformBuffer(scenePropsLayout);
-			m_SceneProps->SetName("sys_SceneProps");
+			m_SceneProps = platform->CreateUniformBuffer(UniformBufferLayout::CreateFromBlock<SceneProps>());
+			m_SceneProps->SetName(UniformBlockTraits<SceneProps>::NAME);
 
 			// setting up batch renderer
 			{
 
 				m_QuadBatchData = new QuadVertex[MAX_BATCH_VERTS];
 
-				m_QuadInstanceData = new QuadInstance[MAX_BATCH_VERTS];
+				m_QuadInstanceData = new QuadInstance[MAX_BATCH_QUADS];
 				m_LastQuadInstancePtr = m_QuadInstanceData;
 
+				m_SpriteSubmissions.reserve(MAX_BATCH_QUADS);
+				m_SpriteInstanceData.reserve(MAX_BATCH_QUADS);
+
 				uint32_t* batchIndices = new uint32_t[MAX_BATCH_INDICES];
 				uint32_t offset = 0;
 				for (uint32_t i = 0; i < MAX_BATCH_INDICES; i += 6)
@@ -92,33 +129,16 @@ namespace Akkad {
 				VertexBufferLayout batchLayout;
 				// vertex positions
 				batchLayout.Push(ShaderDataType::FLOAT, 3);
+				// texture coords
+				batchLayout.Push(ShaderDataType::FLOAT, 2);
 
 				m_BatchVB = platform->CreateVertexBuffer();
 				m_BatchVB->SetLayout(batchLayout);
-				float vertices[] = {
-					// positions
-					 0.5f,  0.5f, 0.0f,
-					 0.5f, -0.5f, 0.0f,
-					-0.5f, -0.5f, 0.0f,
-					-0.5f,  0.5f, 0.0f,
-				};
 				m_BatchVB->SetData(&vertices, sizeof(vertices));
 
-				VertexBufferLayout instanceLayout;
-				instanceLayout.isDynamic = true;
-				instanceLayout.isStaticBuffer = true;
-				// instance color
-				instanceLayout.Push(ShaderDataType::FLOAT, 3, true);
-
-				// instance transform matrix
-				instanceLayout.Push(ShaderDataType::FLOAT, 4, true);
-				instanceLayout.Push(ShaderDataType::FLOAT, 4, true);
-				instanceLayout.Push(ShaderDataType::FLOAT, 4, true);
-				instanceLayout.Push(ShaderDataType::FLOAT, 4, true);
-
+				// the instance data lives in the streaming buffer, this buffer only carries the layout.
 				m_InstanceVB = platform->CreateVertexBuffer();
-				m_InstanceVB->SetLayout(instanceLayout);
-				m_InstanceVB->SetData(0, MAX_BATCH_QUADS * sizeof(QuadInstance));
+				m_InstanceVB->SetLayout(VertexBufferLayout::CreateQuadInstance2DLayout());
 
 				m_BatchVB->ExtendLayout(m_InstanceVB);
 
@@ -143,7 +163,6 @@ namespace Akkad {
 			glm::mat4 projection = camera.GetProjection();
 			glm::mat4 viewProjection = projection * view;
 			m_Camera = camera;
-			m_SceneProps->SetData("sys_viewProjection", viewProjection);
 
 			m_SceneCameraViewProjection = viewProjection;
 
@@ -152,9 +171,103 @@ namespace Akkad {
 
 		void Renderer2D::EndSceneImpl()
 		{
+			FlushImpl();
+		}
 
+		void Renderer2D::EndFrameImpl()
+		{
+			// runs on the thread owning the context, after the frame was presented.
+			m_StreamingBuffer->EndFrame();
+
+			auto command = Application::GetRenderPlatform()->GetRenderCommand();
+			command->EndFrame();
+
+			auto stateCacheStats = command->GetStateCacheStats();
+			RenderStats::SetStateChanges(stateCacheStats.issuedCalls, stateCacheStats.elidedCalls);
+			RenderStats::EndFrame();
+		}
+
+		void Renderer2D::FlushImpl()
+		{
+			FlushBatches();
+
+			SharedPtr<RenderQueue> queue = m_RenderQueue;
+			RenderThread::Submit([this, queue]()
+			{
+				queue->Execute(Application::GetRenderPlatform()->GetRenderCommand());
+				queue->Clear();
+				m_RecycledQueues.enqueue(queue);
+			});
+
+			if (!m_RecycledQueues.try_dequeue(m_RenderQueue))
+			{
+				m_RenderQueue = CreateSharedPtr<RenderQueue>();
+			}
+
+			m_DrawOrder = 0;
+			m_OverlayDrawOrder = 0;
+		}
+
+		void Renderer2D::FlushBatches()
+		{
+			FlushSpritesImpl();
 			FlushColoredQuadInstancedImpl();
+			StartColoredQuadInstancedImpl();
 			FlushLineBatch();
+			StartLineBatch();
+		}
+
+		void Renderer2D::SetDrawOrderImpl(uint32_t drawOrder)
+		{
+			// batches are recorded with the order they were flushed at.
+			if (drawOrder != m_DrawOrder)
+			{
+				FlushBatches();
+				m_DrawOrder = drawOrder;
+			}
+		}
+
+		RenderPacket& Renderer2D::SubmitPacket(const SharedPtr<Shader>& shader, const SharedPtr<Texture>& texture, BlendMode blend)
+		{
+			uint64_t key = RenderQueue::CreateSortKey(RenderPass::SCENE, m_DrawOrder, blend, RenderQueue::CreateStateKey(shader.get(), texture.get()));
+			auto& packet = m_RenderQueue->Submit(key);
+			packet.shader = shader;
+			packet.texture = texture;
+			packet.blend = blend;
+
+			return packet;
+		}
+
+		void Renderer2D::SetSceneProps(RenderPacket& packet, const glm::mat4& viewProjection, const glm::mat4& transform)
+		{
+			m_RenderQueue->SetUniformBlock(packet, m_SceneProps.get(), SceneProps{ transform, viewProjection });
+		}
+
+		RenderPacket& Renderer2D::SubmitOverlayPacket(const SharedPtr<Shader>& shader, const SharedPtr<Texture>& texture, BlendMode blend)
+		{
+			// overlay draws use an explicit projection and are kept in call order.
+			uint64_t key = RenderQueue::CreateSortKey(RenderPass::OVERLAY, m_OverlayDrawOrder++, blend, RenderQueue::CreateStateKey(shader.get(), texture.get()));
+			auto& packet = m_RenderQueue->Submit(key);
+			packet.shader = shader;
+			packet.texture = texture;
+			packet.blend = blend;
+
+			return packet;
+		}
+
+		BlendMode Renderer2D::GetMaterialBlendMode(unsigned int renderFlags)
+		{
+			if (!(renderFlags & Material::RenderFlags::BLEND_ENABLE))
+			{
+				return BlendMode::NONE;
+			}
+
+			if (renderFlags & Material::RenderFlags::BLEND_ALPHA_ADD)
+			{
+				return BlendMode::ADDITIVE;
+			}
+
+			return BlendMode::ALPHA;
 		}
 
 		void Renderer2D::DrawQuadImpl(SharedPtr<Texture> texture, glm::mat4& transform)
@@ -171,19 +284,20 @@ namespace Akkad {
 			*/
 		}
 
-		void Renderer2D::DrawQuadImpl(Material& material, glm::mat4& transform)
+		void Renderer2D::DrawQuadImpl(SharedPtr<Material> material, glm::mat4& transform)
 		{
-			auto command = Application::GetRenderPlatform()->GetRenderCommand();
-			
-			if (material.isValid())
+			if (material != nullptr && material->isValid())
 			{
-				material.BindShaders();
-				material.BindTextures();
-				m_SceneProps->SetData("sys_transform", transform);
-
-				m_QuadVB->Bind();
-				m_QuadIB->Bind();
-				command->DrawIndexed(PrimitiveType::TRIANGLE, 6);
+				BlendMode blend = GetMaterialBlendMode(material->GetRenderFlags());
+				uint64_t key = RenderQueue::CreateSortKey(RenderPass::SCENE, m_DrawOrder, blend, material->GetBatchKey());
+				auto& packet = m_RenderQueue->Submit(key);
+				m_RenderQueue->SetMaterial(packet, material);
+				packet.blend = blend;
+				packet.vertexBuffer = m_QuadVB.get();
+				packet.indexBuffer = m_QuadIB.get();
+				packet.count = 6;
+
+				SetSceneProps(packet, m_SceneCameraViewProjection, transform);
 			}
 
 		}
@@ -207,23 +321,17 @@ namespace Akkad {
 
 		void Renderer2D::DrawQuadImpl(glm::vec3 color, glm::mat4& transform, glm::mat4 projection)
 		{
-			auto command = Application::GetRenderPlatform()->GetRenderCommand();
-			m_ColorShader->Bind();
-			m_ColorShaderProps->SetData("props_color", color);
-			m_SceneProps->SetData("sys_viewProjection", projection);
-			m_SceneProps->SetData("sys_transform", transform);
+			auto& packet = SubmitOverlayPacket(m_ColorShader, nullptr, BlendMode::NONE);
+			packet.vertexBuffer = m_QuadVB.get();
+			packet.indexBuffer = m_QuadIB.get();
+			packet.count = 6;
 
-			m_QuadVB->Bind();
-			m_QuadIB->Bind();
-			command->DrawIndexed(PrimitiveType::TRIANGLE, 6);
-			m_SceneProps->SetData("sys_viewProjection", m_SceneCameraViewProjection);
+			m_RenderQueue->SetUniformBlock(packet, m_ColorShaderProps.get(), ColorShaderProps{ color, 0.0f });
+			SetSceneProps(packet, projection, transform);
 		}
 
 		void Renderer2D::DrawRectImpl(glm::vec2 min, glm::vec2 max, glm::vec3 color, bool filled)
 		{
-			auto platform = Application::GetRenderPlatform();
-			auto command = platform->GetRenderCommand();
-
 			float vertices[] = {
 				// positions             // texture coords
 				 max.x,  min.y, 0.0f,    1.0f, 1.0f,  // top right
@@ -232,31 +340,24 @@ namespace Akkad {
 				 min.x,  min.y, 0.0f,    0.0f, 1.0f   // top left 
 			};
 
-			m_SceneProps->SetData("sys_viewProjection", m_SceneCameraViewProjection);
-			m_RectShaderProps->SetData("props_color", color);
-			m_RectShader->Bind();
-			m_RectVB->SetSubData(0, vertices, sizeof(vertices));
-			m_RectVB->Bind();
-			m_QuadIB->Bind();
+			auto& packet = SubmitPacket(m_RectShader, nullptr, BlendMode::NONE);
+			SetRectPacket(packet, vertices, sizeof(vertices), filled);
 
-			if (filled)
-			{
-				command->DrawIndexed(PrimitiveType::TRIANGLE, 6);
-			}
+			SetSceneProps(packet, m_SceneCameraViewProjection);
+			m_RenderQueue->SetUniformBlock(packet, m_RectShaderProps.get(), RectShaderProps{ color });
+		}
 
-			else
-			{
-				command->SetPolygonMode(PolygonMode::LINE);
-				command->DrawIndexed(PrimitiveType::TRIANGLE, 6);
-				command->SetPolygonMode(PolygonMode::FILL);
-			}
+		void Renderer2D::SetRectPacket(RenderPacket& packet, const float* vertices, unsigned int size, bool filled)
+		{
+			packet.vertexBuffer = m_RectVB.get();
+			packet.indexBuffer = m_QuadIB.get();
+			m_RenderQueue->SetVertexData(packet, m_StreamingBuffer, vertices, size);
+			packet.count = 6;
+			packet.polygonMode = filled ? PolygonMode::FILL : PolygonMode::LINE;
 		}
 
 		void Renderer2D::DrawRectImpl(glm::vec2 min, glm::vec2 max, glm::vec3 color, bool filled, glm::mat4 projection)
 		{
-			auto platform = Application::GetRenderPlatform();
-			auto command = platform->GetRenderCommand();
-
 			float vertices[] = {
 				// positions             // texture coords
 				 max.x,  min.y, 0.0f,    1.0f, 1.0f,  // top right
@@ -265,32 +366,15 @@ namespace Akkad {
 				 min.x,  min.y, 0.0f,    0.0f, 1.0f   // top left 
 			};
 
-			m_RectShaderProps->SetData("props_color", color);
-			m_SceneProps->SetData("sys_viewProjection", projection);
-			m_RectShader->Bind();
-			m_RectVB->SetSubData(0, vertices, sizeof(vertices));
-			m_RectVB->Bind();
-			m_QuadIB->Bind();
-
-			if (filled)
-			{
-				command->DrawIndexed(PrimitiveType::TRIANGLE, 6);
-			}
-			else
-			{
-				command->SetPolygonMode(PolygonMode::LINE);
-				command->DrawIndexed(PrimitiveType::TRIANGLE, 6);
-				command->SetPolygonMode(PolygonMode::FILL);
-			}
-
-			m_SceneProps->SetData("sys_viewProjection", m_SceneCameraViewProjection);
+			auto& packet = SubmitOverlayPacket(m_RectShader, nullptr, BlendMode::NONE);
+			SetRectPacket(packet, vertices, sizeof(vertices), filled);
 
+			SetSceneProps(packet, projection);
+			m_RenderQueue->SetUniformBlock(packet, m_RectShaderProps.get(), RectShaderProps{ color });
 		}
 
-		void Renderer2D::DrawRectImpl(Rect rect, SharedPtr<Texture> texture, glm::mat4 projection)
+		void Renderer2D::DrawRectImpl(Rect rect, SharedPtr<Texture> texture, glm::mat4 projection, glm::vec3 tint)
 		{
-			auto platform = Application::GetRenderPlatform();
-			auto command = platform->GetRenderCommand();
 			auto min = rect.GetMin();
 			auto max = rect.GetMax();
 
@@ -306,120 +390,100 @@ namespace Akkad {
 				 min.x,  min.y, 0.0f,       mintex.x, mintex.y,   // top left 
 			};
 
-			m_SceneProps->SetData("sys_viewProjection", projection);
-			texture->Bind(0);
-			m_TexturedRectShader->Bind();
-			m_RectVB->SetSubData(0, vertices, sizeof(vertices));
-			m_RectVB->Bind();
-			m_QuadIB->Bind();
-
-			command->DrawIndexed(PrimitiveType::TRIANGLE, 6);
+			auto& packet = SubmitOverlayPacket(m_TexturedRectShader, texture, BlendMode::ALPHA);
+			SetRectPacket(packet, vertices, sizeof(vertices), true);
 
-			m_SceneProps->SetData("sys_viewProjection", m_SceneCameraViewProjection);
+			SetSceneProps(packet, projection);
+			m_RenderQueue->SetUniformBlock(packet, m_TexturedRectShaderProps.get(), TexturedRectShaderProps{ tint, 1 });
 		}
 
 		void Renderer2D::DrawSpriteImpl(Sprite& sprite, glm::mat4& transform)
 		{
-			if (sprite.GetMaterial() != nullptr)
-			{
-				if (sprite.GetMaterial()->isValid())
-				{
-					auto mintexcoords = sprite.GetMinTextureCoords();
-					auto maxtexcoords = sprite.GetMaxTextureCoords();
-					float vertices[] = {
-						// positions             // texture coords
-						 0.5f,  0.5f, 0.0f,      maxtexcoords.x, maxtexcoords.y,    // top right
-						 0.5f, -0.5f, 0.0f,      maxtexcoords.x, mintexcoords.y,    // bottom right
-						-0.5f, -0.5f, 0.0f,      mintexcoords.x, mintexcoords.y,    // bottom left
-						-0.5f,  0.5f, 0.0f,      mintexcoords.x, maxtexcoords.y,    // top left 
-					};
-
-					m_QuadVB->SetSubData(0, &vertices, sizeof(vertices));
-					auto command = Application::GetRenderPlatform()->GetRenderCommand();
-					sprite.GetMaterial()->BindShaders();
-					sprite.GetMaterial()->BindTextures();
-					m_SceneProps->SetData("sys_transform", transform);
-
-					m_QuadVB->Bind();
-					m_QuadIB->Bind();
-					
-					unsigned int renderFlags = sprite.GetMaterial()->GetRenderFlags();
-					if (renderFlags & Material::RenderFlags::BLEND_ENABLE)
-					{
-						command->EnableBlending();
-						
-						if (renderFlags & Material::RenderFlags::BLEND_INVERSE_ALPHA)
-						{
-							command->SetBlendState(BlendSourceFactor::ALPHA, BlendDestFactor::INVERSE_SRC_ALPHA);
-						}
-
-						if (renderFlags & Material::RenderFlags::BLEND_ALPHA_ADD)
-						{
-							command->SetBlendState(BlendSourceFactor::ALPHA, BlendDestFactor::ONE);
-						}
-
-					}
+			auto material = sprite.GetMaterial();
+			SubmitSprite(material, sprite.GetMinTextureCoords(), sprite.GetMaxTextureCoords(), transform);
+		}
 
-					command->DrawIndexed(PrimitiveType::TRIANGLE, 6);
+		void Renderer2D::DrawAnimatedSpriteImpl(AnimatedSprite& sprite, AnimationFrame& frame, glm::mat4& transform)
+		{
+			auto material = sprite.GetMaterial();
+			SubmitSprite(material, frame.minTextureCoords, frame.maxTextureCoords, transform);
+		}
 
-					if (renderFlags & Material::RenderFlags::BLEND_ENABLE)
-					{
-						command->DisableBlending();
-					}
+		void Renderer2D::SubmitSprite(SharedPtr<Material>& material, glm::vec2 minTextureCoords, glm::vec2 maxTextureCoords, glm::mat4& transform)
+		{
+			if (material != nullptr)
+			{
+				if (material->isValid())
+				{
+					SpriteSubmission submission;
+					submission.batchKey = material->GetBatchKey();
+					submission.material = material;
+					submission.instance.color = 0xFFFFFFFF;
+					submission.instance.SetTextureRect(minTextureCoords, maxTextureCoords);
+					submission.instance.SetTransform(transform);
+
+					m_SpriteSubmissions.push_back(submission);
 				}
 			}
-
 		}
 
-		void Renderer2D::DrawAnimatedSpriteImpl(AnimatedSprite& sprite, AnimationFrame& frame, glm::mat4& transform)
+		void Renderer2D::FlushSpritesImpl()
 		{
-			if (sprite.GetMaterial() != nullptr)
+			if (m_SpriteSubmissions.empty())
 			{
-				if (sprite.GetMaterial()->isValid())
-				{
-					auto mintexcoords = frame.minTextureCoords;
-					auto maxtexcoords = frame.maxTextureCoords;
-					float vertices[] = {
-						// positions             // texture coords
-						 0.5f,  0.5f, 0.0f,      maxtexcoords.x, maxtexcoords.y,    // top right
-						 0.5f, -0.5f, 0.0f,      maxtexcoords.x, mintexcoords.y,    // bottom right
-						-0.5f, -0.5f, 0.0f,      mintexcoords.x, mintexcoords.y,    // bottom left
-						-0.5f,  0.5f, 0.0f,      mintexcoords.x, maxtexcoords.y,    // top left 
-					};
-
-					m_QuadVB->SetSubData(0, &vertices, sizeof(vertices));
-					auto command = Application::GetRenderPlatform()->GetRenderCommand();
-					sprite.GetMaterial()->BindShaders();
-					sprite.GetMaterial()->BindTextures();
-					m_SceneProps->SetData("sys_transform", transform);
-
-					m_QuadVB->Bind();
-					m_QuadIB->Bind();
-
-					unsigned int renderFlags = sprite.GetMaterial()->GetRenderFlags();
-					if (renderFlags & Material::RenderFlags::BLEND_ENABLE)
-					{
-						command->EnableBlending();
+				return;
+			}
 
-						if (renderFlags & Material::RenderFlags::BLEND_INVERSE_ALPHA)
-						{
-							command->SetBlendState(BlendSourceFactor::ALPHA, BlendDestFactor::INVERSE_SRC_ALPHA);
-						}
+			// stable sort so sprites sharing a batch keep their submission order.
+			std::stable_sort(m_SpriteSubmissions.begin(), m_SpriteSubmissions.end(),
+				[](const SpriteSubmission& a, const SpriteSubmission& b) { return a.batchKey < b.batchKey; });
 
-						if (renderFlags & Material::RenderFlags::BLEND_ALPHA_ADD)
-						{
-							command->SetBlendState(BlendSourceFactor::ALPHA, BlendDestFactor::ONE);
-						}
-					}
+			m_SpriteInstanceData.clear();
+			for (auto& submission : m_SpriteSubmissions)
+			{
+				m_SpriteInstanceData.push_back(submission.instance);
+			}
 
-					command->DrawIndexed(PrimitiveType::TRIANGLE, 6);
+			unsigned int batchStart = 0;
+			unsigned int submissionCount = (unsigned int)m_SpriteSubmissions.size();
 
-					if (renderFlags & Material::RenderFlags::BLEND_ENABLE)
-					{
-						command->DisableBlending();
-					}
+			for (unsigned int i = 1; i <= submissionCount; i++)
+			{
+				// every sprite loads its own material, equal keys are checked on content in case of a collision.
+				if (i == submissionCount || m_SpriteSubmissions[i].batchKey != m_SpriteSubmissions[batchStart].batchKey ||
+					!m_SpriteSubmissions[i].material->IsBatchCompatible(*m_SpriteSubmissions[batchStart].material))
+				{
+					DrawSpriteBatch(m_SpriteSubmissions[batchStart].material, batchStart, i - batchStart);
+					batchStart = i;
 				}
 			}
+
+			m_SpriteSubmissions.clear();
+		}
+
+		void Renderer2D::DrawSpriteBatch(const SharedPtr<Material>& material, unsigned int first, unsigned int count)
+		{
+			BlendMode blend = GetMaterialBlendMode(material->GetRenderFlags());
+			uint64_t key = RenderQueue::CreateSortKey(RenderPass::SCENE, m_DrawOrder, blend, material->GetBatchKey());
+
+			// batches bigger than the instance buffer are split in chunks of MAX_BATCH_QUADS.
+			for (unsigned int offset = 0; offset < count; offset += MAX_BATCH_QUADS)
+			{
+				unsigned int instanceCount = std::min(count - offset, (unsigned int)MAX_BATCH_QUADS);
+
+				auto& packet = m_RenderQueue->Submit(key);
+				packet.drawType = DrawType::INSTANCED;
+				m_RenderQueue->SetMaterial(packet, material);
+				packet.blend = blend;
+				packet.vertexBuffer = m_BatchVB.get();
+				packet.indexBuffer = m_QuadIB.get();
+				packet.streamExtended = true;
+				packet.count = 6;
+				packet.instanceCount = instanceCount;
+
+				m_RenderQueue->SetVertexData(packet, m_StreamingBuffer, &m_SpriteInstanceData[first + offset], instanceCount * sizeof(QuadInstance));
+				SetSceneProps(packet, m_SceneCameraViewProjection);
+			}
 		}
 
 		void Renderer2D::DrawLineImpl(glm::vec2 point1, glm::vec2 point2, glm::vec3 color)
@@ -511,46 +575,60 @@ namespace Akkad {
 
 		void Renderer2D::FlushLineBatch()
 		{
-			auto platform = Application::GetRenderPlatform();
-			auto command = platform->GetRenderCommand();
+			if (m_LineBatchVertexCount == 0)
+			{
+				return;
+			}
 
-			m_SceneProps->SetData("sys_viewProjection", m_SceneCameraViewProjection);
-			m_LineShader->Bind();
-			//m_LineVB->SetSubData(0, m_LineBatchData, m_LineBatchVertexCount * sizeof(LineVertex));
-			//m_LineVB->Bind();
-			//command->DrawArrays(PrimitiveType::LINE, m_LineBatchVertexCount);
+			auto& packet = SubmitPacket(m_LineShader, nullptr, BlendMode::NONE);
+			packet.drawType = DrawType::ARRAYS;
+			packet.primitive = PrimitiveType::LINE;
+			packet.count = m_LineBatchVertexCount;
+			packet.vertexBuffer = m_LineVB.get();
+
+			m_RenderQueue->SetVertexData(packet, m_StreamingBuffer, m_LineBatchData, m_LineBatchVertexCount * sizeof(LineVertex));
+
+			SetSceneProps(packet, m_SceneCameraViewProjection);
 		}
 
-		void Renderer2D::DrawImpl(SharedPtr<VertexBuffer> vb, SharedPtr<Shader> shader, unsigned int vertexCount)
+		RenderPacket& Renderer2D::DrawImpl(SharedPtr<VertexBuffer> vb, SharedPtr<Shader> shader, unsigned int vertexCount)
 		{
-			auto command = Application::GetRenderPlatform()->GetRenderCommand();
-			vb->Bind();
-			shader->Bind();
-			command->DrawArrays(PrimitiveType::TRIANGLE_FAN, vertexCount);
+			auto& packet = SubmitPacket(shader, nullptr, BlendMode::NONE);
+			packet.drawType = DrawType::ARRAYS;
+			packet.primitive = PrimitiveType::TRIANGLE_FAN;
+			packet.count = vertexCount;
+			packet.vertexBuffer = vb.get();
+
+			SetSceneProps(packet, m_SceneCameraViewProjection);
+
+			return packet;
 		}
 
 		void Renderer2D::RenderTextImpl(GUI::GUIText& uitext, glm::mat4 projection)
 		{
 			if (uitext.IsValid())
 			{
-				auto atlasSize = uitext.GetFont()->GetTextureAtlasSize();
-				unsigned int has_tint = 1;
-				glm::vec3 color = uitext.GetColor();
-				m_TexturedRectShaderProps->SetData("tint_color", color);
-				m_TexturedRectShaderProps->SetData("has_tint", has_tint);
+				TexturedRectShaderProps textProps = { uitext.GetColor(), 1 };
+				auto& glyphVertices = uitext.GetGlyphVertices();
+				unsigned int glyphCount = uitext.GetGlyphCount();
 
-				for (auto& line : uitext.GetLines())
+				// the font has a single atlas page, the whole block is one draw (or one per MAX_BATCH_QUADS glyphs).
+				for (unsigned int firstGlyph = 0; firstGlyph < glyphCount; firstGlyph += MAX_BATCH_QUADS)
 				{
-					for (const auto& fontCharacter : line.characters)
-					{
-						auto command = Application::GetRenderPlatform()->GetRenderCommand();
+					unsigned int batchGlyphCount = std::min(glyphCount - firstGlyph, (unsigned int)MAX_BATCH_QUADS);
 
-						command->SetBlendState(BlendSourceFactor::ALPHA, BlendDestFactor::INVERSE_SRC_ALPHA);
-						command->EnableBlending();
-						DrawRectImpl(fontCharacter.CharacterRect, uitext.GetFont()->GetTextureAtlas(), projection);
-						command->DisableBlending();
-					}
+					auto& packet = SubmitOverlayPacket(m_TexturedRectShader, uitext.GetFont()->GetTextureAtlas(), BlendMode::ALPHA);
+					packet.vertexBuffer = m_RectVB.get();
+					packet.indexBuffer = m_BatchIB.get();
+					packet.count = batchGlyphCount * 6;
+
+					m_RenderQueue->SetVertexData(packet, m_StreamingBuffer, &glyphVertices[firstGlyph * 4], batchGlyphCount * 4 * sizeof(GUI::GUIText::GlyphVertex));
+					SetSceneProps(packet, projection);
+					m_RenderQueue->SetUniformBlock(packet, m_TexturedRectShaderProps.get(), textProps);
+				}
 
+				for (auto& line : uitext.GetLines())
+				{
 					if (m_DrawDebugGUIRects)
 					{
 						const Graphics::Rect rect = line.boundingBox.GetRect();
@@ -562,6 +640,40 @@ namespace Akkad {
 			}
 			
 		}
+		void Renderer2D::DrawGUIImpl(GUI::GUIDrawList& drawList, glm::mat4 projection, bool picking)
+		{
+			auto& vertices = drawList.GetVertices();
+			GUIShaderProps guiProps = { picking ? 1.0f : 0.0f };
+			BlendMode blend = picking ? BlendMode::NONE : BlendMode::ALPHA;
+
+			for (auto& command : drawList.GetCommands())
+			{
+				for (unsigned int firstQuad = 0; firstQuad < command.quadCount; firstQuad += MAX_BATCH_QUADS)
+				{
+					unsigned int batchQuadCount = std::min(command.quadCount - firstQuad, (unsigned int)MAX_BATCH_QUADS);
+
+					auto& packet = SubmitOverlayPacket(m_GUIShader, command.texture, blend);
+					packet.vertexBuffer = m_GUIVB.get();
+					packet.indexBuffer = m_BatchIB.get();
+					packet.count = batchQuadCount * 6;
+
+					m_RenderQueue->SetVertexData(packet, m_StreamingBuffer, &vertices[(command.firstQuad + firstQuad) * 4], batchQuadCount * 4 * sizeof(GUI::GUIDrawList::Vertex));
+					SetSceneProps(packet, projection);
+					m_RenderQueue->SetUniformBlock(packet, m_GUIShaderProps.get(), guiProps);
+				}
+			}
+		}
+
+		// a block that drifted from its shader would be written at the wrong offsets, checked once when the shader is loaded.
+		template<typename... Blocks>
+		static void ValidateShaderBlocks(const std::string& shaderPath)
+		{
+#ifdef AK_DEBUG
+			auto shaderDesc = Shader::LoadShader(shaderPath.c_str());
+			(ValidateUniformBlock<Blocks>(shaderDesc), ...);
+#endif
+		}
+
 		void Renderer2D::InitShadersImpl()
 		{
 			auto assetManager = Application::GetAssetManager();
@@ -570,11 +682,10 @@ namespace Akkad {
 			{
 				auto colorShader = assetManager->GetShaderByName("r2d_colorShader");
 				m_ColorShader = platform->CreateShader(colorShader.absolutePath.c_str());
+				ValidateShaderBlocks<SceneProps, ColorShaderProps>(colorShader.absolutePath);
 
-				UniformBufferLayout layout;
-				layout.Push("props_color", ShaderDataType::FLOAT3);
-				m_ColorShaderProps = platform->CreateUniformBuffer(layout);
-				m_ColorShaderProps->SetName("shader_props");
+				m_ColorShaderProps = platform->CreateUniformBuffer(UniformBufferLayout::CreateFromBlock<ColorShaderProps>());
+				m_ColorShaderProps->SetName(UniformBlockTraits<ColorShaderProps>::NAME);
 				m_ColorShader->SetUniformBuffer(m_ColorShaderProps);
 				m_ColorShader->SetUniformBuffer(m_SceneProps);
 
@@ -583,6 +694,7 @@ namespace Akkad {
 			{
 				auto lineShader = assetManager->GetShaderByName("r2d_lineShader");
 				m_LineShader = platform->CreateShader(lineShader.absolutePath.c_str());
+				ValidateShaderBlocks<SceneProps>(lineShader.absolutePath);
 				m_LineShader->SetUniformBuffer(m_SceneProps);
 
 			}
@@ -590,11 +702,10 @@ namespace Akkad {
 			{
 				auto rectShader = assetManager->GetShaderByName("r2d_rectShader");
 				m_RectShader = platform->CreateShader(rectShader.absolutePath.c_str());
+				ValidateShaderBlocks<SceneProps, RectShaderProps>(rectShader.absolutePath);
 
-				UniformBufferLayout layout;
-				layout.Push("props_color", ShaderDataType::FLOAT3);
-				m_RectShaderProps = platform->CreateUniformBuffer(layout);
-				m_RectShaderProps->SetName("shader_props");
+				m_RectShaderProps = platform->CreateUniformBuffer(UniformBufferLayout::CreateFromBlock<RectShaderProps>());
+				m_RectShaderProps->SetName(UniformBlockTraits<RectShaderProps>::NAME);
 
 				m_RectShader->SetUniformBuffer(m_RectShaderProps);
 				m_RectShader->SetUniformBuffer(m_SceneProps);
@@ -613,18 +724,26 @@ namespace Akkad {
 			{
 				auto texturedRectShader = assetManager->GetShaderByName("r2d_texturedRect");
 				m_TexturedRectShader = platform->CreateShader(texturedRectShader.absolutePath.c_str());
+				ValidateShaderBlocks<SceneProps, TexturedRectShaderProps>(texturedRectShader.absolutePath);
 
-				UniformBufferLayout layout;
-				layout.Push("tint_color", ShaderDataType::FLOAT3);
-				layout.Push("has_tint", ShaderDataType::UNISGNED_INT);
-
-				m_TexturedRectShaderProps = platform->CreateUniformBuffer(layout);
-				m_TexturedRectShaderProps->SetName("shader_props");
+				m_TexturedRectShaderProps = platform->CreateUniformBuffer(UniformBufferLayout::CreateFromBlock<TexturedRectShaderProps>());
+				m_TexturedRectShaderProps->SetName(UniformBlockTraits<TexturedRectShaderProps>::NAME);
 				m_TexturedRectShader->SetUniformBuffer(m_TexturedRectShaderProps);
 				m_TexturedRectShader->SetUniformBuffer(m_SceneProps);
 
 			}
 
+			{
+				auto guiShader = assetManager->GetShaderByName("r2d_guiShader");
+				m_GUIShader = platform->CreateShader(guiShader.absolutePath.c_str());
+				ValidateShaderBlocks<SceneProps, GUIShaderProps>(guiShader.absolutePath);
+
+				m_GUIShaderProps = platform->CreateUniformBuffer(UniformBufferLayout::CreateFromBlock<GUIShaderProps>());
+				m_GUIShaderProps->SetName(UniformBlockTraits<GUIShaderProps>::NAME);
+				m_GUIShader->SetUniformBuffer(m_GUIShaderProps);
+				m_GUIShader->SetUniformBuffer(m_SceneProps);
+			}
+
 		}
 
 		void Renderer2D::StartColoredQuadInstancedImpl()
@@ -635,14 +754,32 @@ namespace Akkad {
 
 		void Renderer2D::DrawColoredQuadInstancedImpl(glm::vec3 color, glm::mat4& transform)
 		{
-			if (m_QuadInstanceAmount >= MAX_BATCH_QUADS)
+			glm::uvec3 bytes = glm::uvec3(glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f);
+			uint32_t packedColor = bytes.r | (bytes.g << 8) | (bytes.b << 16) | (0xFFu << 24);
+
+			PushColoredQuadInstance(packedColor, transform, false);
+		}
+
+		void Renderer2D::DrawPickingQuadInstancedImpl(uint32_t id, glm::mat4& transform)
+		{
+			// the color shader rebuilds the ID from the RGB bytes when picking, a R32 float target
+			// can not hold more than 24 bits exactly anyway.
+			PushColoredQuadInstance((id & 0xFFFFFF) | (0xFFu << 24), transform, true);
+		}
+
+		void Renderer2D::PushColoredQuadInstance(uint32_t packedColor, glm::mat4& transform, bool picking)
+		{
+			if (m_QuadInstanceAmount >= MAX_BATCH_QUADS || (m_QuadInstanceAmount > 0 && picking != m_QuadInstancesArePicking))
 			{
 				FlushColoredQuadInstancedImpl();
 				StartColoredQuadInstancedImpl();
 			}
-			
-			m_LastQuadInstancePtr->color = color;
-			m_LastQuadInstancePtr->transform = transform;
+
+			m_QuadInstancesArePicking = picking;
+
+			m_LastQuadInstancePtr->color = packedColor;
+			m_LastQuadInstancePtr->SetTextureRect({ 0.0f, 0.0f }, { 1.0f, 1.0f });
+			m_LastQuadInstancePtr->SetTransform(transform);
 			m_LastQuadInstancePtr++;
 
 			m_QuadInstanceAmount++;
@@ -650,20 +787,27 @@ namespace Akkad {
 
 		void Renderer2D::FlushColoredQuadInstancedImpl()
 		{
-			auto command = Application::GetRenderPlatform()->GetRenderCommand();
-
-			m_ColorShader->Bind();
-			m_SceneProps->SetData("sys_viewProjection", m_SceneCameraViewProjection);
+			if (m_QuadInstanceAmount == 0)
+			{
+				return;
+			}
 
 			uint32_t dataSize = (uint32_t)((uint8_t*)m_LastQuadInstancePtr - (uint8_t*)m_QuadInstanceData);
-			m_InstanceVB->SetSubData(0, m_QuadInstanceData, MAX_BATCH_QUADS * sizeof(QuadInstance));
 
-			m_BatchVB->Bind();
-			m_QuadIB->Bind();
+			auto& packet = SubmitPacket(m_ColorShader, nullptr, BlendMode::NONE);
+			packet.drawType = DrawType::INSTANCED;
+			packet.vertexBuffer = m_BatchVB.get();
+			packet.indexBuffer = m_QuadIB.get();
+			packet.streamExtended = true;
+			packet.count = 6;
+			packet.instanceCount = m_QuadInstanceAmount;
 
-			command->DrawElementsInstanced(PrimitiveType::TRIANGLE, 6, m_QuadInstanceAmount);
+			m_RenderQueue->SetVertexData(packet, m_StreamingBuffer, m_QuadInstanceData, dataSize);
 
-			
+			// the instances carry their own color.
+			float pickingMode = m_QuadInstancesArePicking ? 1.0f : 0.0f;
+			m_RenderQueue->SetUniformBlock(packet, m_ColorShaderProps.get(), ColorShaderProps{ glm::vec3(1.0f), pickingMode });
+			SetSceneProps(packet, m_SceneCameraViewProjection);
 		}
 
 	}
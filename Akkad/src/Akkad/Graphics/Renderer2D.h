@@ -4,6 +4,11 @@
 #include "Camera.h"
 #include "Rect.h"
 #include "Sprite.h"
+#include "RenderQueue.h"
+
+#include <concurrentqueue.h>
+
+#include <vector>
 
 namespace Akkad {
 
@@ -11,10 +16,84 @@ namespace Akkad {
 
 	namespace GUI {
 		class GUIText;
+		class GUIDrawList;
 	}
 
 	namespace Graphics {
 
+		// typed mirrors of the std140 blocks of the engine shaders, see UniformBlock.h.
+		struct SceneProps
+		{
+			glm::mat4 sys_transform;
+			glm::mat4 sys_viewProjection;
+		};
+
+		template<> struct UniformBlockTraits<SceneProps>
+		{
+			static constexpr const char* NAME = "sys_SceneProps";
+			static constexpr UniformBlockMember MEMBERS[] = {
+				AK_UNIFORM_BLOCK_MEMBER(SceneProps, sys_transform),
+				AK_UNIFORM_BLOCK_MEMBER(SceneProps, sys_viewProjection)
+			};
+		};
+
+		struct ColorShaderProps
+		{
+			glm::vec3 props_color;
+			float props_picking;
+		};
+
+		template<> struct UniformBlockTraits<ColorShaderProps>
+		{
+			static constexpr const char* NAME = "shader_props";
+			static constexpr UniformBlockMember MEMBERS[] = {
+				AK_UNIFORM_BLOCK_MEMBER(ColorShaderProps, props_color),
+				AK_UNIFORM_BLOCK_MEMBER(ColorShaderProps, props_picking)
+			};
+		};
+
+		struct RectShaderProps
+		{
+			glm::vec3 props_color;
+		};
+
+		template<> struct UniformBlockTraits<RectShaderProps>
+		{
+			static constexpr const char* NAME = "shader_props";
+			static constexpr UniformBlockMember MEMBERS[] = {
+				AK_UNIFORM_BLOCK_MEMBER(RectShaderProps, props_color)
+			};
+		};
+
+		// also used by the text, the glyphs are tinted with the text color.
+		struct TexturedRectShaderProps
+		{
+			glm::vec3 tint_color;
+			unsigned int has_tint_color;
+		};
+
+		template<> struct UniformBlockTraits<TexturedRectShaderProps>
+		{
+			static constexpr const char* NAME = "shader_props";
+			static constexpr UniformBlockMember MEMBERS[] = {
+				AK_UNIFORM_BLOCK_MEMBER(TexturedRectShaderProps, tint_color),
+				AK_UNIFORM_BLOCK_MEMBER(TexturedRectShaderProps, has_tint_color)
+			};
+		};
+
+		struct GUIShaderProps
+		{
+			float props_picking;
+		};
+
+		template<> struct UniformBlockTraits<GUIShaderProps>
+		{
+			static constexpr const char* NAME = "shader_props";
+			static constexpr UniformBlockMember MEMBERS[] = {
+				AK_UNIFORM_BLOCK_MEMBER(GUIShaderProps, props_picking)
+			};
+		};
+
 		class Renderer2D
 		{
 		public:
@@ -24,10 +103,27 @@ namespace Akkad {
 				glm::mat4 transform;
 			};
 
+			// packed per instance data of the instanced quad path, shared by colored quads and sprites,
+			// see VertexBufferLayout::CreateQuadInstance2DLayout. instanced shaders read it from :
+			// 0 : position (vec3), 1 : texture coords (vec2), 2 : translation (vec2), 3 : 2x2 linear part (vec4, x axis / y axis),
+			// 4 : color (vec4, RGBA8), 5 : texture rect (vec4, min uv / max uv)
 			struct QuadInstance
 			{
-				glm::vec3 color;
-				glm::mat4 transform;
+				glm::vec2 translation;
+				glm::vec2 xAxis;
+				glm::vec2 yAxis;
+				uint32_t color;
+				uint16_t textureRect[4];
+
+				void SetTransform(const glm::mat4& transform);
+				void SetTextureRect(glm::vec2 minTextureCoords, glm::vec2 maxTextureCoords);
+			};
+
+			struct SpriteSubmission
+			{
+				uint64_t batchKey;
+				SharedPtr<Material> material;
+				QuadInstance instance;
 			};
 
 			struct LineVertex {
@@ -39,9 +135,17 @@ namespace Akkad {
 			static void Init() { GetInstance().InitImpl(); }
 			static void BeginScene(Camera& camera, glm::mat4& cameraTransform) { GetInstance().BeginSceneImpl(camera, cameraTransform); }
 			static void EndScene() { GetInstance().EndSceneImpl(); }
+			// called once per frame after the buffers are swapped.
+			static void EndFrame() { GetInstance().EndFrameImpl(); }
+			// records every pending batch and replays the render queue.
+			static void Flush() { GetInstance().FlushImpl(); }
+			static void FlushSprites() { GetInstance().FlushSpritesImpl(); }
+			// draws recorded with a higher order are drawn on top, pending batches are recorded when it changes.
+			static void SetDrawOrder(uint32_t drawOrder) { GetInstance().SetDrawOrderImpl(drawOrder); }
+			static uint32_t GetDrawOrder() { return GetInstance().m_DrawOrder; }
 
 			static void DrawQuad(SharedPtr<Texture> texture, glm::mat4& transform) { GetInstance().DrawQuadImpl(texture, transform); }
-			static void DrawQuad(Material& material, glm::mat4& transform) { GetInstance().DrawQuadImpl(material, transform); }
+			static void DrawQuad(SharedPtr<Material> material, glm::mat4& transform) { GetInstance().DrawQuadImpl(material, transform); }
 			static void DrawQuad(glm::vec3 color, glm::mat4& transform) { GetInstance().DrawQuadImpl(color, transform); }
 			static void DrawQuad(glm::vec3 color, glm::mat4& transform, glm::mat4 projection) { GetInstance().DrawQuadImpl(color, transform, projection); }
 			static void DrawRect(glm::vec2 min, glm::vec2 max, glm::vec3 color, bool filled) { GetInstance().DrawRectImpl(min, max, color, filled); }
@@ -49,17 +153,25 @@ namespace Akkad {
 			static void DrawRect(Rect rect, glm::vec3 color, bool filled, glm::mat4 projection) { GetInstance().DrawRectImpl(rect, color, filled, projection); }
 
 			static void DrawColoredQuadInstanced(glm::vec3 color, glm::mat4& transform) { GetInstance().DrawColoredQuadInstancedImpl(color, transform); }
+			// used by the picking pass. the low 24 bits of the ID are packed in the RGB8 bytes of the instance color,
+			// the color shader rebuilds the ID from them and writes it to the picking target.
+			static void DrawPickingQuadInstanced(uint32_t id, glm::mat4& transform) { GetInstance().DrawPickingQuadInstancedImpl(id, transform); }
 			static void DrawSprite(Sprite& sprite, glm::mat4& transform) { GetInstance().DrawSpriteImpl(sprite, transform); };
 			static void DrawAnimatedSprite(AnimatedSprite& sprite, AnimationFrame& frame, glm::mat4& transform) { GetInstance().DrawAnimatedSpriteImpl(sprite, frame, transform); };
 
 			static void DrawLine(glm::vec2 point1, glm::vec2 point2, glm::vec3 color) { GetInstance().DrawLineImpl(point1, point2, color); }
 			static void DrawLine(glm::vec2 point1, glm::vec2 point2, glm::vec3 color, glm::mat4& projection) { GetInstance().DrawLineImpl(point1, point2, color, projection); }
 
-			static void Draw(SharedPtr<VertexBuffer> vb, SharedPtr<Shader> shader, unsigned int vertexCount) { GetInstance().DrawImpl(vb, shader, vertexCount); };
+			// returns the recorded packet so the caller can add a stream source, state and uniform writes.
+			static RenderPacket& Draw(SharedPtr<VertexBuffer> vb, SharedPtr<Shader> shader, unsigned int vertexCount) { return GetInstance().DrawImpl(vb, shader, vertexCount); };
 			static void RenderText(GUI::GUIText& uitext, glm::mat4 projection) { GetInstance().RenderTextImpl(uitext, projection); }
+			// one draw per texture change in the list, picking lists hold IDs in their vertex colors.
+			static void DrawGUI(GUI::GUIDrawList& drawList, glm::mat4 projection, bool picking) { GetInstance().DrawGUIImpl(drawList, projection, picking); }
 			static void InitShaders() { GetInstance().InitShadersImpl(); }
 			static Camera GetCamera() { return GetInstance().m_Camera; }
 			static SharedPtr<UniformBuffer> GetSystemUniforms() {return GetInstance().m_SceneProps;};
+			static SharedPtr<StreamingBuffer> GetStreamingBuffer() { return GetInstance().m_StreamingBuffer; }
+			static RenderQueue& GetRenderQueue() { return *GetInstance().m_RenderQueue; }
 
 			static bool GetGUIDebugDrawState() { return GetInstance().m_DrawDebugGUIRects; }
 			static void SetGUIDebugDrawState(bool state) { GetInstance().m_DrawDebugGUIRects = state; }
@@ -76,9 +188,19 @@ namespace Akkad {
 			void InitImpl();
 			void BeginSceneImpl(Camera& camera, glm::mat4& cameraTransform);
 			void EndSceneImpl();
+			void EndFrameImpl();
+			void FlushImpl();
+			void FlushBatches();
+			void SetDrawOrderImpl(uint32_t drawOrder);
+
+			RenderPacket& SubmitPacket(const SharedPtr<Shader>& shader, const SharedPtr<Texture>& texture, BlendMode blend);
+			RenderPacket& SubmitOverlayPacket(const SharedPtr<Shader>& shader, const SharedPtr<Texture>& texture, BlendMode blend);
+			void SetSceneProps(RenderPacket& packet, const glm::mat4& viewProjection, const glm::mat4& transform = glm::mat4(1.0f));
+			void SetRectPacket(RenderPacket& packet, const float* vertices, unsigned int size, bool filled);
+			static BlendMode GetMaterialBlendMode(unsigned int renderFlags);
 
 			void DrawQuadImpl(SharedPtr<Texture> texture, glm::mat4& transform);
-			void DrawQuadImpl(Material& material, glm::mat4& transform);
+			void DrawQuadImpl(SharedPtr<Material> material, glm::mat4& transform);
 			void DrawQuadImpl(glm::vec3 color, glm::mat4& transform);
 			void DrawQuadImpl(glm::vec3 color, glm::mat4& transform, glm::mat4 projection);
 
@@ -86,11 +208,15 @@ namespace Akkad {
 			void DrawRectImpl(glm::vec2 min, glm::vec2 max, glm::vec3 color, bool filled, glm::mat4 projection);
 			void DrawRectImpl(Rect rect, glm::vec3 color, bool filled);
 			void DrawRectImpl(Rect rect, glm::vec3 color, bool filled, glm::mat4 projection);
-			void DrawRectImpl(Rect rect, SharedPtr<Texture> texture, glm::mat4 projection);
+			void DrawRectImpl(Rect rect, SharedPtr<Texture> texture, glm::mat4 projection, glm::vec3 tint);
 
 			void DrawSpriteImpl(Sprite& sprite, glm::mat4& transform);
 			void DrawAnimatedSpriteImpl(AnimatedSprite& sprite, AnimationFrame& frame, glm::mat4& transform);
 
+			void SubmitSprite(SharedPtr<Material>& material, glm::vec2 minTextureCoords, glm::vec2 maxTextureCoords, glm::mat4& transform);
+			void FlushSpritesImpl();
+			void DrawSpriteBatch(const SharedPtr<Material>& material, unsigned int first, unsigned int count);
+
 			void DrawLineImpl(glm::vec2 point1, glm::vec2 point2, glm::vec3 color);
 			void DrawLineImpl(glm::vec2 point1, glm::vec2 point2, glm::vec3 color, glm::mat4& projection);
 
@@ -102,14 +228,17 @@ namespace Akkad {
 			void NewLineBatch();
 			void FlushLineBatch();
 
-			void DrawImpl(SharedPtr<VertexBuffer> vb, SharedPtr<Shader> shader, unsigned int vertexCount);
+			RenderPacket& DrawImpl(SharedPtr<VertexBuffer> vb, SharedPtr<Shader> shader, unsigned int vertexCount);
 
 			void RenderTextImpl(GUI::GUIText& uitext, glm::mat4 projection);
+			void DrawGUIImpl(GUI::GUIDrawList& drawList, glm::mat4 projection, bool picking);
 
 			void InitShadersImpl();
 
 			void StartColoredQuadInstancedImpl();
 			void DrawColoredQuadInstancedImpl(glm::vec3 color, glm::mat4& transform);
+			void DrawPickingQuadInstancedImpl(uint32_t id, glm::mat4& transform);
+			void PushColoredQuadInstance(uint32_t packedColor, glm::mat4& transform, bool picking);
 			void FlushColoredQuadInstancedImpl();
 
 			bool m_DrawDebugGUIRects = true;
@@ -122,18 +251,31 @@ namespace Akkad {
 			SharedPtr<IndexBuffer> m_QuadIB;
 
 			enum {MAX_BATCH_QUADS = 1000, MAX_BATCH_VERTS = MAX_BATCH_QUADS * 4, MAX_BATCH_INDICES = MAX_BATCH_QUADS * 6};
+			enum {STREAMING_BUFFER_SIZE = StreamingBuffer::SEGMENT_COUNT * 4 * 1024 * 1024};
+
+			// all the per frame geometry (sprite instances, rects, text, lines) is written here.
+			SharedPtr<StreamingBuffer> m_StreamingBuffer;
+
+			// the recording queue, flushed queues are handed to the render thread and come back once executed.
+			SharedPtr<RenderQueue> m_RenderQueue;
+			moodycamel::ConcurrentQueue<SharedPtr<RenderQueue>> m_RecycledQueues;
+			uint32_t m_DrawOrder = 0;
+			uint32_t m_OverlayDrawOrder = 0;
 			SharedPtr<VertexBuffer> m_BatchVB;
 			SharedPtr<IndexBuffer> m_BatchIB;
 
-			glm::mat4 m_InstanceMatrices[MAX_BATCH_QUADS];
 			QuadInstance* m_QuadInstanceData = nullptr;
 			unsigned int m_QuadInstanceAmount = 0;
+			bool m_QuadInstancesArePicking = false;
 			
 			SharedPtr<VertexBuffer> m_InstanceVB;
 
 			QuadVertex* m_QuadBatchData = nullptr;
 			QuadVertex* m_LastQuadVertexPtr = nullptr;
 			QuadInstance* m_LastQuadInstancePtr = nullptr;
+
+			std::vector<SpriteSubmission> m_SpriteSubmissions;
+			std::vector<QuadInstance> m_SpriteInstanceData;
 			glm::vec4 m_QuadVertexPositions[4] = {};
 			unsigned int m_QuadBatchIndexCount = 0;
 
@@ -156,6 +298,10 @@ namespace Akkad {
 			SharedPtr<Shader> m_TexturedRectShader;
 			SharedPtr<UniformBuffer> m_TexturedRectShaderProps;
 
+			SharedPtr<VertexBuffer> m_GUIVB;
+			SharedPtr<Shader> m_GUIShader;
+			SharedPtr<UniformBuffer> m_GUIShaderProps;
+
 			SharedPtr<VertexBuffer> m_GUITextVB;
 			SharedPtr<IndexBuffer> m_GUITextIB;
 			SharedPtr<Shader> m_GUITextShader;
@@ -22,6 +22,10 @@ namespace Akkad {
 				return 4 * 4 * 4;
 			case ShaderDataType::BOOL:
 				return 4;
+			case ShaderDataType::UNSIGNED_BYTE:
+				return 1;
+			case ShaderDataType::UNSIGNED_SHORT:
+				return 2;
 
 			default:
 				break;
@@ -4,7 +4,7 @@ namespace Akkad {
 	namespace Graphics {
 
 		enum class ShaderDataType {
-			UNKNOWN, BOOL, FLOAT, FLOAT2, FLOAT3, FLOAT4, UNISGNED_INT, MAT3, MAT4
+			UNKNOWN, BOOL, FLOAT, FLOAT2, FLOAT3, FLOAT4, UNISGNED_INT, MAT3, MAT4, UNSIGNED_BYTE, UNSIGNED_SHORT
 		};
 		unsigned int GetSizeOfType(ShaderDataType type);
 	}
@@ -1,11 +1,16 @@
 #include "SortingLayer2D.h"
 
+#include <utility>
+
 namespace Akkad {
 	std::vector<SortingLayer2D> SortingLayer2DHandler::s_RegisteredLayers;
+	std::vector<unsigned int> SortingLayer2DHandler::s_LayerOrder;
+	unsigned int SortingLayer2DHandler::s_NextLayerID = 0;
+	unsigned int SortingLayer2DHandler::s_RegistrationVersion = 1;
 
 	void SortingLayer2DHandler::RegisterLayer(std::string layerName)
 	{
-		for (auto it : s_RegisteredLayers)
+		for (auto& it : s_RegisteredLayers)
 		{
 			if (it.name == layerName)
 			{
@@ -14,13 +19,70 @@ namespace Akkad {
 			}
 		}
 
+		if (s_NextLayerID >= INVALID_LAYER_ID)
+		{
+			AK_ASSERT(false, "Too many sorting layers registered !");
+			return;
+		}
+
 		SortingLayer2D layer;
 		layer.name = layerName;
+		layer.id = s_NextLayerID++;
 		s_RegisteredLayers.push_back(layer);
+
+		RebuildLayerOrder();
+		s_RegistrationVersion++;
 	}
 
 	void SortingLayer2DHandler::ClearRegisteredLayers()
 	{
 		s_RegisteredLayers.clear();
+		s_LayerOrder.clear();
+		s_NextLayerID = 0;
+		s_RegistrationVersion++;
+	}
+
+	void SortingLayer2DHandler::SwapLayers(unsigned int first, unsigned int second)
+	{
+		if (first >= s_RegisteredLayers.size() || second >= s_RegisteredLayers.size())
+		{
+			return;
+		}
+
+		std::swap(s_RegisteredLayers[first], s_RegisteredLayers[second]);
+		RebuildLayerOrder();
+	}
+
+	unsigned int SortingLayer2DHandler::GetLayerID(const std::string& layerName)
+	{
+		for (auto& it : s_RegisteredLayers)
+		{
+			if (it.name == layerName)
+			{
+				return it.id;
+			}
+		}
+
+		return INVALID_LAYER_ID;
+	}
+
+	unsigned int SortingLayer2DHandler::GetLayerOrder(unsigned int layerID)
+	{
+		if (layerID >= s_LayerOrder.size())
+		{
+			return INVALID_LAYER_ID;
+		}
+
+		return s_LayerOrder[layerID];
+	}
+
+	void SortingLayer2DHandler::RebuildLayerOrder()
+	{
+		s_LayerOrder.assign(s_NextLayerID, INVALID_LAYER_ID);
+
+		for (unsigned int i = 0; i < s_RegisteredLayers.size(); i++)
+		{
+			s_LayerOrder[s_RegisteredLayers[i].id] = i;
+		}
 	}
-}
\ No newline at end of file
+}
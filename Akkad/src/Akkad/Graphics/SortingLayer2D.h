@@ -11,16 +11,34 @@ namespace Akkad {
 		SortingLayer2D() {}
 		SortingLayer2D(std::string layerName) { name = layerName; }
 		std::string name;
+		// stable for the lifetime of the registration, does not change when layers are re-ordered.
+		unsigned int id = 0;
 	};
 
 	class SortingLayer2DHandler {
 	public:
+		enum { INVALID_LAYER_ID = 0xFFFF };
+
 		SortingLayer2DHandler(std::string layerName) { m_Name = layerName; }
 		static std::vector<SortingLayer2D>& GetRegisteredLayers() { return s_RegisteredLayers; }
 		static void RegisterLayer(std::string layerName);
 		static void ClearRegisteredLayers();
+		static void SwapLayers(unsigned int first, unsigned int second);
+
+		// returns INVALID_LAYER_ID when no layer with that name is registered.
+		static unsigned int GetLayerID(const std::string& layerName);
+		// position of the layer in the draw order, layers with lower order are drawn first.
+		static unsigned int GetLayerOrder(unsigned int layerID);
+
+		// bumped each time a layer is registered or the layers are cleared, used to invalidate cached layer IDs.
+		static unsigned int GetRegistrationVersion() { return s_RegistrationVersion; }
 	private:
+		static void RebuildLayerOrder();
+
 		std::string m_Name;
 		static std::vector<SortingLayer2D> s_RegisteredLayers;
+		static std::vector<unsigned int> s_LayerOrder;
+		static unsigned int s_NextLayerID;
+		static unsigned int s_RegistrationVersion;
 	};
 }
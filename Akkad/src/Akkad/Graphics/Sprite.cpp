@@ -3,6 +3,7 @@
 #include "Akkad/Logging.h"
 #include "Akkad/Application/Application.h"
 #include "Akkad/Asset/AssetManager.h"
+#include "SortingLayer2D.h"
 
 #include <json.hpp>
 #include <fstream>
@@ -26,6 +27,18 @@ namespace Akkad {
 			RecalculateTextureCoords();
 		}
 
+		unsigned int Sprite::GetSortingLayerID()
+		{
+			// the name is only resolved again when the registered layers change.
+			if (m_SortingLayerVersion != SortingLayer2DHandler::GetRegistrationVersion())
+			{
+				m_SortingLayerID = SortingLayer2DHandler::GetLayerID(m_SortingLayer);
+				m_SortingLayerVersion = SortingLayer2DHandler::GetRegistrationVersion();
+			}
+
+			return m_SortingLayerID;
+		}
+
 		glm::vec2 Sprite::GetMinTextureCoords()
 		{
 			return m_MinTextureCoords;
@@ -93,6 +106,17 @@ namespace Akkad {
 			m_Material = Material::LoadFile(filepath);
 		}
 
+		unsigned int AnimatedSprite::GetSortingLayerID()
+		{
+			if (m_SortingLayerVersion != SortingLayer2DHandler::GetRegistrationVersion())
+			{
+				m_SortingLayerID = SortingLayer2DHandler::GetLayerID(m_SortingLayer);
+				m_SortingLayerVersion = SortingLayer2DHandler::GetRegistrationVersion();
+			}
+
+			return m_SortingLayerID;
+		}
+
 		SharedPtr<SpriteAnimation> AnimatedSprite::AddAnimation(std::string assetID)
 		{
 			auto desc = Application::GetAssetManager()->GetDescriptorByID(assetID);
@@ -9,12 +9,15 @@ namespace Akkad {
 		{
 		public:
 			void SetMaterial(std::string filepath);
-			void SetSortingLayer(std::string layer) { m_SortingLayer = layer; };
+			void SetSortingLayer(std::string layer) { m_SortingLayer = layer; m_SortingLayerVersion = 0; };
+			void SetOrderInLayer(int order) { m_OrderInLayer = order; };
 
 			void SetTileRow(float row);
 			void SetTileColoumn(float coloumn);
 
 			std::string GetSortingLayer() { return m_SortingLayer; };
+			unsigned int GetSortingLayerID();
+			int GetOrderInLayer() { return m_OrderInLayer; };
 			SharedPtr<Material> GetMaterial() { return m_Material; };
 
 			glm::vec2 GetMinTextureCoords();
@@ -26,6 +29,9 @@ namespace Akkad {
 		private:
 			SharedPtr<Material> m_Material;
 			std::string m_SortingLayer;
+			unsigned int m_SortingLayerID = 0;
+			unsigned int m_SortingLayerVersion = 0;
+			int m_OrderInLayer = 0;
 
 			float m_TileRow = 0;
 			float m_TileColoumn = 0;
@@ -63,7 +69,8 @@ namespace Akkad {
 		class AnimatedSprite {
 		public:
 			void SetMaterial(std::string filepath);
-			void SetSortingLayer(std::string layer) { m_SortingLayer = layer; };
+			void SetSortingLayer(std::string layer) { m_SortingLayer = layer; m_SortingLayerVersion = 0; };
+			void SetOrderInLayer(int order) { m_OrderInLayer = order; };
 			void SetActiveAnimation(std::string AnimationName) { m_ActiveAnimation = AnimationName; }
 
 			SharedPtr<SpriteAnimation> AddAnimation(std::string assetID);
@@ -72,12 +79,17 @@ namespace Akkad {
 			AnimationFrame GetFrame(float deltaTime);
 
 			std::string GetSortingLayer() { return m_SortingLayer; };
+			unsigned int GetSortingLayerID();
+			int GetOrderInLayer() { return m_OrderInLayer; };
 			SharedPtr<Material> GetMaterial() { return m_Material; };
 
 		private:
 			std::map<std::string, SharedPtr<SpriteAnimation>> m_Animations;
 			SharedPtr<Material> m_Material;
 			std::string m_SortingLayer;
+			unsigned int m_SortingLayerID = 0;
+			unsigned int m_SortingLayerVersion = 0;
+			int m_OrderInLayer = 0;
 			std::string m_ActiveAnimation;
 
 			friend class PropertyEditorPanel;
@@ -0,0 +1,17 @@
+#include "SpriteSortKey.h"
+
+#include <algorithm>
+
+namespace Akkad {
+	namespace Graphics {
+
+		uint64_t SpriteSortKey::Create(unsigned int layerOrder, int orderInLayer, uint64_t batchKey)
+		{
+			// bias the signed order so negative values sort before positive ones.
+			int biasedOrder = std::min(std::max(orderInLayer, (int)MIN_ORDER_IN_LAYER), (int)MAX_ORDER_IN_LAYER) + 32768;
+			uint32_t foldedBatchKey = (uint32_t)(batchKey ^ (batchKey >> 32));
+
+			return ((uint64_t)(layerOrder & 0xFFFF) << 48) | ((uint64_t)biasedOrder << 32) | foldedBatchKey;
+		}
+	}
+}
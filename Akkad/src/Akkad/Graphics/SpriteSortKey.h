@@ -0,0 +1,28 @@
+#pragma once
+#include "RadixSort.h"
+
+#include <cstdint>
+
+namespace Akkad {
+	namespace Graphics {
+
+		// 64 bit key used to order 2D sprites before submission :
+		// bits 48-63 : sorting layer order, bits 32-47 : order in layer, bits 0-31 : material batch key.
+		struct SpriteSortKey
+		{
+			uint64_t key;
+			uint32_t index;
+
+			// the order in layer is clamped to [MIN_ORDER_IN_LAYER, MAX_ORDER_IN_LAYER], the slot above the
+			// maximum belongs to the script draws of the layer, see GetScriptDrawOrder().
+			enum { MIN_ORDER_IN_LAYER = -32768, MAX_ORDER_IN_LAYER = 32766 };
+
+			static uint64_t Create(unsigned int layerOrder, int orderInLayer, uint64_t batchKey);
+			// script draws land on top of every sprite of their layer.
+			static uint32_t GetScriptDrawOrder(unsigned int layerOrder) { return ((layerOrder & 0xFFFF) << 16) | 0xFFFF; }
+			// the part of the key that must be drawn in order, sprites sharing it can be batched freely.
+			static uint32_t GetDrawOrder(uint64_t key) { return (uint32_t)(key >> 32); }
+			static unsigned int GetLayerOrder(uint64_t key) { return (unsigned int)(key >> 48); }
+		};
+	}
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include "Akkad/core.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		// ring buffer for geometry that is rewritten every frame. the ring is split into segments,
+		// a frame writes into one segment while the GPU may still read the previous ones.
+		class StreamingBuffer {
+		public:
+			enum { SEGMENT_COUNT = 3, ALLOCATION_ALIGNMENT = 16 };
+			// returned by Push() when the data does not fit in a segment, nothing was written.
+			static constexpr unsigned int INVALID_OFFSET = 0xFFFFFFFF;
+
+			virtual ~StreamingBuffer() {}
+
+			// copies the data into the ring and returns the byte offset it was written at,
+			// pass that offset to VertexBuffer::SetStreamSource before drawing. check it against INVALID_OFFSET.
+			virtual unsigned int Push(const void* data, unsigned int size) = 0;
+
+			// marks the end of the segment used this frame, call once per frame after presenting.
+			virtual void EndFrame() = 0;
+
+			virtual unsigned int GetID() = 0;
+			virtual unsigned int GetSize() = 0;
+		};
+	}
+}
@@ -0,0 +1,81 @@
+#include "UniformBlock.h"
+#include "Shader.h"
+
+#include "Akkad/Logging.h"
+
+#include <spirv_cross.hpp>
+
+namespace Akkad {
+	namespace Graphics {
+
+		bool ValidateUniformBlock(const ShaderDescriptor& shaderDesc, const char* blockName, const UniformBlockMember* members, unsigned int memberCount)
+		{
+			bool found = false;
+			bool valid = true;
+
+			for (ShaderProgramType shaderStage : shaderDesc.ProgramTypes)
+			{
+				ScopedPtr<spirv_cross::Compiler> shader;
+
+				switch (shaderStage)
+				{
+				case ShaderProgramType::VERTEX:
+					shader = CreateScopedPtr<spirv_cross::Compiler>(shaderDesc.VertexData);
+					break;
+				case ShaderProgramType::FRAGMENT:
+					shader = CreateScopedPtr<spirv_cross::Compiler>(shaderDesc.FragmentData);
+					break;
+				default:
+					break;
+				}
+
+				if (shader == nullptr)
+				{
+					continue;
+				}
+
+				spirv_cross::ShaderResources resources = shader->get_shader_resources();
+				for (auto& resource : resources.uniform_buffers)
+				{
+					if (resource.name != blockName)
+					{
+						continue;
+					}
+
+					found = true;
+					auto& type = shader->get_type(resource.base_type_id);
+					unsigned int reflectedCount = (unsigned int)type.member_types.size();
+
+					if (reflectedCount != memberCount)
+					{
+						AK_ERROR("uniform block {} has {} members, the shader declares {}", blockName, memberCount, reflectedCount);
+						valid = false;
+						continue;
+					}
+
+					// the C++ offsets were checked against std140 at compile time, the shader's must be the same.
+					for (unsigned int i = 0; i < memberCount; i++)
+					{
+						const std::string& name = shader->get_member_name(type.self, i);
+						unsigned int offset = shader->get_member_decoration(type.self, i, spv::DecorationOffset);
+						unsigned int size = (unsigned int)shader->get_declared_struct_member_size(type, i);
+
+						if (name != members[i].name || offset != members[i].offset || size != members[i].size)
+						{
+							AK_ERROR("uniform block {} member {} ({} bytes at {}) does not match the shader's {} ({} bytes at {})",
+								blockName, members[i].name, members[i].size, members[i].offset, name, size, offset);
+							valid = false;
+						}
+					}
+				}
+			}
+
+			if (!found)
+			{
+				AK_WARNING("uniform block {} is not used by the shader", blockName);
+			}
+
+			return valid;
+		}
+	}
+}
@@ -0,0 +1,150 @@
+#pragma once
+#include "ShaderDataType.h"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace Akkad {
+	namespace Graphics {
+
+		struct ShaderDescriptor;
+
+		/* -------------- std140 rules of the types a block member can have ------------------- */
+
+		template <typename T>
+		struct Std140Type
+		{
+			static constexpr bool isValid = false;
+		};
+
+		template <>
+		struct Std140Type<float>
+		{
+			static constexpr bool isValid = true;
+			static constexpr ShaderDataType shaderType = ShaderDataType::FLOAT;
+			static constexpr unsigned int alignment = 4;
+			static constexpr unsigned int size = 4;
+		};
+
+		template <>
+		struct Std140Type<unsigned int>
+		{
+			static constexpr bool isValid = true;
+			static constexpr ShaderDataType shaderType = ShaderDataType::UNISGNED_INT;
+			static constexpr unsigned int alignment = 4;
+			static constexpr unsigned int size = 4;
+		};
+
+		template <>
+		struct Std140Type<glm::vec2>
+		{
+			static constexpr bool isValid = true;
+			static constexpr ShaderDataType shaderType = ShaderDataType::FLOAT2;
+			static constexpr unsigned int alignment = 8;
+			static constexpr unsigned int size = 8;
+		};
+
+		template <>
+		struct Std140Type<glm::vec3>
+		{
+			static constexpr bool isValid = true;
+			static constexpr ShaderDataType shaderType = ShaderDataType::FLOAT3;
+			static constexpr unsigned int alignment = 16;
+			static constexpr unsigned int size = 12;
+		};
+
+		template <>
+		struct Std140Type<glm::vec4>
+		{
+			static constexpr bool isValid = true;
+			static constexpr ShaderDataType shaderType = ShaderDataType::FLOAT4;
+			static constexpr unsigned int alignment = 16;
+			static constexpr unsigned int size = 16;
+		};
+
+		template <>
+		struct Std140Type<glm::mat4>
+		{
+			static constexpr bool isValid = true;
+			static constexpr ShaderDataType shaderType = ShaderDataType::MAT4;
+			static constexpr unsigned int alignment = 16;
+			static constexpr unsigned int size = 64;
+		};
+
+		/*------------------------------------------------------------------------------*/
+
+		struct UniformBlockMember
+		{
+			const char* name;
+			ShaderDataType type;
+			unsigned int offset; // offset of the member in the C++ struct
+			unsigned int alignment;
+			unsigned int size;
+		};
+
+		template <typename T>
+		constexpr UniformBlockMember MakeUniformBlockMember(const char* name, size_t offset)
+		{
+			static_assert(Std140Type<T>::isValid, "unsupported uniform block member type !");
+			return { name, Std140Type<T>::shaderType, (unsigned int)offset, Std140Type<T>::alignment, Std140Type<T>::size };
+		}
+
+		#define AK_UNIFORM_BLOCK_MEMBER(block, member) \
+			::Akkad::Graphics::MakeUniformBlockMember<decltype(block::member)>(#member, offsetof(block, member))
+
+		// a C++ struct mirroring a std140 block of a shader, every block specializes it :
+		//
+		// template<> struct UniformBlockTraits<MyProps> {
+		//     static constexpr const char* NAME = "shader_props";
+		//     static constexpr UniformBlockMember MEMBERS[] = { AK_UNIFORM_BLOCK_MEMBER(MyProps, color), ... };
+		// };
+		//
+		// members are listed in declaration order, with the names the shader uses.
+		template <typename Block>
+		struct UniformBlockTraits;
+
+		// true when every member sits where std140 puts it, the struct can then be copied into the buffer as is.
+		template <typename Block>
+		constexpr bool IsStd140Layout()
+		{
+			unsigned int end = 0;
+			for (const auto& member : UniformBlockTraits<Block>::MEMBERS)
+			{
+				unsigned int offset = (end + member.alignment - 1) / member.alignment * member.alignment;
+				if (member.offset != offset)
+				{
+					return false;
+				}
+
+				end = offset + member.size;
+			}
+
+			// trailing padding is allowed up to the size of a vec4.
+			return sizeof(Block) >= end && sizeof(Block) <= (end + 15) / 16 * 16;
+		}
+
+		template <typename Block>
+		constexpr unsigned int GetUniformBlockSize()
+		{
+			unsigned int end = 0;
+			for (const auto& member : UniformBlockTraits<Block>::MEMBERS)
+			{
+				end = member.offset + member.size;
+			}
+
+			return end;
+		}
+
+		// compares a block with the one reflected from the shader's SPIR-V, logs the differences.
+		bool ValidateUniformBlock(const ShaderDescriptor& shaderDesc, const char* blockName, const UniformBlockMember* members, unsigned int memberCount);
+
+		template <typename Block>
+		bool ValidateUniformBlock(const ShaderDescriptor& shaderDesc)
+		{
+			using Traits = UniformBlockTraits<Block>;
+			return ValidateUniformBlock(shaderDesc, Traits::NAME, Traits::MEMBERS, sizeof(Traits::MEMBERS) / sizeof(Traits::MEMBERS[0]));
+		}
+	}
+}
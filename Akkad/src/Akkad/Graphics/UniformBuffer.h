@@ -1,10 +1,13 @@
 #pragma once
 #include "ShaderDataType.h"
+#include "UniformBlock.h"
 #include "Akkad/core.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <map>
 #include <vector>
@@ -30,6 +33,15 @@ namespace Akkad {
 			ShaderDataType m_Type = ShaderDataType::UNKNOWN;
 		};
 
+		// an element of a buffer resolved once from its name, writes through it skip the string search.
+		struct UniformBufferField {
+			unsigned int offset = 0;
+			unsigned int size = 0;
+			ShaderDataType type = ShaderDataType::UNKNOWN;
+
+			bool IsValid() const { return type != ShaderDataType::UNKNOWN; }
+		};
+
 		class UniformBufferLayout {
 		public:
 			void Push(std::string name, ShaderDataType type)
@@ -56,6 +68,20 @@ namespace Akkad {
 			}
 
 			std::vector<std::pair<std::string, UniformBufferElement>>& GetElements() { return m_DataMap; }
+
+			// the layout of a typed block, see UniformBlock.h.
+			template<typename Block>
+			static UniformBufferLayout CreateFromBlock()
+			{
+				UniformBufferLayout layout;
+				for (const auto& member : UniformBlockTraits<Block>::MEMBERS)
+				{
+					layout.Push(member.name, member.type);
+				}
+
+				return layout;
+			}
+
 			bool UseBindingPointCounter = true;
 			
 		private:
@@ -63,6 +89,7 @@ namespace Akkad {
 			unsigned int m_BufferSize = 0;
 			friend class GLUniformBuffer;
 			friend class GLESUniformBuffer;
+			friend class NullUniformBuffer;
 		};
 
 		/* -------------- Templates to check if the data type we are passing is supported ------------------- */
@@ -144,107 +171,112 @@ namespace Akkad {
 			virtual std::string GetName() { return ""; };
 			virtual void SetName(std::string name) {};
 
-			virtual void ResetData() = 0;
+			// uploads the whole buffer.
+			void ResetData()
+			{
+				MarkDirty(0, (unsigned int)m_BufferData.size());
+				Flush();
+			}
+
+			const std::vector<char>& GetBufferData() { return m_BufferData; }
 			virtual void SetReservedBindingPoint(RESERVED_BINDING_POINTS point) = 0;
 
+			UniformBufferField GetField(const std::string& index)
+			{
+				auto& element = m_Layout[index];
+
+				UniformBufferField field;
+				field.offset = element.offset;
+				field.size = GetSizeOfType(element.GetType());
+				field.type = element.GetType();
+				return field;
+			}
+
+			// writes go to the CPU copy, Flush() uploads the bytes that changed since the last flush.
+			// returns false when the value did not change.
 			template<typename T>
-			void SetData(std::string index, T& data)
+			bool SetData(const UniformBufferField& field, const T& data)
 			{
 				bool valid = UniformBufferDataTypeMap<T>::isValid;
 				AK_ASSERT(valid, "Trying to push unsupported data type to the uniform buffer !");
+				AK_ASSERT(field.type == UniformBufferDataTypeMap<T>::shaderType, "Uniform buffer data type mismatch !");
 
-				auto element = m_Layout[index];
-				AK_ASSERT(element.GetType() == UniformBufferDataTypeMap<T>::shaderType, "Uniform buffer data type mismatch !");
-
-				auto elementType = element.GetType();
-				
-				std::vector<char> dataBuffer;
-				dataBuffer.resize(GetSizeOfType(element.GetType()));
-
-				memcpy(dataBuffer.data(), &data, GetSizeOfType(element.GetType()));
-
-				unsigned int position = element.offset;
-				
-				for (auto it : dataBuffer)
-				{
-					m_BufferData[position] = it;
-					position += 1;
-				}
-
-				ResetData();
+				return Write(field.offset, &data, field.size);
 			}
 
 			template<typename T>
-			T GetData(std::string index) {
-				AK_ASSERT(false, "trying to get an unkown data type");
+			bool SetData(std::string index, T& data)
+			{
+				return SetData(GetField(index), data);
 			}
 
-			template<>
-			float GetData(std::string index)
+			// the whole block in a single copy, the buffer must have been created from the same block.
+			template<typename Block>
+			bool SetBlock(const Block& block)
 			{
-				auto element = m_Layout[index];
-				AK_ASSERT(element.GetType() == ShaderDataType::FLOAT, "uniform buffer data type mismatch !");
-				auto data = GetDataGeneric(index);
-				float result;
-
-				memcpy(&result, (void*)data.data(), GetSizeOfType(element.GetType()));
-
-				return result;
+				static_assert(IsStd140Layout<Block>(), "uniform block does not follow the std140 layout !");
+				return SetRawData(0, &block, GetUniformBlockSize<Block>());
 			}
 
-			template<>
-			unsigned int GetData(std::string index)
+			// raw write used when replaying recorded uniforms, returns false when the value did not change.
+			bool SetRawData(unsigned int offset, const void* data, unsigned int size)
 			{
-				auto element = m_Layout[index];
-				AK_ASSERT(element.GetType() == ShaderDataType::UNISGNED_INT, "uniform buffer data type mismatch !");
-				auto data = GetDataGeneric(index);
-				unsigned int result;
-
-				memcpy(&result, (void*)data.data(), GetSizeOfType(element.GetType()));
-
-				return result;
+				AK_ASSERT(offset + size <= m_BufferData.size(), "Uniform buffer write out of bounds !");
+				return Write(offset, data, size);
 			}
 
-			template<>
-			glm::vec2 GetData(std::string index)
+			// call it right before drawing with the buffer, a single upload covers every write since the last flush.
+			void Flush()
 			{
-				auto element = m_Layout[index];
-				AK_ASSERT(element.GetType() == ShaderDataType::FLOAT2, "uniform buffer data type mismatch !");
-				auto data = GetDataGeneric(index);
-				glm::vec2 result;
-
-				memcpy(&result, (void*)data.data(), GetSizeOfType(element.GetType()));
+				if (m_DirtyEnd > m_DirtyBegin)
+				{
+					UploadData(m_DirtyBegin, m_DirtyEnd - m_DirtyBegin);
+				}
 
-				return result;
+				m_DirtyBegin = 0xFFFFFFFF;
+				m_DirtyEnd = 0;
 			}
 
-			template<>
-			glm::vec3 GetData(std::string index)
+			bool IsDirty() { return m_DirtyEnd > m_DirtyBegin; }
+
+			// one template for every mapped type, explicit specializations inside of the class only build on MSVC.
+			template<typename T>
+			T GetData(std::string index)
 			{
+				static_assert(UniformBufferDataTypeMap<T>::isValid, "trying to get an unkown data type");
+
 				auto element = m_Layout[index];
-				AK_ASSERT(element.GetType() == ShaderDataType::FLOAT3, "uniform buffer data type mismatch !");
+				AK_ASSERT(element.GetType() == UniformBufferDataTypeMap<T>::shaderType, "uniform buffer data type mismatch !");
 				auto data = GetDataGeneric(index);
-				glm::vec3 result;
+				T result;
 
 				memcpy(&result, (void*)data.data(), GetSizeOfType(element.GetType()));
 
 				return result;
 			}
 
-			template<>
-			glm::vec4 GetData(std::string index)
+		protected:
+			// copies a range of the CPU copy into the GPU buffer.
+			virtual void UploadData(unsigned int offset, unsigned int size) = 0;
+
+			bool Write(unsigned int offset, const void* data, unsigned int size)
 			{
-				auto element = m_Layout[index];
-				AK_ASSERT(element.GetType() == ShaderDataType::FLOAT4, "uniform buffer data type mismatch !");
-				auto data = GetDataGeneric(index);
-				glm::vec4 result;
+				if (memcmp(&m_BufferData[offset], data, size) == 0)
+				{
+					return false;
+				}
 
-				memcpy(&result, (void*)data.data(), GetSizeOfType(element.GetType()));
+				memcpy(&m_BufferData[offset], data, size);
+				MarkDirty(offset, size);
+				return true;
+			}
 
-				return result;
+			void MarkDirty(unsigned int offset, unsigned int size)
+			{
+				m_DirtyBegin = std::min(m_DirtyBegin, offset);
+				m_DirtyEnd = std::max(m_DirtyEnd, offset + size);
 			}
 
-		protected:
 
 			std::vector<char> GetDataGeneric(std::string index) {
 				auto element = m_Layout[index];
@@ -264,6 +296,9 @@ namespace Akkad {
 
 			std::vector<char> m_BufferData;
 			UniformBufferLayout m_Layout;
+
+			unsigned int m_DirtyBegin = 0xFFFFFFFF;
+			unsigned int m_DirtyEnd = 0;
 		};
 	}
 }
\ No newline at end of file
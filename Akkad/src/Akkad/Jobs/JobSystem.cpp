@@ -0,0 +1,226 @@
+#include "JobSystem.h"
+
+#include "Akkad/PlatformMacros.h"
+#include "Akkad/Profiling/Profiler.h"
+
+#include <string>
+
+namespace Akkad {
+
+	namespace {
+		// a game assembly links its own copy of the engine, its threads only know the shared queue.
+		thread_local JobSystem* t_JobSystem = nullptr;
+		thread_local int t_QueueIndex = -1;
+	}
+
+	JobSystem::JobSystem(int workerCount)
+	{
+#ifdef AK_PLATFORM_WEB
+		workerCount = 0;
+#else
+		if (workerCount < 0)
+		{
+			unsigned int hardwareThreads = std::thread::hardware_concurrency();
+			workerCount = hardwareThreads > 1 ? (int)hardwareThreads - 1 : 0;
+		}
+#endif
+
+		t_JobSystem = this;
+		t_QueueIndex = 0;
+		m_Queues.emplace_back(new Worker());
+
+		for (int i = 0; i < workerCount; i++)
+		{
+			m_Queues.emplace_back(new Worker());
+			m_Workers.push_back(m_Queues.back().get());
+		}
+
+		// the deques have to exist before any worker can steal from them.
+		for (unsigned int i = 0; i < m_Workers.size(); i++)
+		{
+			m_Workers[i]->thread = std::thread(&JobSystem::WorkerLoop, this, i + 1);
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		Shutdown();
+	}
+
+	void JobSystem::Shutdown()
+	{
+		if (m_Workers.empty())
+		{
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			m_StopRequested = true;
+		}
+
+		m_JobAvailable.notify_all();
+
+		for (auto worker : m_Workers)
+		{
+			worker->thread.join();
+		}
+
+		m_Workers.clear();
+
+		// the workers drain what they can reach, jobs pushed meanwhile by the calling thread are left.
+		while (Job* job = FindJob(GetQueueIndex()))
+		{
+			Execute(job);
+		}
+	}
+
+	void JobSystem::Submit(JobFunction function, JobCounter* counter)
+	{
+		if (counter != nullptr)
+		{
+			counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		Job* job = new Job{ std::move(function), counter };
+
+		if (m_Workers.empty())
+		{
+			Execute(job);
+			return;
+		}
+
+		// counted before it is published, a thread taking it right away decrements the count after this.
+		m_QueuedJobs.fetch_add(1);
+
+		int queueIndex = GetQueueIndex();
+		if (queueIndex >= 0)
+		{
+			m_Queues[queueIndex]->deque.Push(job);
+		}
+		else
+		{
+			m_SharedJobs.enqueue(job);
+		}
+
+		// a worker going to sleep counts itself before checking the queued jobs, so one of the two sees the other.
+		if (m_SleepingThreads.load() > 0)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_SleepMutex);
+			}
+
+			m_JobAvailable.notify_one();
+		}
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			if (RunOneJob())
+			{
+				continue;
+			}
+
+			// the remaining jobs are running on other threads, a new job wakes this thread up to help.
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			m_SleepingThreads++;
+			m_WaitingThreads++;
+			m_JobAvailable.wait(lock, [this, &counter]() { return counter.IsDone() || m_QueuedJobs.load() > 0; });
+			m_WaitingThreads--;
+			m_SleepingThreads--;
+		}
+	}
+
+	bool JobSystem::RunOneJob()
+	{
+		Job* job = FindJob(GetQueueIndex());
+		if (job == nullptr)
+		{
+			return false;
+		}
+
+		Execute(job);
+		return true;
+	}
+
+	void JobSystem::WorkerLoop(unsigned int queueIndex)
+	{
+		t_JobSystem = this;
+		t_QueueIndex = (int)queueIndex;
+
+		std::string name = "Job Worker " + std::to_string(queueIndex);
+		AK_PROFILE_THREAD(name.c_str());
+
+		while (true)
+		{
+			if (Job* job = FindJob((int)queueIndex))
+			{
+				Execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_SleepMutex);
+			if (m_StopRequested && m_QueuedJobs.load() == 0)
+			{
+				break;
+			}
+
+			m_SleepingThreads++;
+			m_JobAvailable.wait(lock, [this]() { return m_QueuedJobs.load() > 0 || m_StopRequested; });
+			m_SleepingThreads--;
+		}
+	}
+
+	int JobSystem::GetQueueIndex()
+	{
+		return t_JobSystem == this ? t_QueueIndex : -1;
+	}
+
+	JobSystem::Job* JobSystem::FindJob(int queueIndex)
+	{
+		Job* job = nullptr;
+
+		// the own deque first, newest job first, its data is likely still in the cache.
+		bool found = queueIndex >= 0 && m_Queues[queueIndex]->deque.Pop(job);
+		found = found || m_SharedJobs.try_dequeue(job);
+
+		// then the oldest job of another deque, starting after the own one so thieves spread out.
+		for (size_t i = 1; !found && i <= m_Queues.size(); i++)
+		{
+			size_t victim = (queueIndex + i) % m_Queues.size();
+			if ((int)victim != queueIndex)
+			{
+				found = m_Queues[victim]->deque.Steal(job);
+			}
+		}
+
+		if (!found)
+		{
+			return nullptr;
+		}
+
+		m_QueuedJobs.fetch_sub(1);
+		return job;
+	}
+
+	void JobSystem::Execute(Job* job)
+	{
+		job->function();
+
+		// the waiting thread may destroy the counter as soon as it reaches zero.
+		JobCounter* counter = job->counter;
+		delete job;
+
+		if (counter != nullptr && counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			// a thread blocked in Wait() checks the counter under the lock, so it either sees zero or gets notified.
+			std::lock_guard<std::mutex> lock(m_SleepMutex);
+			if (m_WaitingThreads > 0)
+			{
+				m_JobAvailable.notify_all();
+			}
+		}
+	}
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include "WorkStealingDeque.h"
+
+#include <concurrentqueue.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Akkad {
+
+	// the jobs of a fork/join group that did not finish yet, see JobSystem::Wait().
+	class JobCounter
+	{
+	public:
+		bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+
+	private:
+		std::atomic<unsigned int> m_Pending{ 0 };
+		friend class JobSystem;
+	};
+
+	// fixed pool of worker threads, owned by the Application, see Application::GetJobSystem().
+	// the main thread and every worker own a work stealing deque, jobs submitted from any other thread go
+	// through a shared queue. idle threads steal the oldest job of another deque.
+	// without workers, always the case on the web, jobs run inline when they are submitted.
+	class JobSystem
+	{
+	public:
+		using JobFunction = std::function<void()>;
+
+		// a negative worker count uses one worker per hardware thread besides the calling thread, which
+		// becomes the main thread of the system.
+		JobSystem(int workerCount = -1);
+		~JobSystem();
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		// finishes the queued jobs and joins the workers, later submissions run inline.
+		void Shutdown();
+
+		// the counter, when given, is incremented now and decremented once the job finished.
+		void Submit(JobFunction function, JobCounter* counter = nullptr);
+
+		// runs queued jobs until the counter reaches zero, so a job can wait on the jobs it submitted.
+		// the thread sleeps while the remaining jobs run on other threads.
+		void Wait(JobCounter& counter);
+
+		// runs one queued job on the calling thread, returns false when there was none to take.
+		bool RunOneJob();
+
+		// calls function(rangeBegin, rangeEnd) over [begin, end) split in chunks of at least grainSize,
+		// the calling thread takes part and the call returns once every chunk is done.
+		template<typename Function>
+		void ParallelFor(size_t begin, size_t end, size_t grainSize, Function function)
+		{
+			if (end <= begin)
+			{
+				return;
+			}
+
+			size_t count = end - begin;
+			grainSize = std::max<size_t>(grainSize, 1);
+
+			if (m_Workers.empty() || count <= grainSize)
+			{
+				function(begin, end);
+				return;
+			}
+
+			// a few chunks per thread leave room for stealing when the chunks are uneven.
+			size_t chunkCount = std::min((count + grainSize - 1) / grainSize, (size_t)GetThreadCount() * 4);
+			size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+
+			JobCounter counter;
+			for (size_t chunkBegin = begin + chunkSize; chunkBegin < end; chunkBegin += chunkSize)
+			{
+				size_t chunkEnd = std::min(chunkBegin + chunkSize, end);
+				Submit([&function, chunkBegin, chunkEnd]() { function(chunkBegin, chunkEnd); }, &counter);
+			}
+
+			function(begin, std::min(begin + chunkSize, end));
+			Wait(counter);
+		}
+
+		unsigned int GetWorkerCount() const { return (unsigned int)m_Workers.size(); }
+		// workers and the main thread.
+		unsigned int GetThreadCount() const { return GetWorkerCount() + 1; }
+
+	private:
+		struct Job
+		{
+			JobFunction function;
+			JobCounter* counter;
+		};
+
+		struct Worker
+		{
+			WorkStealingDeque<Job*> deque;
+			std::thread thread;
+		};
+
+		void WorkerLoop(unsigned int queueIndex);
+		// -1 for threads without a deque of this system.
+		int GetQueueIndex();
+		Job* FindJob(int queueIndex);
+		void Execute(Job* job);
+
+		// index 0 belongs to the main thread, the workers follow.
+		std::vector<std::unique_ptr<Worker>> m_Queues;
+		std::vector<Worker*> m_Workers;
+		moodycamel::ConcurrentQueue<Job*> m_SharedJobs;
+
+		// queued jobs that no thread took yet, idle workers sleep while it is zero.
+		std::atomic<unsigned int> m_QueuedJobs{ 0 };
+		// idle workers and threads blocked in Wait().
+		std::atomic<unsigned int> m_SleepingThreads{ 0 };
+		// threads blocked in Wait(), guarded by m_SleepMutex.
+		unsigned int m_WaitingThreads = 0;
+		std::mutex m_SleepMutex;
+		std::condition_variable m_JobAvailable;
+		std::atomic<bool> m_StopRequested{ false };
+	};
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Akkad {
+
+	// chase-lev deque, as corrected for weak memory models by Le, Pop, Cohen and Zappa Nardelli.
+	// the owner thread pushes and pops at the bottom, any thread steals from the top. T has to be
+	// trivially copyable, the job system stores pointers.
+	template<typename T>
+	class WorkStealingDeque
+	{
+	public:
+		WorkStealingDeque(int64_t capacity = 1024)
+		{
+			m_Buffers.emplace_back(new Buffer(capacity));
+			m_Buffer.store(m_Buffers.back().get(), std::memory_order_relaxed);
+		}
+
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+		// owner only.
+		void Push(T item)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+
+			if (bottom - top > buffer->capacity - 1)
+			{
+				buffer = Grow(buffer, top, bottom);
+			}
+
+			buffer->Put(bottom, item);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		// owner only, takes the newest item.
+		bool Pop(T& item)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return false;
+			}
+
+			item = buffer->Get(bottom);
+			if (top == bottom)
+			{
+				// the last item, a thief may be taking it at the same time.
+				bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return won;
+			}
+
+			return true;
+		}
+
+		// any thread, takes the oldest item. fails when the deque is empty or another thread won the race.
+		bool Steal(T& item)
+		{
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+			{
+				return false;
+			}
+
+			Buffer* buffer = m_Buffer.load(std::memory_order_acquire);
+			item = buffer->Get(top);
+			return m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		}
+
+		bool IsEmpty() const
+		{
+			return m_Top.load(std::memory_order_relaxed) >= m_Bottom.load(std::memory_order_relaxed);
+		}
+
+	private:
+		struct Buffer
+		{
+			Buffer(int64_t capacity) : capacity(capacity), mask(capacity - 1), items(new std::atomic<T>[capacity]) {}
+
+			void Put(int64_t index, T item) { items[index & mask].store(item, std::memory_order_relaxed); }
+			T Get(int64_t index) { return items[index & mask].load(std::memory_order_relaxed); }
+
+			int64_t capacity; // power of two
+			int64_t mask;
+			std::unique_ptr<std::atomic<T>[]> items;
+		};
+
+		// thieves may still read the old buffer, it is kept until the deque is destroyed.
+		Buffer* Grow(Buffer* buffer, int64_t top, int64_t bottom)
+		{
+			Buffer* grown = new Buffer(buffer->capacity * 2);
+			for (int64_t i = top; i < bottom; i++)
+			{
+				grown->Put(i, buffer->Get(i));
+			}
+
+			m_Buffers.emplace_back(grown);
+			m_Buffer.store(grown, std::memory_order_release);
+			return grown;
+		}
+
+		alignas(64) std::atomic<int64_t> m_Top{ 0 };
+		alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+		std::atomic<Buffer*> m_Buffer;
+		std::vector<std::unique_ptr<Buffer>> m_Buffers;
+	};
+}
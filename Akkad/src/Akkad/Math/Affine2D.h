@@ -0,0 +1,93 @@
+#pragma once
+#include <glm/glm.hpp>
+
+#include <cmath>
+
+namespace Akkad {
+
+	// a 2D affine transform stored as the two linear columns and the translation of a 3x2 matrix:
+	// | a c tx |
+	// | b d ty |
+	struct Affine2D
+	{
+		float a = 1.0f, b = 0.0f;
+		float c = 0.0f, d = 1.0f;
+		float tx = 0.0f, ty = 0.0f;
+
+		// same order as the 3D transforms, translate * scale * rotate, so both give the same matrix for a 2D entity.
+		static Affine2D FromTRS(glm::vec2 position, float rotation, glm::vec2 scale)
+		{
+			float sin = std::sin(rotation);
+			float cos = std::cos(rotation);
+
+			Affine2D result;
+			result.a = scale.x * cos;
+			result.b = scale.y * sin;
+			result.c = -scale.x * sin;
+			result.d = scale.y * cos;
+			result.tx = position.x;
+			result.ty = position.y;
+			return result;
+		}
+
+		// drops everything that does not act on the xy plane.
+		static Affine2D FromMat4(const glm::mat4& matrix)
+		{
+			Affine2D result;
+			result.a = matrix[0][0];
+			result.b = matrix[0][1];
+			result.c = matrix[1][0];
+			result.d = matrix[1][1];
+			result.tx = matrix[3][0];
+			result.ty = matrix[3][1];
+			return result;
+		}
+
+		Affine2D operator*(const Affine2D& other) const
+		{
+			Affine2D result;
+			result.a = a * other.a + c * other.b;
+			result.b = b * other.a + d * other.b;
+			result.c = a * other.c + c * other.d;
+			result.d = b * other.c + d * other.d;
+			result.tx = a * other.tx + c * other.ty + tx;
+			result.ty = b * other.tx + d * other.ty + ty;
+			return result;
+		}
+
+		glm::vec2 TransformPoint(glm::vec2 point) const
+		{
+			return { a * point.x + c * point.y + tx, b * point.x + d * point.y + ty };
+		}
+
+		Affine2D Inverse() const
+		{
+			float determinant = a * d - b * c;
+			float inverseDeterminant = determinant != 0.0f ? 1.0f / determinant : 0.0f;
+
+			Affine2D result;
+			result.a = d * inverseDeterminant;
+			result.b = -b * inverseDeterminant;
+			result.c = -c * inverseDeterminant;
+			result.d = a * inverseDeterminant;
+			result.tx = -(result.a * tx + result.c * ty);
+			result.ty = -(result.b * tx + result.d * ty);
+			return result;
+		}
+
+		glm::vec2 GetTranslation() const { return { tx, ty }; }
+
+		glm::mat4 ToMat4(float z) const
+		{
+			glm::mat4 result(1.0f);
+			result[0][0] = a;
+			result[0][1] = b;
+			result[1][0] = c;
+			result[1][1] = d;
+			result[3][0] = tx;
+			result[3][1] = ty;
+			result[3][2] = z;
+			return result;
+		}
+	};
+}
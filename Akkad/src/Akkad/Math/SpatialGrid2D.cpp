@@ -0,0 +1,54 @@
+#include "SpatialGrid2D.h"
+
+#include <cmath>
+
+namespace Akkad {
+
+	void SpatialGrid2D::Clear()
+	{
+		// the cell vectors are kept, moving items reuse them from one rebuild to the next.
+		for (auto& cell : m_Cells)
+		{
+			cell.second.clear();
+		}
+
+		m_LargeItems.clear();
+	}
+
+	void SpatialGrid2D::SetCellSize(float cellSize)
+	{
+		// the cells of the old size would never be reused.
+		if (cellSize != m_CellSize)
+		{
+			m_Cells.clear();
+			m_CellSize = cellSize;
+		}
+	}
+
+	void SpatialGrid2D::Insert(uint32_t item, glm::vec2 min, glm::vec2 max)
+	{
+		if (!std::isfinite(min.x) || !std::isfinite(min.y) || !std::isfinite(max.x) || !std::isfinite(max.y))
+		{
+			return;
+		}
+
+		int minX = GetCell(min.x);
+		int minY = GetCell(min.y);
+		int maxX = GetCell(max.x);
+		int maxY = GetCell(max.y);
+
+		if ((int64_t)(maxX - minX + 1) * (maxY - minY + 1) > MAX_CELLS_PER_ITEM)
+		{
+			m_LargeItems.push_back(item);
+			return;
+		}
+
+		for (int y = minY; y <= maxY; y++)
+		{
+			for (int x = minX; x <= maxX; x++)
+			{
+				m_Cells[GetCellKey(x, y)].push_back(item);
+			}
+		}
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Akkad {
+
+	// uniform grid over 2D bounding boxes, finds the boxes that may contain a point without testing all of them.
+	// items are referenced by an index chosen by the caller, a box is stored in every cell it overlaps.
+	class SpatialGrid2D
+	{
+	public:
+		enum { MAX_CELLS_PER_ITEM = 64 };
+
+		void Clear();
+		void SetCellSize(float cellSize);
+		void Insert(uint32_t item, glm::vec2 min, glm::vec2 max);
+
+		// calls callback(item) for every item stored in the cell of the point, the caller tests the exact shape.
+		template<typename Callback>
+		void Query(glm::vec2 point, Callback callback)
+		{
+			auto it = m_Cells.find(GetCellKey(GetCell(point.x), GetCell(point.y)));
+			if (it != m_Cells.end())
+			{
+				for (auto item : it->second)
+				{
+					callback(item);
+				}
+			}
+
+			for (auto item : m_LargeItems)
+			{
+				callback(item);
+			}
+		}
+
+	private:
+		int GetCell(float position) { return (int)glm::clamp(glm::floor(position / m_CellSize), -1.0e9f, 1.0e9f); }
+		static uint64_t GetCellKey(int x, int y) { return ((uint64_t)(uint32_t)x << 32) | (uint32_t)y; }
+
+		float m_CellSize = 1.0f;
+		std::unordered_map<uint64_t, std::vector<uint32_t>> m_Cells;
+		// items covering more than MAX_CELLS_PER_ITEM cells, returned by every query.
+		std::vector<uint32_t> m_LargeItems;
+	};
+}
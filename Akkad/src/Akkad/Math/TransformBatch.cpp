@@ -0,0 +1,181 @@
+#include "TransformBatch.h"
+#include "TransformBatchKernel.h"
+
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define AK_TRANSFORM_BATCH_X86
+#ifdef _MSC_VER
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+#endif
+
+namespace Akkad {
+
+	namespace TransformBatchKernel {
+
+		const glm::mat4* GetIdentityMatrix()
+		{
+			static const glm::mat4 identity(1.0f);
+			return &identity;
+		}
+
+		void MultiplyMatrices(const glm::mat4* parent, const glm::mat4* local, glm::mat4* out)
+		{
+			*out = *parent * *local;
+		}
+	}
+
+	namespace {
+
+		bool IsAVX2Supported()
+		{
+#if defined(AK_TRANSFORM_BATCH_X86) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			if (info[0] < 7)
+			{
+				return false;
+			}
+
+			// the OS has to save the ymm registers too.
+			__cpuid(info, 1);
+			bool fma = (info[2] & (1 << 12)) != 0;
+			bool osxsave = (info[2] & (1 << 27)) != 0;
+			bool avx = (info[2] & (1 << 28)) != 0;
+			if (!fma || !osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+			{
+				return false;
+			}
+
+			__cpuidex(info, 7, 0);
+			return (info[1] & (1 << 5)) != 0;
+#elif defined(AK_TRANSFORM_BATCH_X86)
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+			return false;
+#endif
+		}
+
+		SIMDLevel GetBestSIMDLevel()
+		{
+#if defined(AK_TRANSFORM_BATCH_X86)
+			return IsAVX2Supported() ? SIMDLevel::AVX2 : SIMDLevel::SSE;
+#elif defined(__wasm_simd128__)
+			return SIMDLevel::WasmSIMD;
+#else
+			return SIMDLevel::Scalar;
+#endif
+		}
+
+		SIMDLevel& GetActiveSIMDLevel()
+		{
+			static SIMDLevel s_SIMDLevel = GetBestSIMDLevel();
+			return s_SIMDLevel;
+		}
+	}
+
+	void TransformBatch::ComputeWorldMatrices(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t count)
+	{
+		size_t index = 0;
+
+		switch (GetActiveSIMDLevel())
+		{
+#if defined(AK_TRANSFORM_BATCH_X86)
+		case SIMDLevel::SSE:
+			index = TransformBatchKernel::ComputeWorldMatricesSSE(transforms, parents, localMatrices, worldMatrices, 0, count);
+			break;
+		case SIMDLevel::AVX2:
+			index = TransformBatchKernel::ComputeWorldMatricesAVX2(transforms, parents, localMatrices, worldMatrices, 0, count);
+			break;
+#endif
+#ifdef __wasm_simd128__
+		case SIMDLevel::WasmSIMD:
+			index = TransformBatchKernel::ComputeWorldMatricesWasmSIMD(transforms, parents, localMatrices, worldMatrices, 0, count);
+			break;
+#endif
+		default:
+			break;
+		}
+
+		ComputeWorldMatricesScalar(transforms, parents, localMatrices, worldMatrices, index, count);
+	}
+
+	void TransformBatch::ComputeWorldMatricesScalar(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t begin, size_t end)
+	{
+		for (size_t i = begin; i < end; i++)
+		{
+			float sinX = std::sin(transforms.rotationX[i]), cosX = std::cos(transforms.rotationX[i]);
+			float sinY = std::sin(transforms.rotationY[i]), cosY = std::cos(transforms.rotationY[i]);
+			float sinZ = std::sin(transforms.rotationZ[i]), cosZ = std::cos(transforms.rotationZ[i]);
+			float scaleX = transforms.scaleX[i];
+			float scaleY = transforms.scaleY[i];
+			float scaleZ = transforms.scaleZ[i];
+
+			auto& local = localMatrices[i];
+			local[0] = { scaleX * cosY * cosZ, scaleY * (sinX * sinY * cosZ + cosX * sinZ), scaleZ * (sinX * sinZ - cosX * sinY * cosZ), 0.0f };
+			local[1] = { -scaleX * cosY * sinZ, scaleY * (cosX * cosZ - sinX * sinY * sinZ), scaleZ * (cosX * sinY * sinZ + sinX * cosZ), 0.0f };
+			local[2] = { scaleX * sinY, -scaleY * sinX * cosY, scaleZ * cosX * cosY, 0.0f };
+			local[3] = { transforms.positionX[i], transforms.positionY[i], transforms.positionZ[i], 1.0f };
+
+			uint32_t parent = parents != nullptr ? parents[i] : INVALID_PARENT;
+			worldMatrices[i] = parent != INVALID_PARENT ? worldMatrices[parent] * local : local;
+		}
+	}
+
+	SIMDLevel TransformBatch::GetSIMDLevel()
+	{
+		return GetActiveSIMDLevel();
+	}
+
+	bool TransformBatch::SetSIMDLevel(SIMDLevel level)
+	{
+		if (!IsSIMDLevelSupported(level))
+		{
+			return false;
+		}
+
+		GetActiveSIMDLevel() = level;
+		return true;
+	}
+
+	bool TransformBatch::IsSIMDLevelSupported(SIMDLevel level)
+	{
+		switch (level)
+		{
+		case SIMDLevel::Scalar:
+			return true;
+#if defined(AK_TRANSFORM_BATCH_X86)
+		case SIMDLevel::SSE:
+			return true;
+		case SIMDLevel::AVX2:
+			return IsAVX2Supported();
+#endif
+#ifdef __wasm_simd128__
+		case SIMDLevel::WasmSIMD:
+			return true;
+#endif
+		default:
+			return false;
+		}
+	}
+
+	const char* TransformBatch::GetSIMDLevelName(SIMDLevel level)
+	{
+		switch (level)
+		{
+		case SIMDLevel::Scalar:
+			return "Scalar";
+		case SIMDLevel::SSE:
+			return "SSE";
+		case SIMDLevel::AVX2:
+			return "AVX2";
+		case SIMDLevel::WasmSIMD:
+			return "WasmSIMD";
+		default:
+			return "Unknown";
+		}
+	}
+}
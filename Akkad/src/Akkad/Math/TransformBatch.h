@@ -0,0 +1,50 @@
+#pragma once
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Akkad {
+
+	// translation, euler rotation and scale of a batch of transforms, one array per component.
+	struct TransformSoA {
+		const float* positionX;
+		const float* positionY;
+		const float* positionZ;
+		const float* rotationX;
+		const float* rotationY;
+		const float* rotationZ;
+		const float* scaleX;
+		const float* scaleY;
+		const float* scaleZ;
+	};
+
+	enum class SIMDLevel {
+		Scalar,
+		SSE,
+		AVX2,
+		WasmSIMD
+	};
+
+	// computes local matrices, translate * scale * rotate(x, y, z) like TransformComponent, and world matrices
+	// for 4 or 8 transforms at a time. the best instruction set the CPU supports is picked on first use.
+	class TransformBatch
+	{
+	public:
+		enum : uint32_t { INVALID_PARENT = 0xFFFFFFFF };
+
+		// parents index into the same batch and have to come before their children, INVALID_PARENT marks a root.
+		// parents may be null when every transform is a root. a lane group whose parent sits in the same group
+		// falls back to the scalar parent multiplication.
+		static void ComputeWorldMatrices(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t count);
+
+		// the same closed form one transform at a time, used for the tail of a batch and when no SIMD level is available.
+		static void ComputeWorldMatricesScalar(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t begin, size_t end);
+
+		static SIMDLevel GetSIMDLevel();
+		// returns false and keeps the current level if the CPU or the build does not support the requested one.
+		static bool SetSIMDLevel(SIMDLevel level);
+		static bool IsSIMDLevelSupported(SIMDLevel level);
+		static const char* GetSIMDLevelName(SIMDLevel level);
+	};
+}
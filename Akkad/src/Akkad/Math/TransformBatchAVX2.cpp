@@ -0,0 +1,97 @@
+#include "TransformBatchKernel.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+
+// this file is built with AVX2 and FMA enabled, see premake5.lua. it only runs once TransformBatch
+// has checked that the CPU supports both.
+namespace Akkad {
+	namespace TransformBatchKernel {
+
+		struct AVX2Ops
+		{
+			using V = __m256;
+			using I = __m256i;
+			static constexpr size_t Width = 8;
+
+			static V Set1(float value) { return _mm256_set1_ps(value); }
+			static V Load(const float* data) { return _mm256_loadu_ps(data); }
+			static V Add(V a, V b) { return _mm256_add_ps(a, b); }
+			static V Sub(V a, V b) { return _mm256_sub_ps(a, b); }
+			static V Mul(V a, V b) { return _mm256_mul_ps(a, b); }
+			static V MulAdd(V a, V b, V c) { return _mm256_fmadd_ps(a, b, c); }
+			static V Xor(V a, V b) { return _mm256_xor_ps(a, b); }
+
+			static I RoundToInt(V value) { return _mm256_cvtps_epi32(value); }
+			static V ToFloat(I value) { return _mm256_cvtepi32_ps(value); }
+			static I AddInt(I value, int addend) { return _mm256_add_epi32(value, _mm256_set1_epi32(addend)); }
+			static I AndInt(I value, int mask) { return _mm256_and_si256(value, _mm256_set1_epi32(mask)); }
+
+			static V SignFromBit1(I value)
+			{
+				return _mm256_castsi256_ps(_mm256_slli_epi32(AndInt(value, 2), 30));
+			}
+
+			static V SelectOnBit0(I value, V a, V b)
+			{
+				V mask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(AndInt(value, 1), _mm256_set1_epi32(1)));
+				return _mm256_blendv_ps(b, a, mask);
+			}
+
+			// lanes 0-3 and 4-7 are transposed separately, the halves of a register never cross in AVX.
+			static void LoadMatrices(const glm::mat4* const* matrices, V out[16])
+			{
+				for (int column = 0; column < 4; column++)
+				{
+					__m128 low0 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[0]) + column * 4);
+					__m128 low1 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[1]) + column * 4);
+					__m128 low2 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[2]) + column * 4);
+					__m128 low3 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[3]) + column * 4);
+					__m128 high0 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[4]) + column * 4);
+					__m128 high1 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[5]) + column * 4);
+					__m128 high2 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[6]) + column * 4);
+					__m128 high3 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[7]) + column * 4);
+					_MM_TRANSPOSE4_PS(low0, low1, low2, low3);
+					_MM_TRANSPOSE4_PS(high0, high1, high2, high3);
+
+					out[column * 4] = _mm256_set_m128(high0, low0);
+					out[column * 4 + 1] = _mm256_set_m128(high1, low1);
+					out[column * 4 + 2] = _mm256_set_m128(high2, low2);
+					out[column * 4 + 3] = _mm256_set_m128(high3, low3);
+				}
+			}
+
+			static void StoreMatrices(const V in[16], glm::mat4* out)
+			{
+				for (int column = 0; column < 4; column++)
+				{
+					__m128 low0 = _mm256_castps256_ps128(in[column * 4]);
+					__m128 low1 = _mm256_castps256_ps128(in[column * 4 + 1]);
+					__m128 low2 = _mm256_castps256_ps128(in[column * 4 + 2]);
+					__m128 low3 = _mm256_castps256_ps128(in[column * 4 + 3]);
+					__m128 high0 = _mm256_extractf128_ps(in[column * 4], 1);
+					__m128 high1 = _mm256_extractf128_ps(in[column * 4 + 1], 1);
+					__m128 high2 = _mm256_extractf128_ps(in[column * 4 + 2], 1);
+					__m128 high3 = _mm256_extractf128_ps(in[column * 4 + 3], 1);
+					_MM_TRANSPOSE4_PS(low0, low1, low2, low3);
+					_MM_TRANSPOSE4_PS(high0, high1, high2, high3);
+
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 0) + column * 4, low0);
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 1) + column * 4, low1);
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 2) + column * 4, low2);
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 3) + column * 4, low3);
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 4) + column * 4, high0);
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 5) + column * 4, high1);
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 6) + column * 4, high2);
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 7) + column * 4, high3);
+				}
+			}
+		};
+
+		size_t ComputeWorldMatricesAVX2(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t begin, size_t end)
+		{
+			return ComputeWorldMatrices<AVX2Ops>(transforms, parents, localMatrices, worldMatrices, begin, end);
+		}
+	}
+}
+#endif
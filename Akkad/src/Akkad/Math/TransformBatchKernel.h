@@ -0,0 +1,172 @@
+#pragma once
+#include "TransformBatch.h"
+
+// shared by the TransformBatch instruction set files, every file instantiates the kernel with its own Ops.
+// Ops works on Ops::Width lanes:
+//   V Set1(float), V Load(const float*), V Add(V, V), V Sub(V, V), V Mul(V, V), V MulAdd(V a, V b, V c) = a * b + c,
+//   V Xor(V, V), I RoundToInt(V), V ToFloat(I), I AddInt(I, int), I AndInt(I, int),
+//   V SignFromBit1(I) the sign bit where bit 1 is set, V SelectOnBit0(I, V a, V b) a where bit 0 is set, b otherwise,
+//   void LoadMatrices(const glm::mat4* const* matrices, V out[16]) gathers Width matrices, out[column * 4 + row],
+//   void StoreMatrices(const V in[16], glm::mat4* out) scatters Width contiguous matrices.
+// the files are built with different instruction sets, so nothing here may call an inline function they share,
+// like the glm operators, the linker keeps one copy of those for the whole program.
+
+namespace Akkad {
+	namespace TransformBatchKernel {
+
+		// defined in TransformBatch.cpp, which is built for the baseline instruction set.
+		const glm::mat4* GetIdentityMatrix();
+		void MultiplyMatrices(const glm::mat4* parent, const glm::mat4* local, glm::mat4* out);
+
+		// one quadrant of cody-waite reduction and the cephes polynomials, about 1e-7 off for angles below 1e4.
+		template<typename Ops, typename V = typename Ops::V>
+		inline void SinCos(V x, V& sin, V& cos)
+		{
+			auto quadrant = Ops::RoundToInt(Ops::Mul(x, Ops::Set1(0.636619772367581343f)));
+			V q = Ops::ToFloat(quadrant);
+
+			V r = Ops::MulAdd(q, Ops::Set1(-1.5703125f), x);
+			r = Ops::MulAdd(q, Ops::Set1(-4.837512969970703125e-4f), r);
+			r = Ops::MulAdd(q, Ops::Set1(-7.54978995489188216e-8f), r);
+			V r2 = Ops::Mul(r, r);
+
+			V s = Ops::MulAdd(r2, Ops::Set1(-1.9515295891e-4f), Ops::Set1(8.3321608736e-3f));
+			s = Ops::MulAdd(s, r2, Ops::Set1(-1.6666654611e-1f));
+			s = Ops::MulAdd(Ops::Mul(s, r2), r, r);
+
+			V c = Ops::MulAdd(r2, Ops::Set1(2.443315711809948e-5f), Ops::Set1(-1.388731625493765e-3f));
+			c = Ops::MulAdd(c, r2, Ops::Set1(4.166664568298827e-2f));
+			c = Ops::MulAdd(Ops::Mul(c, r2), r2, Ops::MulAdd(r2, Ops::Set1(-0.5f), Ops::Set1(1.0f)));
+
+			// quadrant 1 and 3 swap the results, sin flips in quadrant 2 and 3, cos in 1 and 2.
+			sin = Ops::Xor(Ops::SelectOnBit0(quadrant, c, s), Ops::SignFromBit1(quadrant));
+			cos = Ops::Xor(Ops::SelectOnBit0(quadrant, s, c), Ops::SignFromBit1(Ops::AddInt(quadrant, 1)));
+		}
+
+		// out[column * 4 + row] = translate * scale * rotate(x) * rotate(y) * rotate(z), as glm builds it.
+		template<typename Ops, typename V = typename Ops::V>
+		inline void ComputeLocal(const TransformSoA& transforms, size_t index, V out[16])
+		{
+			V sinX, cosX, sinY, cosY, sinZ, cosZ;
+			SinCos<Ops>(Ops::Load(transforms.rotationX + index), sinX, cosX);
+			SinCos<Ops>(Ops::Load(transforms.rotationY + index), sinY, cosY);
+			SinCos<Ops>(Ops::Load(transforms.rotationZ + index), sinZ, cosZ);
+
+			V scaleX = Ops::Load(transforms.scaleX + index);
+			V scaleY = Ops::Load(transforms.scaleY + index);
+			V scaleZ = Ops::Load(transforms.scaleZ + index);
+
+			V sinXsinY = Ops::Mul(sinX, sinY);
+			V cosXsinY = Ops::Mul(cosX, sinY);
+			V zero = Ops::Set1(0.0f);
+
+			out[0] = Ops::Mul(scaleX, Ops::Mul(cosY, cosZ));
+			out[1] = Ops::Mul(scaleY, Ops::MulAdd(sinXsinY, cosZ, Ops::Mul(cosX, sinZ)));
+			out[2] = Ops::Mul(scaleZ, Ops::Sub(Ops::Mul(sinX, sinZ), Ops::Mul(cosXsinY, cosZ)));
+			out[3] = zero;
+
+			out[4] = Ops::Mul(scaleX, Ops::Sub(zero, Ops::Mul(cosY, sinZ)));
+			out[5] = Ops::Mul(scaleY, Ops::Sub(Ops::Mul(cosX, cosZ), Ops::Mul(sinXsinY, sinZ)));
+			out[6] = Ops::Mul(scaleZ, Ops::MulAdd(cosXsinY, sinZ, Ops::Mul(sinX, cosZ)));
+			out[7] = zero;
+
+			out[8] = Ops::Mul(scaleX, sinY);
+			out[9] = Ops::Mul(scaleY, Ops::Sub(zero, Ops::Mul(sinX, cosY)));
+			out[10] = Ops::Mul(scaleZ, Ops::Mul(cosX, cosY));
+			out[11] = zero;
+
+			out[12] = Ops::Load(transforms.positionX + index);
+			out[13] = Ops::Load(transforms.positionY + index);
+			out[14] = Ops::Load(transforms.positionZ + index);
+			out[15] = Ops::Set1(1.0f);
+		}
+
+		// parent * local, the last row of local is (0, 0, 0, 1).
+		template<typename Ops, typename V = typename Ops::V>
+		inline void MultiplyParent(const V parent[16], const V local[16], V out[16])
+		{
+			for (int column = 0; column < 4; column++)
+			{
+				for (int row = 0; row < 4; row++)
+				{
+					V value = Ops::Mul(parent[row], local[column * 4]);
+					value = Ops::MulAdd(parent[4 + row], local[column * 4 + 1], value);
+					value = Ops::MulAdd(parent[8 + row], local[column * 4 + 2], value);
+
+					if (column == 3)
+					{
+						value = Ops::Add(value, parent[12 + row]);
+					}
+
+					out[column * 4 + row] = value;
+				}
+			}
+		}
+
+		// processes whole lane groups from begin and returns where it stopped, the caller finishes the tail.
+		template<typename Ops, typename V = typename Ops::V>
+		size_t ComputeWorldMatrices(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t begin, size_t end)
+		{
+			constexpr size_t width = Ops::Width;
+			const glm::mat4* identity = GetIdentityMatrix();
+
+			size_t index = begin;
+			for (; index + width <= end; index += width)
+			{
+				V local[16];
+				ComputeLocal<Ops>(transforms, index, local);
+				Ops::StoreMatrices(local, localMatrices + index);
+
+				const glm::mat4* parentMatrices[width];
+				bool hasParent = false;
+				bool parentInGroup = false;
+
+				for (size_t lane = 0; lane < width; lane++)
+				{
+					uint32_t parent = parents != nullptr ? parents[index + lane] : TransformBatch::INVALID_PARENT;
+					if (parent == TransformBatch::INVALID_PARENT)
+					{
+						parentMatrices[lane] = identity;
+						continue;
+					}
+
+					hasParent = true;
+					parentInGroup |= parent >= index;
+					parentMatrices[lane] = worldMatrices + parent;
+				}
+
+				if (!hasParent)
+				{
+					Ops::StoreMatrices(local, worldMatrices + index);
+				}
+				else if (parentInGroup)
+				{
+					// the parent's world matrix is not written yet, resolve the group in order.
+					for (size_t lane = 0; lane < width; lane++)
+					{
+						MultiplyMatrices(parentMatrices[lane], localMatrices + index + lane, worldMatrices + index + lane);
+					}
+				}
+				else
+				{
+					V parent[16];
+					V world[16];
+					Ops::LoadMatrices(parentMatrices, parent);
+					MultiplyParent<Ops>(parent, local, world);
+					Ops::StoreMatrices(world, worldMatrices + index);
+				}
+			}
+
+			return index;
+		}
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+		size_t ComputeWorldMatricesSSE(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t begin, size_t end);
+		size_t ComputeWorldMatricesAVX2(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t begin, size_t end);
+#endif
+
+#ifdef __wasm_simd128__
+		size_t ComputeWorldMatricesWasmSIMD(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t begin, size_t end);
+#endif
+	}
+}
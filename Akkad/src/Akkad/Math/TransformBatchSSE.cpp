@@ -0,0 +1,81 @@
+#include "TransformBatchKernel.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <emmintrin.h>
+
+namespace Akkad {
+	namespace TransformBatchKernel {
+
+		// SSE2 only, every x86_64 CPU has it.
+		struct SSEOps
+		{
+			using V = __m128;
+			using I = __m128i;
+			static constexpr size_t Width = 4;
+
+			static V Set1(float value) { return _mm_set1_ps(value); }
+			static V Load(const float* data) { return _mm_loadu_ps(data); }
+			static V Add(V a, V b) { return _mm_add_ps(a, b); }
+			static V Sub(V a, V b) { return _mm_sub_ps(a, b); }
+			static V Mul(V a, V b) { return _mm_mul_ps(a, b); }
+			static V MulAdd(V a, V b, V c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+			static V Xor(V a, V b) { return _mm_xor_ps(a, b); }
+
+			static I RoundToInt(V value) { return _mm_cvtps_epi32(value); }
+			static V ToFloat(I value) { return _mm_cvtepi32_ps(value); }
+			static I AddInt(I value, int addend) { return _mm_add_epi32(value, _mm_set1_epi32(addend)); }
+			static I AndInt(I value, int mask) { return _mm_and_si128(value, _mm_set1_epi32(mask)); }
+
+			static V SignFromBit1(I value)
+			{
+				return _mm_castsi128_ps(_mm_slli_epi32(AndInt(value, 2), 30));
+			}
+
+			static V SelectOnBit0(I value, V a, V b)
+			{
+				V mask = _mm_castsi128_ps(_mm_cmpeq_epi32(AndInt(value, 1), _mm_set1_epi32(1)));
+				return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+			}
+
+			static void LoadMatrices(const glm::mat4* const* matrices, V out[16])
+			{
+				for (int column = 0; column < 4; column++)
+				{
+					V lane0 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[0]) + column * 4);
+					V lane1 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[1]) + column * 4);
+					V lane2 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[2]) + column * 4);
+					V lane3 = _mm_loadu_ps(reinterpret_cast<const float*>(matrices[3]) + column * 4);
+					_MM_TRANSPOSE4_PS(lane0, lane1, lane2, lane3);
+
+					out[column * 4] = lane0;
+					out[column * 4 + 1] = lane1;
+					out[column * 4 + 2] = lane2;
+					out[column * 4 + 3] = lane3;
+				}
+			}
+
+			static void StoreMatrices(const V in[16], glm::mat4* out)
+			{
+				for (int column = 0; column < 4; column++)
+				{
+					V row0 = in[column * 4];
+					V row1 = in[column * 4 + 1];
+					V row2 = in[column * 4 + 2];
+					V row3 = in[column * 4 + 3];
+					_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 0) + column * 4, row0);
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 1) + column * 4, row1);
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 2) + column * 4, row2);
+					_mm_storeu_ps(reinterpret_cast<float*>(out + 3) + column * 4, row3);
+				}
+			}
+		};
+
+		size_t ComputeWorldMatricesSSE(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t begin, size_t end)
+		{
+			return ComputeWorldMatrices<SSEOps>(transforms, parents, localMatrices, worldMatrices, begin, end);
+		}
+	}
+}
+#endif
@@ -0,0 +1,93 @@
+#include "TransformBatchKernel.h"
+
+// only compiled in when the web build enables -msimd128, wasm has no runtime feature detection.
+#ifdef __wasm_simd128__
+#include <wasm_simd128.h>
+
+namespace Akkad {
+	namespace TransformBatchKernel {
+
+		struct WasmSIMDOps
+		{
+			using V = v128_t;
+			using I = v128_t;
+			static constexpr size_t Width = 4;
+
+			static V Set1(float value) { return wasm_f32x4_splat(value); }
+			static V Load(const float* data) { return wasm_v128_load(data); }
+			static V Add(V a, V b) { return wasm_f32x4_add(a, b); }
+			static V Sub(V a, V b) { return wasm_f32x4_sub(a, b); }
+			static V Mul(V a, V b) { return wasm_f32x4_mul(a, b); }
+			static V MulAdd(V a, V b, V c) { return wasm_f32x4_add(wasm_f32x4_mul(a, b), c); }
+			static V Xor(V a, V b) { return wasm_v128_xor(a, b); }
+
+			static I RoundToInt(V value) { return wasm_i32x4_trunc_sat_f32x4(wasm_f32x4_nearest(value)); }
+			static V ToFloat(I value) { return wasm_f32x4_convert_i32x4(value); }
+			static I AddInt(I value, int addend) { return wasm_i32x4_add(value, wasm_i32x4_splat(addend)); }
+			static I AndInt(I value, int mask) { return wasm_v128_and(value, wasm_i32x4_splat(mask)); }
+
+			static V SignFromBit1(I value)
+			{
+				return wasm_i32x4_shl(AndInt(value, 2), 30);
+			}
+
+			static V SelectOnBit0(I value, V a, V b)
+			{
+				return wasm_v128_bitselect(a, b, wasm_i32x4_eq(AndInt(value, 1), wasm_i32x4_splat(1)));
+			}
+
+			static void Transpose(V& row0, V& row1, V& row2, V& row3)
+			{
+				V low01 = wasm_i32x4_shuffle(row0, row1, 0, 4, 1, 5);
+				V low23 = wasm_i32x4_shuffle(row2, row3, 0, 4, 1, 5);
+				V high01 = wasm_i32x4_shuffle(row0, row1, 2, 6, 3, 7);
+				V high23 = wasm_i32x4_shuffle(row2, row3, 2, 6, 3, 7);
+
+				row0 = wasm_i64x2_shuffle(low01, low23, 0, 2);
+				row1 = wasm_i64x2_shuffle(low01, low23, 1, 3);
+				row2 = wasm_i64x2_shuffle(high01, high23, 0, 2);
+				row3 = wasm_i64x2_shuffle(high01, high23, 1, 3);
+			}
+
+			static void LoadMatrices(const glm::mat4* const* matrices, V out[16])
+			{
+				for (int column = 0; column < 4; column++)
+				{
+					V lane0 = wasm_v128_load(reinterpret_cast<const float*>(matrices[0]) + column * 4);
+					V lane1 = wasm_v128_load(reinterpret_cast<const float*>(matrices[1]) + column * 4);
+					V lane2 = wasm_v128_load(reinterpret_cast<const float*>(matrices[2]) + column * 4);
+					V lane3 = wasm_v128_load(reinterpret_cast<const float*>(matrices[3]) + column * 4);
+					Transpose(lane0, lane1, lane2, lane3);
+
+					out[column * 4] = lane0;
+					out[column * 4 + 1] = lane1;
+					out[column * 4 + 2] = lane2;
+					out[column * 4 + 3] = lane3;
+				}
+			}
+
+			static void StoreMatrices(const V in[16], glm::mat4* out)
+			{
+				for (int column = 0; column < 4; column++)
+				{
+					V row0 = in[column * 4];
+					V row1 = in[column * 4 + 1];
+					V row2 = in[column * 4 + 2];
+					V row3 = in[column * 4 + 3];
+					Transpose(row0, row1, row2, row3);
+
+					wasm_v128_store(reinterpret_cast<float*>(out + 0) + column * 4, row0);
+					wasm_v128_store(reinterpret_cast<float*>(out + 1) + column * 4, row1);
+					wasm_v128_store(reinterpret_cast<float*>(out + 2) + column * 4, row2);
+					wasm_v128_store(reinterpret_cast<float*>(out + 3) + column * 4, row3);
+				}
+			}
+		};
+
+		size_t ComputeWorldMatricesWasmSIMD(const TransformSoA& transforms, const uint32_t* parents, glm::mat4* localMatrices, glm::mat4* worldMatrices, size_t begin, size_t end)
+		{
+			return ComputeWorldMatrices<WasmSIMDOps>(transforms, parents, localMatrices, worldMatrices, begin, end);
+		}
+	}
+}
+#endif
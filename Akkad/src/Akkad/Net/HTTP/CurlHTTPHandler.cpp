@@ -1,5 +1,7 @@
 #include "CurlHTTPHandler.h"
 
+#include "Akkad/Profiling/Profiler.h"
+
 #include <curl/curl.h>
 namespace Akkad {
 	namespace NET {
@@ -90,6 +92,7 @@ namespace Akkad {
 		}
 		void CurlHTTPHandler::OnUpdate()
 		{
+			AK_PROFILE_SCOPE("CurlHTTPHandler::OnUpdate");
 			// perform requests each frame....
 			CURLMcode code;
 			if (m_RunningHandles != 0)
@@ -7,6 +7,21 @@
 #include <vector>
 namespace Akkad {
 
+	namespace Graphics {
+		struct PhysicsDebugProps
+		{
+			glm::vec3 color;
+		};
+
+		template<> struct UniformBlockTraits<PhysicsDebugProps>
+		{
+			static constexpr const char* NAME = "shader_props";
+			static constexpr UniformBlockMember MEMBERS[] = {
+				AK_UNIFORM_BLOCK_MEMBER(PhysicsDebugProps, color)
+			};
+		};
+	}
+
 	Box2dDraw::Box2dDraw()
 	{
 		if (Application::GetAssetManager() != nullptr)
@@ -20,10 +35,9 @@ namespace Akkad {
 
 				if (m_DebugShaderProps == nullptr)
 				{
-					Graphics::UniformBufferLayout layout;
-					layout.Push("color", Graphics::ShaderDataType::FLOAT3);
+					auto layout = UniformBufferLayout::CreateFromBlock<PhysicsDebugProps>();
 					m_DebugShaderProps = Application::GetRenderPlatform()->CreateUniformBuffer(layout);
-					m_DebugShaderProps->SetName("shader_props");
+					m_DebugShaderProps->SetName(UniformBlockTraits<PhysicsDebugProps>::NAME);
 				}
 
 				if (m_DebugShader == nullptr)
@@ -84,9 +98,7 @@ namespace Akkad {
 	{
 		using namespace Graphics;
 
-		auto platfrom = Application::GetRenderPlatform();
-
-		glm::vec3 pass_color = { color.r,color.g,color.b };
+		PhysicsDebugProps props = { { color.r,color.g,color.b } };
 
 		std::vector<float> verts;
 		for (int i = 0; i < vertexCount; i++)
@@ -96,15 +108,12 @@ namespace Akkad {
 			verts.push_back(worldvertex.y);
 		}
 
-		m_PolygonVB->SetData(verts.data(), verts.size() * 4);
-
-		m_DebugShaderProps->SetData("color", pass_color);
-
-		auto command = platfrom->GetRenderCommand();
+		auto& queue = Renderer2D::GetRenderQueue();
+		auto& packet = Renderer2D::Draw(m_PolygonVB, m_DebugShader, vertexCount);
+		packet.polygonMode = PolygonMode::LINE;
 
-		command->SetPolygonMode(PolygonMode::LINE);
-		Renderer2D::Draw(m_PolygonVB, m_DebugShader, vertexCount);
-		command->SetPolygonMode(PolygonMode::FILL);
+		queue.SetVertexData(packet, Renderer2D::GetStreamingBuffer(), verts.data(), (unsigned int)(verts.size() * sizeof(float)));
+		queue.SetUniformBlock(packet, m_DebugShaderProps.get(), props);
 
 	}
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "Akkad/core.h"
+#include "Akkad/Graphics/UniformBuffer.h"
 
 #include <box2d/b2_draw.h>
 namespace Akkad {
@@ -7,7 +8,6 @@ namespace Akkad {
 	namespace Graphics {
 		class VertexBuffer;
 		class Shader;
-		class UniformBuffer;
 	}
 
 	class Box2dDraw : public b2Draw
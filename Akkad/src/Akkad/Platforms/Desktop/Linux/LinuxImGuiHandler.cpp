@@ -0,0 +1,13 @@
+#include "Akkad/Graphics/ImGuiHandler.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		// there is no X11 platform backend for ImGui, the application never enables it on linux.
+		// these only keep the GL handler linkable.
+		void ImGuiWindowHandler::Init() {}
+		void ImGuiWindowHandler::ShutDown() {}
+		void ImGuiWindowHandler::UpdateRenderPlatforms() {}
+		void ImGuiWindowHandler::NewFrame() {}
+	}
+}
@@ -0,0 +1,62 @@
+#include "LinuxInput.h"
+#include "LinuxWindow.h"
+
+#include "Akkad/Application/Application.h"
+
+namespace Akkad {
+
+	// the window keeps the states up to date from the X events it pumps every frame.
+	bool LinuxInput::GetKeyDown(unsigned int key)
+	{
+		LinuxWindow* window = (LinuxWindow*)Application::GetInstance().GetWindow();
+		return window->m_KeyStatesFrame[key] == 0;
+	}
+
+	bool LinuxInput::GetKeyUp(unsigned int key)
+	{
+		LinuxWindow* window = (LinuxWindow*)Application::GetInstance().GetWindow();
+		return window->m_KeyStatesFrame[key] == 1;
+	}
+
+	bool LinuxInput::GetMouseDown(MouseButtons button)
+	{
+		LinuxWindow* window = (LinuxWindow*)Application::GetInstance().GetWindow();
+		return window->m_MouseStatesFrame[static_cast<int>(button)] == 0;
+	}
+
+	bool LinuxInput::GetMouseUp(MouseButtons button)
+	{
+		LinuxWindow* window = (LinuxWindow*)Application::GetInstance().GetWindow();
+		return window->m_MouseStatesFrame[static_cast<int>(button)] == 1;
+	}
+
+	int LinuxInput::GetCharacterDown()
+	{
+		LinuxWindow* window = (LinuxWindow*)Application::GetInstance().GetWindow();
+		return window->m_LastPressedCharacter;
+	}
+
+	bool LinuxInput::IsKeyDown(unsigned int key)
+	{
+		LinuxWindow* window = (LinuxWindow*)Application::GetInstance().GetWindow();
+		return window->m_KeyStates[key] && window->m_HasFocus;
+	}
+
+	bool LinuxInput::IsMouseDown(MouseButtons button)
+	{
+		LinuxWindow* window = (LinuxWindow*)Application::GetInstance().GetWindow();
+		return window->m_MouseStates[static_cast<int>(button)] && window->isCursorTracked;
+	}
+
+	int LinuxInput::GetMouseX()
+	{
+		LinuxWindow* window = (LinuxWindow*)Application::GetInstance().GetWindow();
+		return window->m_MouseX;
+	}
+
+	int LinuxInput::GetMouseY()
+	{
+		LinuxWindow* window = (LinuxWindow*)Application::GetInstance().GetWindow();
+		return window->m_MouseY;
+	}
+}
@@ -0,0 +1,140 @@
+#include "LinuxKeyCodes.h"
+
+#include <linux/input-event-codes.h>
+
+int keyCodes[512];
+int scanCodes[512];
+
+void MakeLinuxKeyCodes()
+{
+    int scancode;
+        keyCodes[KEY_0] = AK_KEY_0;
+        keyCodes[KEY_1] = AK_KEY_1;
+        keyCodes[KEY_2] = AK_KEY_2;
+        keyCodes[KEY_3] = AK_KEY_3;
+        keyCodes[KEY_4] = AK_KEY_4;
+        keyCodes[KEY_5] = AK_KEY_5;
+        keyCodes[KEY_6] = AK_KEY_6;
+        keyCodes[KEY_7] = AK_KEY_7;
+        keyCodes[KEY_8] = AK_KEY_8;
+        keyCodes[KEY_9] = AK_KEY_9;
+        keyCodes[KEY_A] = AK_KEY_A;
+        keyCodes[KEY_B] = AK_KEY_B;
+        keyCodes[KEY_C] = AK_KEY_C;
+        keyCodes[KEY_D] = AK_KEY_D;
+        keyCodes[KEY_E] = AK_KEY_E;
+        keyCodes[KEY_F] = AK_KEY_F;
+        keyCodes[KEY_G] = AK_KEY_G;
+        keyCodes[KEY_H] = AK_KEY_H;
+        keyCodes[KEY_I] = AK_KEY_I;
+        keyCodes[KEY_J] = AK_KEY_J;
+        keyCodes[KEY_K] = AK_KEY_K;
+        keyCodes[KEY_L] = AK_KEY_L;
+        keyCodes[KEY_M] = AK_KEY_M;
+        keyCodes[KEY_N] = AK_KEY_N;
+        keyCodes[KEY_O] = AK_KEY_O;
+        keyCodes[KEY_P] = AK_KEY_P;
+        keyCodes[KEY_Q] = AK_KEY_Q;
+        keyCodes[KEY_R] = AK_KEY_R;
+        keyCodes[KEY_S] = AK_KEY_S;
+        keyCodes[KEY_T] = AK_KEY_T;
+        keyCodes[KEY_U] = AK_KEY_U;
+        keyCodes[KEY_V] = AK_KEY_V;
+        keyCodes[KEY_W] = AK_KEY_W;
+        keyCodes[KEY_X] = AK_KEY_X;
+        keyCodes[KEY_Y] = AK_KEY_Y;
+        keyCodes[KEY_Z] = AK_KEY_Z;
+
+        keyCodes[KEY_APOSTROPHE] = AK_KEY_APOSTROPHE;
+        keyCodes[KEY_BACKSLASH] = AK_KEY_BACKSLASH;
+        keyCodes[KEY_COMMA] = AK_KEY_COMMA;
+        keyCodes[KEY_EQUAL] = AK_KEY_EQUAL;
+        keyCodes[KEY_GRAVE] = AK_KEY_GRAVE_ACCENT;
+        keyCodes[KEY_LEFTBRACE] = AK_KEY_LEFT_BRACKET;
+        keyCodes[KEY_MINUS] = AK_KEY_MINUS;
+        keyCodes[KEY_DOT] = AK_KEY_PERIOD;
+        keyCodes[KEY_RIGHTBRACE] = AK_KEY_RIGHT_BRACKET;
+        keyCodes[KEY_SEMICOLON] = AK_KEY_SEMICOLON;
+        keyCodes[KEY_SLASH] = AK_KEY_SLASH;
+        keyCodes[KEY_102ND] = AK_KEY_WORLD_2;
+
+        keyCodes[KEY_BACKSPACE] = AK_KEY_BACKSPACE;
+        keyCodes[KEY_DELETE] = AK_KEY_DELETE;
+        keyCodes[KEY_END] = AK_KEY_END;
+        keyCodes[KEY_ENTER] = AK_KEY_ENTER;
+        keyCodes[KEY_ESC] = AK_KEY_ESCAPE;
+        keyCodes[KEY_HOME] = AK_KEY_HOME;
+        keyCodes[KEY_INSERT] = AK_KEY_INSERT;
+        keyCodes[KEY_COMPOSE] = AK_KEY_MENU;
+        keyCodes[KEY_PAGEDOWN] = AK_KEY_PAGE_DOWN;
+        keyCodes[KEY_PAGEUP] = AK_KEY_PAGE_UP;
+        keyCodes[KEY_PAUSE] = AK_KEY_PAUSE;
+        keyCodes[KEY_SPACE] = AK_KEY_SPACE;
+        keyCodes[KEY_TAB] = AK_KEY_TAB;
+        keyCodes[KEY_CAPSLOCK] = AK_KEY_CAPS_LOCK;
+        keyCodes[KEY_NUMLOCK] = AK_KEY_NUM_LOCK;
+        keyCodes[KEY_SCROLLLOCK] = AK_KEY_SCROLL_LOCK;
+        keyCodes[KEY_SYSRQ] = AK_KEY_PRINT_SCREEN;
+
+        keyCodes[KEY_F1] = AK_KEY_F1;
+        keyCodes[KEY_F2] = AK_KEY_F2;
+        keyCodes[KEY_F3] = AK_KEY_F3;
+        keyCodes[KEY_F4] = AK_KEY_F4;
+        keyCodes[KEY_F5] = AK_KEY_F5;
+        keyCodes[KEY_F6] = AK_KEY_F6;
+        keyCodes[KEY_F7] = AK_KEY_F7;
+        keyCodes[KEY_F8] = AK_KEY_F8;
+        keyCodes[KEY_F9] = AK_KEY_F9;
+        keyCodes[KEY_F10] = AK_KEY_F10;
+        keyCodes[KEY_F11] = AK_KEY_F11;
+        keyCodes[KEY_F12] = AK_KEY_F12;
+        keyCodes[KEY_F13] = AK_KEY_F13;
+        keyCodes[KEY_F14] = AK_KEY_F14;
+        keyCodes[KEY_F15] = AK_KEY_F15;
+        keyCodes[KEY_F16] = AK_KEY_F16;
+        keyCodes[KEY_F17] = AK_KEY_F17;
+        keyCodes[KEY_F18] = AK_KEY_F18;
+        keyCodes[KEY_F19] = AK_KEY_F19;
+        keyCodes[KEY_F20] = AK_KEY_F20;
+        keyCodes[KEY_F21] = AK_KEY_F21;
+        keyCodes[KEY_F22] = AK_KEY_F22;
+        keyCodes[KEY_F23] = AK_KEY_F23;
+        keyCodes[KEY_F24] = AK_KEY_F24;
+
+        keyCodes[KEY_LEFTALT] = AK_KEY_LEFT_ALT;
+        keyCodes[KEY_LEFTCTRL] = AK_KEY_LEFT_CONTROL;
+        keyCodes[KEY_LEFTSHIFT] = AK_KEY_LEFT_SHIFT;
+        keyCodes[KEY_LEFTMETA] = AK_KEY_LEFT_SUPER;
+        keyCodes[KEY_RIGHTALT] = AK_KEY_RIGHT_ALT;
+        keyCodes[KEY_RIGHTCTRL] = AK_KEY_RIGHT_CONTROL;
+        keyCodes[KEY_RIGHTSHIFT] = AK_KEY_RIGHT_SHIFT;
+        keyCodes[KEY_RIGHTMETA] = AK_KEY_RIGHT_SUPER;
+        keyCodes[KEY_DOWN] = AK_KEY_DOWN;
+        keyCodes[KEY_LEFT] = AK_KEY_LEFT;
+        keyCodes[KEY_RIGHT] = AK_KEY_RIGHT;
+        keyCodes[KEY_UP] = AK_KEY_UP;
+
+        keyCodes[KEY_KP0] = AK_KEY_KP_0;
+        keyCodes[KEY_KP1] = AK_KEY_KP_1;
+        keyCodes[KEY_KP2] = AK_KEY_KP_2;
+        keyCodes[KEY_KP3] = AK_KEY_KP_3;
+        keyCodes[KEY_KP4] = AK_KEY_KP_4;
+        keyCodes[KEY_KP5] = AK_KEY_KP_5;
+        keyCodes[KEY_KP6] = AK_KEY_KP_6;
+        keyCodes[KEY_KP7] = AK_KEY_KP_7;
+        keyCodes[KEY_KP8] = AK_KEY_KP_8;
+        keyCodes[KEY_KP9] = AK_KEY_KP_9;
+        keyCodes[KEY_KPPLUS] = AK_KEY_KP_ADD;
+        keyCodes[KEY_KPDOT] = AK_KEY_KP_DECIMAL;
+        keyCodes[KEY_KPSLASH] = AK_KEY_KP_DIVIDE;
+        keyCodes[KEY_KPENTER] = AK_KEY_KP_ENTER;
+        keyCodes[KEY_KPEQUAL] = AK_KEY_KP_EQUAL;
+        keyCodes[KEY_KPASTERISK] = AK_KEY_KP_MULTIPLY;
+        keyCodes[KEY_KPMINUS] = AK_KEY_KP_SUBTRACT;
+
+        for (scancode = 0; scancode < 512; scancode++)
+        {
+            if (keyCodes[scancode] > 0)
+                scanCodes[keyCodes[scancode]] = scancode;
+        }
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include "Akkad/Input/KeyCodes.h"
+
+// indexed by evdev key codes, X11 key codes are the evdev ones offset by 8.
+extern int keyCodes[512];
+extern int scanCodes[512];
+
+void MakeLinuxKeyCodes();
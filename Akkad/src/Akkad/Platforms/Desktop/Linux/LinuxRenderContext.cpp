@@ -0,0 +1,168 @@
+#include "LinuxRenderContext.h"
+#include "LinuxWindow.h"
+#include "Akkad/Application/Application.h"
+#include "Akkad/Logging.h"
+
+#include <glad/glad.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <cstring>
+
+namespace Akkad {
+	namespace Graphics {
+
+		SharedPtr<RenderContext> RenderContext::Create() {
+			return CreateSharedPtr<LinuxRenderContext>();
+		}
+
+		static EGLDisplay GetOffscreenDisplay()
+		{
+			// mesa's surfaceless platform needs neither an X server nor a DRM device, drivers without it
+			// get the default display.
+			const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+			if (extensions != nullptr && strstr(extensions, "EGL_MESA_platform_surfaceless") != nullptr)
+			{
+				auto eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+				if (eglGetPlatformDisplayEXT != nullptr)
+				{
+					EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+					if (display != EGL_NO_DISPLAY)
+					{
+						return display;
+					}
+				}
+			}
+
+			return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		}
+
+		static EGLContext CreateContext(EGLDisplay display, EGLConfig config)
+		{
+			// the shaders are cross compiled to GLSL 400, a compatibility context like the one made by wgl
+			// is asked for first.
+			EGLint compatibilityAttributes[] = {
+				EGL_CONTEXT_MAJOR_VERSION, 4,
+				EGL_CONTEXT_MINOR_VERSION, 0,
+				EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+				EGL_NONE
+			};
+
+			EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, compatibilityAttributes);
+			if (context != EGL_NO_CONTEXT)
+			{
+				return context;
+			}
+
+			EGLint coreAttributes[] = {
+				EGL_CONTEXT_MAJOR_VERSION, 4,
+				EGL_CONTEXT_MINOR_VERSION, 0,
+				EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+				EGL_NONE
+			};
+
+			return eglCreateContext(display, config, EGL_NO_CONTEXT, coreAttributes);
+		}
+
+		void LinuxRenderContext::Init(RenderAPI api)
+		{
+			switch (api)
+			{
+
+			case RenderAPI::OPENGL:
+			{
+				LinuxWindow* window = (LinuxWindow*)Application::GetInstance().GetWindow();
+				bool offscreen = window->IsOffscreen();
+
+				m_Display = offscreen ? GetOffscreenDisplay() : eglGetDisplay((EGLNativeDisplayType)window->GetNativeDisplay());
+				if (m_Display == EGL_NO_DISPLAY || !eglInitialize(m_Display, nullptr, nullptr))
+				{
+					AK_ERROR("could not initialize the EGL display.");
+					return;
+				}
+
+				eglBindAPI(EGL_OPENGL_API);
+
+				EGLint configAttributes[] = {
+					EGL_SURFACE_TYPE, offscreen ? EGL_PBUFFER_BIT : EGL_WINDOW_BIT,
+					EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+					EGL_RED_SIZE, 8,
+					EGL_GREEN_SIZE, 8,
+					EGL_BLUE_SIZE, 8,
+					EGL_DEPTH_SIZE, 24,
+					EGL_NONE
+				};
+
+				EGLConfig config;
+				EGLint configCount = 0;
+				if (!eglChooseConfig(m_Display, configAttributes, &config, 1, &configCount) || configCount == 0)
+				{
+					AK_ERROR("no EGL config supports desktop OpenGL.");
+					return;
+				}
+
+				if (offscreen)
+				{
+					// the runtime draws into the default framebuffer, so it is backed by a pbuffer
+					// instead of going surfaceless.
+					EGLint pbufferAttributes[] = {
+						EGL_WIDTH, (EGLint)window->GetWidth(),
+						EGL_HEIGHT, (EGLint)window->GetHeight(),
+						EGL_NONE
+					};
+					m_Surface = eglCreatePbufferSurface(m_Display, config, pbufferAttributes);
+				}
+				else
+				{
+					m_Surface = eglCreateWindowSurface(m_Display, config, (EGLNativeWindowType)window->GetNativeWindow(), nullptr);
+				}
+
+				m_GLContext = CreateContext(m_Display, config);
+				if (m_Surface == EGL_NO_SURFACE || m_GLContext == EGL_NO_CONTEXT)
+				{
+					AK_ERROR("could not create the EGL surface or context, error {:#x}.", eglGetError());
+					return;
+				}
+
+				m_API = api;
+				eglMakeCurrent(m_Display, m_Surface, m_Surface, m_GLContext);
+
+				gladLoadGLLoader((GLADloadproc)eglGetProcAddress);
+				glViewport(0, 0, window->GetWidth(), window->GetHeight());
+			}
+
+			}
+		}
+
+		void LinuxRenderContext::SwapWindowBuffers()
+		{
+			switch (m_API)
+			{
+				case RenderAPI::OPENGL:
+				{
+					eglSwapBuffers(m_Display, m_Surface);
+					break;
+				}
+			}
+		}
+
+		void LinuxRenderContext::MakeCurrent()
+		{
+			eglMakeCurrent(m_Display, m_Surface, m_Surface, m_GLContext);
+		}
+
+		void LinuxRenderContext::ReleaseCurrent()
+		{
+			eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+		}
+
+		void LinuxRenderContext::SetVsync(bool status)
+		{
+			m_VsyncEnabled = status;
+
+			if (m_API == Graphics::RenderAPI::OPENGL)
+			{
+				eglSwapInterval(m_Display, status);
+			}
+		}
+	}
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Akkad/Graphics/RenderContext.h"
+
+namespace Akkad {
+	namespace Graphics {
+
+		// desktop GL through EGL, on the X11 window or on a pbuffer when the window is offscreen.
+		class LinuxRenderContext : public RenderContext {
+		public:
+			virtual void Init(RenderAPI api) override;
+			virtual void SwapWindowBuffers() override;
+			virtual void SetVsync(bool status) override;
+
+			virtual bool SupportsThreadedRendering() override { return true; }
+			virtual void MakeCurrent() override;
+			virtual void ReleaseCurrent() override;
+
+		private:
+			// EGLDisplay, EGLSurface and EGLContext, egl.h pulls in Xlib so it stays out of the header.
+			void* m_Display = nullptr;
+			void* m_Surface = nullptr;
+			void* m_GLContext = nullptr;
+			RenderAPI m_API = RenderAPI::NONE;
+			bool m_VsyncEnabled = false;
+		};
+	}
+}
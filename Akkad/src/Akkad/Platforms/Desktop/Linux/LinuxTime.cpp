@@ -0,0 +1,36 @@
+#include "LinuxTime.h"
+
+#include <time.h>
+
+namespace Akkad {
+
+	// the monotonic clock is not affected by changes of the system time.
+	static double GetMonotonicSeconds()
+	{
+		timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+
+		return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+	}
+
+	LinuxTimeManager::LinuxTimeManager()
+	{
+		m_TimerOffset = GetMonotonicSeconds();
+	}
+
+	double LinuxTimeManager::GetTime() {
+		return GetMonotonicSeconds() - m_TimerOffset;
+	}
+
+	double LinuxTimeManager::GetDeltaTime() {
+		return m_deltaTime;
+	}
+
+	void LinuxTimeManager::CalculateDeltaTime() {
+		m_lastFrame = m_newFrame;
+
+		m_newFrame = GetTime();
+
+		m_deltaTime = m_newFrame - m_lastFrame;
+	}
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "Akkad/Application/TimeManager.h"
+
+namespace Akkad {
+	class LinuxTimeManager : public TimeManager
+	{
+	public:
+		LinuxTimeManager();
+		~LinuxTimeManager() {};
+
+		virtual double GetTime() override;
+		virtual double GetDeltaTime() override;
+
+	private:
+		virtual void CalculateDeltaTime() override;
+
+		double m_TimerOffset = 0;
+
+		double m_newFrame = 0;
+		double m_lastFrame = 0;
+
+		double m_deltaTime = 0;
+	};
+}
@@ -0,0 +1,260 @@
+#include "LinuxWindow.h"
+#include "LinuxKeyCodes.h"
+
+#include "Akkad/Input/KeyEvent.h"
+#include "Akkad/Logging.h"
+
+#include <algorithm>
+#include <iterator>
+#include <X11/Xlib.h>
+#include <X11/Xutil.h>
+#include <X11/XKBlib.h>
+
+namespace Akkad {
+
+	int LinuxWindow::Init(WindowSettings settings)
+	{
+		m_Width = settings.width;
+		m_Height = settings.height;
+
+		// create the key codes table
+		MakeLinuxKeyCodes();
+
+		if (m_Offscreen)
+		{
+			return 0;
+		}
+
+		Display* display = XOpenDisplay(nullptr);
+		if (display == nullptr)
+		{
+			AK_WARNING("could not connect to the X server, rendering offscreen.");
+			m_Offscreen = true;
+			return 0;
+		}
+
+		int screen = DefaultScreen(display);
+		XSetWindowAttributes attributes = {};
+		attributes.event_mask = KeyPressMask | KeyReleaseMask | ButtonPressMask | ButtonReleaseMask | PointerMotionMask |
+			EnterWindowMask | LeaveWindowMask | FocusChangeMask | StructureNotifyMask;
+
+		::Window window = XCreateWindow(display, RootWindow(display, screen), 0, 0, settings.width, settings.height, 0,
+			CopyFromParent, InputOutput, CopyFromParent, CWEventMask, &attributes);
+
+		XStoreName(display, window, settings.title);
+
+		// the window manager sends this instead of destroying the window when it is closed.
+		Atom deleteMessage = XInternAtom(display, "WM_DELETE_WINDOW", False);
+		XSetWMProtocols(display, window, &deleteMessage, 1);
+
+		// held keys only repeat the press, like the repeat flag on windows.
+		XkbSetDetectableAutoRepeat(display, True, nullptr);
+
+		XMapWindow(display, window);
+		XFlush(display);
+
+		m_Display = display;
+		m_WindowHandle = window;
+		m_DeleteMessage = deleteMessage;
+
+		return 0;
+	}
+
+	void LinuxWindow::OnUpdate()
+	{
+		ResetKeyStates();
+
+		if (m_Display == nullptr)
+		{
+			return;
+		}
+
+		Display* display = (Display*)m_Display;
+		while (XPending(display))
+		{
+			XEvent event;
+			XNextEvent(display, &event);
+			ProcessEvent(&event);
+		}
+	}
+
+	void LinuxWindow::ProcessEvent(void* xevent)
+	{
+		XEvent& event = *(XEvent*)xevent;
+
+		switch (event.type)
+		{
+		case ClientMessage:
+		{
+			if ((unsigned long)event.xclient.data.l[0] == m_DeleteMessage)
+			{
+				WindowCloseEvent e;
+				m_EventCallback(e);
+			}
+			break;
+		}
+
+		case ConfigureNotify:
+		{
+			unsigned int width = event.xconfigure.width;
+			unsigned int height = event.xconfigure.height;
+			if (width != m_Width || height != m_Height)
+			{
+				m_Width = width;
+				m_Height = height;
+				WindowResizeEvent e(width, height);
+				m_EventCallback(e);
+			}
+			break;
+		}
+
+		case FocusIn:
+		case FocusOut:
+		{
+			m_HasFocus = event.type == FocusIn;
+
+			// the releases of keys held while losing the focus never arrive.
+			if (!m_HasFocus)
+			{
+				std::fill(std::begin(m_KeyStates), std::end(m_KeyStates), false);
+				std::fill(std::begin(m_MouseStates), std::end(m_MouseStates), false);
+			}
+			break;
+		}
+
+		case KeyPress:
+		case KeyRelease:
+		{
+			unsigned int code = event.xkey.keycode - 8;
+			if (!m_HasFocus || code >= 512)
+			{
+				break;
+			}
+
+			int key = keyCodes[code];
+			if (event.type == KeyPress)
+			{
+				KeyPressEvent e(key);
+				m_EventCallback(e);
+
+				if (!m_KeyStates[key])
+				{
+					m_KeyStatesFrame[key] = 0;
+				}
+				m_KeyStates[key] = true;
+
+				char character;
+				if (XLookupString(&event.xkey, &character, 1, nullptr, nullptr) == 1)
+				{
+					m_LastPressedCharacter = (unsigned char)character;
+				}
+			}
+			else
+			{
+				m_KeyStatesFrame[key] = 1;
+				m_KeyStates[key] = false;
+			}
+			break;
+		}
+
+		case ButtonPress:
+		case ButtonRelease:
+		{
+			int button = -1;
+			if (event.xbutton.button == Button1)
+				button = static_cast<int>(MouseButtons::LEFT);
+			else if (event.xbutton.button == Button3)
+				button = static_cast<int>(MouseButtons::RIGHT);
+			else if (event.xbutton.button == Button2)
+				button = static_cast<int>(MouseButtons::MIDDLE);
+
+			if (button >= 0 && m_HasFocus)
+			{
+				m_MouseStatesFrame[button] = event.type == ButtonPress ? 0 : 1;
+				m_MouseStates[button] = event.type == ButtonPress;
+			}
+			break;
+		}
+
+		case MotionNotify:
+		{
+			// screen coordinates like the other desktop platforms, the window rect is in the same space.
+			m_MouseX = event.xmotion.x_root;
+			m_MouseY = event.xmotion.y_root;
+			break;
+		}
+
+		case EnterNotify:
+		{
+			isCursorTracked = true;
+			break;
+		}
+
+		case LeaveNotify:
+		{
+			isCursorTracked = false;
+			break;
+		}
+		}
+	}
+
+	glm::vec2 LinuxWindow::GetWindowRectMin()
+	{
+		if (m_Display == nullptr)
+		{
+			return { 0, 0 };
+		}
+
+		Display* display = (Display*)m_Display;
+		int x, y;
+		::Window child;
+		XTranslateCoordinates(display, m_WindowHandle, DefaultRootWindow(display), 0, 0, &x, &y, &child);
+
+		glm::vec2 min = { x, y };
+		return min;
+	}
+
+	glm::vec2 LinuxWindow::GetWindowRectMax()
+	{
+		glm::vec2 max = GetWindowRectMin() + glm::vec2(m_Width, m_Height);
+		return max;
+	}
+
+	void LinuxWindow::ToggleFullScreen()
+	{
+		if (m_Display == nullptr)
+		{
+			return;
+		}
+
+		// asks the window manager through the EWMH state, the resize comes back as a ConfigureNotify.
+		Display* display = (Display*)m_Display;
+		XEvent event = {};
+		event.type = ClientMessage;
+		event.xclient.window = m_WindowHandle;
+		event.xclient.message_type = XInternAtom(display, "_NET_WM_STATE", False);
+		event.xclient.format = 32;
+		event.xclient.data.l[0] = m_FullScreen ? 0 : 1; // _NET_WM_STATE_REMOVE / _NET_WM_STATE_ADD
+		event.xclient.data.l[1] = XInternAtom(display, "_NET_WM_STATE_FULLSCREEN", False);
+		event.xclient.data.l[3] = 1;
+
+		XSendEvent(display, DefaultRootWindow(display), False, SubstructureRedirectMask | SubstructureNotifyMask, &event);
+		XFlush(display);
+
+		m_FullScreen = !m_FullScreen;
+	}
+
+	void LinuxWindow::ResetKeyStates()
+	{
+		for (size_t i = 0; i < 3; i++)
+		{
+			m_MouseStatesFrame[i] = -1;
+		}
+
+		for (size_t i = 0; i < 512; i++)
+		{
+			m_KeyStatesFrame[i] = -1;
+		}
+		m_LastPressedCharacter = -1;
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "Akkad/Application/IWindow.h"
+
+namespace Akkad {
+
+	// an Xlib window, when offscreen or when no X server can be reached there is no window at all
+	// and the render context draws into an EGL pbuffer of the same size.
+	class LinuxWindow : public Window
+	{
+	public:
+		LinuxWindow(bool offscreen) : m_Offscreen(offscreen) {}
+
+		virtual int Init(WindowSettings settings) override;
+		virtual void OnUpdate() override;
+		virtual void SetEventCallback(std::function<void(Event&)> func) override { m_EventCallback = func; };
+		virtual unsigned int GetWidth() override { return m_Width; };
+		virtual unsigned int GetHeight() override { return m_Height; };
+		virtual glm::vec2 GetWindowRectMin() override;
+		virtual glm::vec2 GetWindowRectMax() override;
+		virtual void* GetNativeWindow() override { return (void*)m_WindowHandle; };
+		virtual void ToggleFullScreen() override;
+		virtual bool IsFullScreen() override { return m_FullScreen; };
+		void ResetKeyStates();
+
+		void* GetNativeDisplay() { return m_Display; }
+		bool IsOffscreen() { return m_Offscreen; }
+
+		std::function<void(Event&)> m_EventCallback;
+
+		bool isCursorTracked = false;
+
+		int m_MouseStatesFrame[3] = {};
+		int m_KeyStatesFrame[512] = {};
+		bool m_MouseStates[3] = {};
+		bool m_KeyStates[512] = {};
+		int m_MouseX = 0;
+		int m_MouseY = 0;
+
+		int m_LastPressedCharacter = -1;
+		bool m_HasFocus = true;
+
+	private:
+		void ProcessEvent(void* event);
+
+		bool m_Offscreen = false;
+		bool m_FullScreen = false;
+		// Display* and Window, kept opaque so Xlib's macros stay out of the engine headers.
+		void* m_Display = nullptr;
+		unsigned long m_WindowHandle = 0;
+		unsigned long m_DeleteMessage = 0;
+		unsigned int m_Width = 0;
+		unsigned int m_Height = 0;
+	};
+}
@@ -45,6 +45,16 @@ namespace Akkad {
 				}
 			}
 		}
+		void Win32RenderContext::MakeCurrent()
+		{
+			wglMakeCurrent(m_DeviceContext, m_GLContext);
+		}
+
+		void Win32RenderContext::ReleaseCurrent()
+		{
+			wglMakeCurrent(nullptr, nullptr);
+		}
+
 		void Win32RenderContext::SetVsync(bool status)
 		{
 			m_VsyncEnabled = status;
@@ -13,6 +13,10 @@ namespace Akkad {
 			virtual void SwapWindowBuffers() override;
 			virtual void SetVsync(bool status) override;
 
+			virtual bool SupportsThreadedRendering() override { return true; }
+			virtual void MakeCurrent() override;
+			virtual void ReleaseCurrent() override;
+
 		private:
 			friend class ImGuiWindowHandler;
 			HGLRC m_GLContext = nullptr;
@@ -0,0 +1,23 @@
+#pragma once
+#include "Akkad/Input/Input.h"
+namespace Akkad {
+
+	// nothing is ever pressed.
+	class HeadlessInput : public Input
+	{
+	public:
+		virtual bool GetKeyDown(unsigned int key) override { return false; }
+		virtual bool GetKeyUp(unsigned int key) override { return false; }
+
+		virtual bool GetMouseDown(MouseButtons button) override { return false; }
+		virtual bool GetMouseUp(MouseButtons button) override { return false; }
+
+		virtual bool IsKeyDown(unsigned int key) override { return false; }
+		virtual bool IsMouseDown(MouseButtons button) override { return false; }
+
+		virtual int GetCharacterDown() override { return -1; }
+
+		virtual int GetMouseX() override { return 0; }
+		virtual int GetMouseY() override { return 0; }
+	};
+}
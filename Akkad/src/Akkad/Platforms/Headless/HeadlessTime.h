@@ -0,0 +1,18 @@
+#pragma once
+#include "Akkad/Application/TimeManager.h"
+namespace Akkad {
+
+	// every frame advances the clock by the same step, a simulation gives the same result however fast it runs.
+	class HeadlessTime : public TimeManager
+	{
+	public:
+		HeadlessTime(double deltaTime) : m_DeltaTime(deltaTime) {}
+		virtual double GetTime() override { return m_Time; }
+		virtual double GetDeltaTime() override { return m_DeltaTime; }
+	protected:
+		virtual void CalculateDeltaTime() override { m_Time += m_DeltaTime; }
+
+		double m_Time = 0;
+		double m_DeltaTime;
+	};
+}
@@ -0,0 +1,11 @@
+#include "HeadlessWindow.h"
+
+namespace Akkad {
+
+	int HeadlessWindow::Init(WindowSettings settings)
+	{
+		m_Width = settings.width;
+		m_Height = settings.height;
+		return 0;
+	}
+}
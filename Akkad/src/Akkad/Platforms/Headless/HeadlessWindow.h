@@ -0,0 +1,26 @@
+#pragma once
+#include "Akkad/Application/IWindow.h"
+
+namespace Akkad {
+
+	// a window that is never shown, it only keeps the size the application was started with.
+	class HeadlessWindow : public Window
+	{
+	public:
+		virtual int Init(WindowSettings settings) override;
+		virtual void OnUpdate() override {}
+		virtual void SetEventCallback(std::function<void(Event&)> func) override { m_EventCallbackFN = func; }
+		virtual unsigned int GetWidth() override { return m_Width; }
+		virtual unsigned int GetHeight() override { return m_Height; }
+		virtual glm::vec2 GetWindowRectMin() override { return { 0, 0 }; }
+		virtual glm::vec2 GetWindowRectMax() override { return { m_Width, m_Height }; }
+		virtual void* GetNativeWindow() override { return nullptr; }
+		virtual void ToggleFullScreen() override {}
+		virtual bool IsFullScreen() override { return false; }
+
+	private:
+		std::function<void(Event&)> m_EventCallbackFN;
+		unsigned int m_Width = 0;
+		unsigned int m_Height = 0;
+	};
+}
@@ -0,0 +1,301 @@
+#include "Profiler.h"
+
+#include "Akkad/Logging.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace Akkad {
+
+	Profiler Profiler::s_Instance;
+
+	thread_local Profiler::ThreadBuffer* Profiler::t_ThreadBuffer = nullptr;
+
+	Profiler::Profiler()
+	{
+		// a few milliseconds against the steady clock are enough, the error is the same for every event.
+		auto calibrationStart = std::chrono::steady_clock::now();
+		m_EpochTicks = GetTicks();
+
+		std::chrono::steady_clock::time_point calibrationEnd;
+		uint64_t calibrationEndTicks;
+		do
+		{
+			calibrationEnd = std::chrono::steady_clock::now();
+			calibrationEndTicks = GetTicks();
+		} while (calibrationEnd - calibrationStart < std::chrono::milliseconds(5));
+
+		auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(calibrationEnd - calibrationStart).count();
+		if (calibrationEndTicks > m_EpochTicks)
+		{
+			m_NanosecondsPerTick = (double)elapsed / (double)(calibrationEndTicks - m_EpochTicks);
+		}
+
+		m_FrameStart = m_EpochTicks;
+	}
+
+	uint64_t Profiler::ToNanoseconds(uint64_t ticks)
+	{
+		auto& profiler = GetInstance();
+
+		// the counters of two cores can be a few ticks apart, nothing is recorded before the profiler starts.
+		if (ticks <= profiler.m_EpochTicks)
+		{
+			return 0;
+		}
+
+		return (uint64_t)((double)(ticks - profiler.m_EpochTicks) * profiler.m_NanosecondsPerTick);
+	}
+
+	Profiler::ThreadBuffer* Profiler::GetThreadBuffer()
+	{
+		if (t_ThreadBuffer == nullptr)
+		{
+			t_ThreadBuffer = GetInstance().RegisterThread();
+		}
+
+		return t_ThreadBuffer;
+	}
+
+	Profiler::ThreadBuffer* Profiler::RegisterThread()
+	{
+		std::lock_guard<std::mutex> lock(m_ThreadsMutex);
+
+		ThreadBuffer* buffer = new ThreadBuffer();
+		buffer->id = (uint32_t)m_Threads.size();
+		buffer->name = "Thread " + std::to_string(buffer->id);
+		m_Threads.push_back(buffer);
+
+		return buffer;
+	}
+
+	Profiler::ThreadBuffer* Profiler::BeginZone()
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+		buffer->depth++;
+
+		return buffer;
+	}
+
+	void Profiler::SetThreadNameImpl(const char* name)
+	{
+		ThreadBuffer* buffer = GetThreadBuffer();
+
+		std::lock_guard<std::mutex> lock(m_ThreadsMutex);
+		buffer->name = name;
+	}
+
+	const char* Profiler::InternNameImpl(const std::string& name)
+	{
+		std::lock_guard<std::mutex> lock(m_NamesMutex);
+		return m_Names.insert(name).first->c_str();
+	}
+
+	void Profiler::MarkFrameImpl()
+	{
+		uint64_t now = GetTicks();
+		uint64_t finishedFrame;
+
+		{
+			std::lock_guard<std::mutex> lock(m_FramesMutex);
+			m_Frames[m_FrameIndex % FRAME_HISTORY_SIZE] = { m_FrameIndex, m_FrameStart, now };
+			m_FrameThreadID = GetThreadBuffer()->id;
+
+			finishedFrame = m_FrameIndex;
+			m_FrameIndex++;
+			m_FrameStart = now;
+		}
+
+		if (m_CapturePending && finishedFrame >= m_CaptureLastFrame)
+		{
+			m_CapturePending = false;
+			if (WriteChromeTrace(m_CapturePath, m_CaptureFirstFrame, m_CaptureLastFrame))
+			{
+				AK_INFO("profiler capture of frames {} to {} written to {}", m_CaptureFirstFrame, m_CaptureLastFrame, m_CapturePath);
+			}
+		}
+	}
+
+	uint64_t Profiler::GetFrameIndex()
+	{
+		std::lock_guard<std::mutex> lock(GetInstance().m_FramesMutex);
+		return GetInstance().m_FrameIndex;
+	}
+
+	void Profiler::GetFrameHistoryImpl(std::vector<ProfileFrame>& frames)
+	{
+		std::lock_guard<std::mutex> lock(m_FramesMutex);
+
+		uint64_t count = std::min<uint64_t>(m_FrameIndex, FRAME_HISTORY_SIZE);
+		frames.clear();
+		frames.reserve(count);
+
+		for (uint64_t index = m_FrameIndex - count; index < m_FrameIndex; index++)
+		{
+			auto& frame = m_Frames[index % FRAME_HISTORY_SIZE];
+			frames.push_back({ frame.index, ToNanoseconds(frame.start), ToNanoseconds(frame.end) });
+		}
+	}
+
+	bool Profiler::GetFrameImpl(uint64_t index, ProfileFrame& frame)
+	{
+		std::lock_guard<std::mutex> lock(m_FramesMutex);
+
+		if (index >= m_FrameIndex || index + FRAME_HISTORY_SIZE < m_FrameIndex)
+		{
+			return false;
+		}
+
+		auto& recorded = m_Frames[index % FRAME_HISTORY_SIZE];
+		frame = { recorded.index, ToNanoseconds(recorded.start), ToNanoseconds(recorded.end) };
+		return true;
+	}
+
+	void Profiler::CollectEventsImpl(uint64_t start, uint64_t end, std::vector<ProfileRecord>& records)
+	{
+		std::vector<ThreadBuffer*> threads;
+		{
+			std::lock_guard<std::mutex> lock(m_ThreadsMutex);
+			threads = m_Threads;
+		}
+
+		std::vector<ProfileEvent> events;
+		for (auto buffer : threads)
+		{
+			uint64_t written = buffer->writeIndex.load(std::memory_order_acquire);
+			uint64_t first = written > THREAD_BUFFER_SIZE ? written - THREAD_BUFFER_SIZE : 0;
+
+			events.clear();
+			for (uint64_t index = first; index < written; index++)
+			{
+				events.push_back(buffer->events[index & (THREAD_BUFFER_SIZE - 1)]);
+			}
+
+			// the owner kept writing during the copy, the slots it reused may have been read half written.
+			uint64_t writtenAfter = buffer->writeIndex.load(std::memory_order_acquire);
+			uint64_t overwritten = writtenAfter > THREAD_BUFFER_SIZE ? writtenAfter - THREAD_BUFFER_SIZE : 0;
+
+			for (uint64_t index = std::max(first, overwritten); index < written; index++)
+			{
+				// frames go through the same conversion, so an event never falls out of the frame it was recorded in.
+				ProfileEvent event = events[index - first];
+				event.start = ToNanoseconds(event.start);
+				event.end = ToNanoseconds(event.end);
+
+				if (event.start >= start && event.start < end)
+				{
+					records.push_back({ event, buffer->id });
+				}
+			}
+		}
+	}
+
+	std::vector<std::pair<uint32_t, std::string>> Profiler::GetThreadNamesImpl()
+	{
+		std::lock_guard<std::mutex> lock(m_ThreadsMutex);
+
+		std::vector<std::pair<uint32_t, std::string>> names;
+		for (auto buffer : m_Threads)
+		{
+			names.push_back({ buffer->id, buffer->name });
+		}
+
+		return names;
+	}
+
+	bool Profiler::WriteChromeTrace(const std::string& path, uint64_t firstFrame, uint64_t lastFrame)
+	{
+		ProfileFrame first, last;
+		if (!GetFrame(firstFrame, first) || !GetFrame(lastFrame, last))
+		{
+			AK_ERROR("profiler frames {} to {} are not in the history", firstFrame, lastFrame);
+			return false;
+		}
+
+		return GetInstance().WriteChromeTraceImpl(path, first.start, last.end);
+	}
+
+	static std::string EscapeJSON(const char* text)
+	{
+		std::string escaped;
+		for (const char* c = text; *c != '\0'; c++)
+		{
+			if (*c == '"' || *c == '\\')
+			{
+				escaped += '\\';
+			}
+
+			escaped += *c;
+		}
+
+		return escaped;
+	}
+
+	bool Profiler::WriteChromeTraceImpl(const std::string& path, uint64_t start, uint64_t end)
+	{
+		std::vector<ProfileRecord> records;
+		CollectEventsImpl(start, end, records);
+
+		std::vector<ProfileFrame> frames;
+		GetFrameHistoryImpl(frames);
+
+		uint32_t frameThreadID;
+		{
+			std::lock_guard<std::mutex> lock(m_FramesMutex);
+			frameThreadID = m_FrameThreadID;
+		}
+
+		std::ofstream file(path, std::ios::trunc);
+		if (!file.is_open())
+		{
+			AK_ERROR("could not open the trace file {}", path);
+			return false;
+		}
+
+		// timestamps are in microseconds, relative to the start of the profiler.
+		auto toMicroseconds = [](uint64_t time) { return (double)time / 1000.0; };
+
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		bool firstEvent = true;
+		auto separator = [&]() -> const char* { const char* s = firstEvent ? "" : ",\n"; firstEvent = false; return s; };
+
+		for (auto& thread : GetThreadNamesImpl())
+		{
+			file << separator() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread.first
+				<< ",\"args\":{\"name\":\"" << EscapeJSON(thread.second.c_str()) << "\"}}";
+		}
+
+		for (auto& frame : frames)
+		{
+			if (frame.start >= start && frame.start < end)
+			{
+				file << separator() << "{\"name\":\"Frame " << frame.index << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":0,\"tid\":" << frameThreadID
+					<< ",\"ts\":" << toMicroseconds(frame.start) << ",\"dur\":" << (double)(frame.end - frame.start) / 1000.0 << "}";
+			}
+		}
+
+		for (auto& record : records)
+		{
+			file << separator() << "{\"name\":\"" << EscapeJSON(record.event.name) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << record.threadID
+				<< ",\"ts\":" << toMicroseconds(record.event.start) << ",\"dur\":" << (double)(record.event.end - record.event.start) / 1000.0 << "}";
+		}
+
+		file << "\n]}\n";
+		return true;
+	}
+
+	void Profiler::CaptureFramesImpl(const std::string& path, unsigned int frameCount)
+	{
+		if (frameCount == 0)
+		{
+			return;
+		}
+
+		// starts with the frame in progress.
+		uint64_t frameIndex = GetFrameIndex();
+		m_CapturePath = path;
+		m_CaptureFirstFrame = frameIndex;
+		m_CaptureLastFrame = frameIndex + frameCount - 1;
+		m_CapturePending = true;
+	}
+}
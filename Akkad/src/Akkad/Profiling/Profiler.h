@@ -0,0 +1,198 @@
+#pragma once
+#include "Akkad/core.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define AK_PROFILER_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define AK_PROFILER_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#define AK_PROFILER_CNTVCT
+#endif
+
+// the profiler is compiled in unless AK_DISABLE_PROFILING is defined, the macros expand to nothing then.
+#ifndef AK_DISABLE_PROFILING
+#define AK_PROFILING_ENABLED
+#endif
+
+namespace Akkad {
+
+	struct ProfileEvent {
+		const char* name; // must outlive the profiler, string literals or Profiler::InternName()
+		uint64_t start; // ticks of Profiler::GetTicks() in the buffers, nanoseconds once read out, see Profiler::Now()
+		uint64_t end;
+		uint32_t depth; // amount of zones the event is nested in
+	};
+
+	struct ProfileRecord {
+		ProfileEvent event;
+		uint32_t threadID;
+	};
+
+	struct ProfileFrame {
+		uint64_t index;
+		uint64_t start;
+		uint64_t end;
+	};
+
+	// scoped CPU zones, see AK_PROFILE_SCOPE. every thread records into its own ring buffer without locking,
+	// the oldest events are overwritten once the ring is full. readers copy the rings while they are written
+	// and drop the events that were overwritten during the copy.
+	class Profiler
+	{
+	public:
+		enum { THREAD_BUFFER_SIZE = 1 << 16, FRAME_HISTORY_SIZE = 512 };
+
+		static Profiler& GetInstance() { return s_Instance; }
+
+		// raw counter read by the zones : the TSC on x86, the virtual counter on ARM64, the steady clock elsewhere.
+		// the tick rate is measured once when the profiler starts, ticks are only converted when events are read.
+		static uint64_t GetTicks()
+		{
+#if defined(AK_PROFILER_RDTSC)
+			return __rdtsc();
+#elif defined(AK_PROFILER_CNTVCT)
+			uint64_t ticks;
+			asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+			return ticks;
+#else
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+		}
+
+		// nanoseconds since the profiler started, the time base of everything the profiler returns.
+		static uint64_t Now() { return ToNanoseconds(GetTicks()); }
+		static uint64_t ToNanoseconds(uint64_t ticks);
+
+
+		// shown as the thread's name in the trace.
+		static void SetThreadName(const char* name) { GetInstance().SetThreadNameImpl(name); }
+		// a copy of a name built at runtime that lives as long as the profiler, for zones not named by a literal.
+		static const char* InternName(const std::string& name) { return GetInstance().InternNameImpl(name); }
+
+		// closes the current frame and opens the next one, called once per frame by the main loop.
+		static void MarkFrame() { GetInstance().MarkFrameImpl(); }
+		static uint64_t GetFrameIndex();
+		// the finished frames still in the history, oldest first.
+		static void GetFrameHistory(std::vector<ProfileFrame>& frames) { GetInstance().GetFrameHistoryImpl(frames); }
+		static bool GetFrame(uint64_t index, ProfileFrame& frame) { return GetInstance().GetFrameImpl(index, frame); }
+
+		// events that started in [start, end), from every thread. the range and the events are in nanoseconds.
+		static void CollectEvents(uint64_t start, uint64_t end, std::vector<ProfileRecord>& records) { GetInstance().CollectEventsImpl(start, end, records); }
+		static std::vector<std::pair<uint32_t, std::string>> GetThreadNames() { return GetInstance().GetThreadNamesImpl(); }
+
+		// chrome://tracing or Perfetto JSON, of every event still in the buffers or of a range of finished frames.
+		static bool WriteChromeTrace(const std::string& path) { return GetInstance().WriteChromeTraceImpl(path, 0, UINT64_MAX); }
+		static bool WriteChromeTrace(const std::string& path, uint64_t firstFrame, uint64_t lastFrame);
+		// writes the trace of the next frameCount frames once the last one is finished.
+		static void CaptureFrames(const std::string& path, unsigned int frameCount) { GetInstance().CaptureFramesImpl(path, frameCount); }
+
+	private:
+		Profiler();
+		~Profiler() {};
+
+		static Profiler s_Instance;
+
+		struct ThreadBuffer {
+			uint32_t id = 0;
+			std::string name;
+			uint32_t depth = 0;
+			std::atomic<uint64_t> writeIndex{ 0 };
+			ProfileEvent events[THREAD_BUFFER_SIZE];
+		};
+
+		static thread_local ThreadBuffer* t_ThreadBuffer;
+		static ThreadBuffer* GetThreadBuffer();
+		ThreadBuffer* RegisterThread();
+
+		// a zone looks its thread buffer up once, the end of the zone is inlined.
+		static ThreadBuffer* BeginZone();
+
+		static void EndZone(ThreadBuffer* buffer, const char* name, uint64_t start, uint64_t end)
+		{
+			buffer->depth--;
+
+			// only this thread writes the index, the release store publishes the event to the readers.
+			uint64_t index = buffer->writeIndex.load(std::memory_order_relaxed);
+			buffer->events[index & (THREAD_BUFFER_SIZE - 1)] = { name, start, end, buffer->depth };
+			buffer->writeIndex.store(index + 1, std::memory_order_release);
+		}
+
+		friend class ProfileScope;
+
+		void SetThreadNameImpl(const char* name);
+		const char* InternNameImpl(const std::string& name);
+		void MarkFrameImpl();
+		void GetFrameHistoryImpl(std::vector<ProfileFrame>& frames);
+		bool GetFrameImpl(uint64_t index, ProfileFrame& frame);
+		void CollectEventsImpl(uint64_t start, uint64_t end, std::vector<ProfileRecord>& records);
+		std::vector<std::pair<uint32_t, std::string>> GetThreadNamesImpl();
+		bool WriteChromeTraceImpl(const std::string& path, uint64_t start, uint64_t end);
+		void CaptureFramesImpl(const std::string& path, unsigned int frameCount);
+
+		uint64_t m_EpochTicks;
+		double m_NanosecondsPerTick = 1.0;
+
+		// buffers are never freed, the events of a thread outlive it.
+		std::mutex m_ThreadsMutex;
+		std::vector<ThreadBuffer*> m_Threads;
+
+		// nodes of the set do not move, the events keep pointing at them.
+		std::mutex m_NamesMutex;
+		std::unordered_set<std::string> m_Names;
+
+		std::mutex m_FramesMutex;
+		ProfileFrame m_Frames[FRAME_HISTORY_SIZE];
+		// in ticks, converted when the history is read.
+		uint64_t m_FrameIndex = 0;
+		uint64_t m_FrameStart;
+		uint32_t m_FrameThreadID = 0;
+
+		std::string m_CapturePath;
+		uint64_t m_CaptureFirstFrame = 0;
+		uint64_t m_CaptureLastFrame = 0;
+		bool m_CapturePending = false;
+	};
+
+	class ProfileScope
+	{
+	public:
+		ProfileScope(const char* name) : m_Name(name)
+		{
+			m_Buffer = Profiler::BeginZone();
+			m_Start = Profiler::GetTicks();
+		}
+
+		~ProfileScope()
+		{
+			Profiler::EndZone(m_Buffer, m_Name, m_Start, Profiler::GetTicks());
+		}
+
+	private:
+		Profiler::ThreadBuffer* m_Buffer;
+		const char* m_Name;
+		uint64_t m_Start;
+	};
+}
+
+#ifdef AK_PROFILING_ENABLED
+#define AK_PROFILE_CONCAT_IMPL(a, b) a##b
+#define AK_PROFILE_CONCAT(a, b) AK_PROFILE_CONCAT_IMPL(a, b)
+#define AK_PROFILE_SCOPE(name) ::Akkad::ProfileScope AK_PROFILE_CONCAT(akProfileScope, __LINE__)(name)
+#define AK_PROFILE_THREAD(name) ::Akkad::Profiler::SetThreadName(name)
+#define AK_PROFILE_FRAME() ::Akkad::Profiler::MarkFrame()
+#else
+#define AK_PROFILE_SCOPE(name)
+#define AK_PROFILE_THREAD(name)
+#define AK_PROFILE_FRAME()
+#endif
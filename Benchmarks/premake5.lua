@@ -0,0 +1,36 @@
+project "Benchmarks"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "off"
+
+	targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("%{wks.location}/bin-int/" .. outputdir .. "/%{prj.name}")
+
+	files {
+		"src/**.h",
+		"src/**.cpp"
+	}
+	includedirs {
+		"src/",
+		"%{wks.location}/Akkad/src",
+		"%{IncludeDir.glm}",
+	}
+
+	links {
+	"Akkad"
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+
+	filter "configurations:Debug"
+		defines "AK_DEBUG"
+		runtime "Debug"
+		symbols "on"
+
+	-- numbers from a debug build are meaningless, run the release configuration.
+	filter "configurations:Release"
+		defines "AK_RELEASE"
+		runtime "Release"
+		optimize "on"
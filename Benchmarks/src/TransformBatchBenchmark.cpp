@@ -0,0 +1,176 @@
+#include "Akkad/Math/TransformBatch.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace Akkad;
+
+// compares TransformBatch with the glm chain TransformComponent::RecalculateTransformMatrix uses,
+// over a hierarchy where a quarter of the transforms are roots and the rest are their children.
+namespace {
+
+	struct Transforms
+	{
+		std::vector<float> positionX, positionY, positionZ;
+		std::vector<float> rotationX, rotationY, rotationZ;
+		std::vector<float> scaleX, scaleY, scaleZ;
+		std::vector<uint32_t> parents;
+
+		TransformSoA GetSoA() const
+		{
+			return { positionX.data(), positionY.data(), positionZ.data(), rotationX.data(), rotationY.data(), rotationZ.data(), scaleX.data(), scaleY.data(), scaleZ.data() };
+		}
+	};
+
+	// the layout TransformComponent keeps its values in.
+	struct ComponentTransform
+	{
+		glm::vec3 position;
+		glm::vec3 rotation;
+		glm::vec3 scale;
+		glm::mat4 localMatrix;
+		glm::mat4 worldMatrix;
+	};
+
+	Transforms CreateTransforms(size_t count)
+	{
+		std::mt19937 random(1234);
+		std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+		std::uniform_real_distribution<float> rotation(-6.3f, 6.3f);
+		std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+
+		Transforms transforms;
+		std::vector<float>* arrays[] = { &transforms.positionX, &transforms.positionY, &transforms.positionZ, &transforms.rotationX, &transforms.rotationY, &transforms.rotationZ, &transforms.scaleX, &transforms.scaleY, &transforms.scaleZ };
+		for (auto array : arrays)
+		{
+			array->resize(count);
+		}
+
+		size_t rootCount = std::max<size_t>(count / 4, 1);
+		transforms.parents.resize(count);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			transforms.positionX[i] = position(random);
+			transforms.positionY[i] = position(random);
+			transforms.positionZ[i] = position(random);
+			transforms.rotationX[i] = rotation(random);
+			transforms.rotationY[i] = rotation(random);
+			transforms.rotationZ[i] = rotation(random);
+			transforms.scaleX[i] = scale(random);
+			transforms.scaleY[i] = scale(random);
+			transforms.scaleZ[i] = scale(random);
+			transforms.parents[i] = i < rootCount ? TransformBatch::INVALID_PARENT : (uint32_t)(random() % rootCount);
+		}
+
+		return transforms;
+	}
+
+	void ComputeWithGLM(std::vector<ComponentTransform>& components, const std::vector<uint32_t>& parents)
+	{
+		for (size_t i = 0; i < components.size(); i++)
+		{
+			auto& component = components[i];
+			component.localMatrix = glm::mat4(1.0f);
+			component.localMatrix = glm::translate(component.localMatrix, component.position);
+			component.localMatrix = glm::scale(component.localMatrix, component.scale);
+
+			component.localMatrix = glm::rotate(component.localMatrix, component.rotation.x, { 1,0,0 });
+			component.localMatrix = glm::rotate(component.localMatrix, component.rotation.y, { 0,1,0 });
+			component.localMatrix = glm::rotate(component.localMatrix, component.rotation.z, { 0,0,1 });
+
+			auto parent = parents[i];
+			component.worldMatrix = parent != TransformBatch::INVALID_PARENT ? components[parent].worldMatrix * component.localMatrix : component.localMatrix;
+		}
+	}
+
+	// best of a few runs, in nanoseconds per transform.
+	template<typename Function>
+	double Measure(size_t count, Function function)
+	{
+		int runs = count >= 1000000 ? 5 : 20;
+		double best = 1e30;
+
+		for (int run = 0; run < runs; run++)
+		{
+			auto start = std::chrono::steady_clock::now();
+			function();
+			auto end = std::chrono::steady_clock::now();
+			best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count());
+		}
+
+		return best / (double)count;
+	}
+
+	float GetMaxError(const std::vector<glm::mat4>& matrices, const std::vector<ComponentTransform>& components)
+	{
+		float maxError = 0.0f;
+		for (size_t i = 0; i < matrices.size(); i++)
+		{
+			for (int column = 0; column < 4; column++)
+			{
+				for (int row = 0; row < 4; row++)
+				{
+					float reference = components[i].worldMatrix[column][row];
+					float error = std::abs(matrices[i][column][row] - reference) / std::max(1.0f, std::abs(reference));
+					maxError = std::max(maxError, error);
+				}
+			}
+		}
+
+		return maxError;
+	}
+}
+
+int main()
+{
+	const size_t counts[] = { 10000, 100000, 1000000 };
+	const SIMDLevel levels[] = { SIMDLevel::Scalar, SIMDLevel::SSE, SIMDLevel::AVX2, SIMDLevel::WasmSIMD };
+	SIMDLevel bestLevel = TransformBatch::GetSIMDLevel();
+
+	printf("best supported level: %s\n\n", TransformBatch::GetSIMDLevelName(bestLevel));
+	printf("%10s %-10s %12s %10s %12s\n", "count", "kernel", "ns/entity", "speedup", "max error");
+
+	for (auto count : counts)
+	{
+		auto transforms = CreateTransforms(count);
+
+		std::vector<ComponentTransform> components(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			components[i].position = { transforms.positionX[i], transforms.positionY[i], transforms.positionZ[i] };
+			components[i].rotation = { transforms.rotationX[i], transforms.rotationY[i], transforms.rotationZ[i] };
+			components[i].scale = { transforms.scaleX[i], transforms.scaleY[i], transforms.scaleZ[i] };
+		}
+
+		double glmTime = Measure(count, [&]() { ComputeWithGLM(components, transforms.parents); });
+		printf("%10zu %-10s %12.2f %9.2fx %12s\n", count, "glm", glmTime, 1.0, "-");
+
+		std::vector<glm::mat4> localMatrices(count);
+		std::vector<glm::mat4> worldMatrices(count);
+		auto soa = transforms.GetSoA();
+
+		for (auto level : levels)
+		{
+			if (!TransformBatch::SetSIMDLevel(level))
+			{
+				continue;
+			}
+
+			double time = Measure(count, [&]() { TransformBatch::ComputeWorldMatrices(soa, transforms.parents.data(), localMatrices.data(), worldMatrices.data(), count); });
+			float error = GetMaxError(worldMatrices, components);
+			printf("%10zu %-10s %12.2f %9.2fx %12.2e\n", count, TransformBatch::GetSIMDLevelName(level), time, glmTime / time, error);
+		}
+
+		TransformBatch::SetSIMDLevel(bestLevel);
+		printf("\n");
+	}
+
+	return 0;
+}
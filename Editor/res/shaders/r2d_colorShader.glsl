@@ -2,7 +2,13 @@
 
 #version 400
 layout (location = 0) in vec3 position;
-layout (location = 1) in vec3 aColor;
+layout (location = 1) in vec2 aTexCoord;
+
+// per instance attributes, see Renderer2D::QuadInstance
+layout (location = 2) in vec2 aTranslation;
+layout (location = 3) in vec4 aLinear;
+layout (location = 4) in vec4 aColor;
+layout (location = 5) in vec4 aTextureRect;
 
 out vec3 color;
 layout (std140) uniform sys_SceneProps {
@@ -12,12 +18,28 @@ layout (std140) uniform sys_SceneProps {
 
 layout (std140) uniform shader_props {
     vec3 props_color;
+    float props_picking;
 };
 
+// the columns of the 2x2 part of the world matrix, scale and rotation in the order the engine composes them
+vec2 InstancePosition()
+{
+    return mat2(aLinear.xy, aLinear.zw) * position.xy + aTranslation;
+}
+
 void main()
 {
-    color = aColor;
-    gl_Position = sys_viewProjection * vec4(position, 1.0);
+    if (props_picking > 0.5)
+    {
+        // the RGB bytes hold a 24 bit picking ID
+        vec3 bytes = floor(aColor.rgb * 255.0 + 0.5);
+        color = vec3(bytes.r + bytes.g * 256.0 + bytes.b * 65536.0, 0.0, 0.0);
+    }
+    else
+    {
+        color = aColor.rgb;
+    }
+    gl_Position = sys_viewProjection * vec4(InstancePosition(), 0.0, 1.0);
 }
 
 #FRAGMENT_SHADER
@@ -26,6 +48,7 @@ void main()
 
 layout (std140) uniform shader_props {
     vec3 props_color;
+    float props_picking;
 };
 
 in vec3 color;
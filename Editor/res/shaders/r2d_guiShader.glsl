@@ -0,0 +1,57 @@
+#VERTEX_SHADER
+
+#version 400
+// see GUI::GUIDrawList::Vertex
+layout (location = 0) in vec2 position;
+layout (location = 1) in vec2 aTexCoord;
+layout (location = 2) in vec4 aColor;
+
+out vec2 TexCoord;
+out vec4 color;
+
+layout (std140) uniform sys_SceneProps {
+    mat4 sys_transform;
+    mat4 sys_viewProjection;
+};
+
+layout (std140) uniform shader_props {
+    float props_picking;
+};
+
+void main()
+{
+    if (props_picking > 0.5)
+    {
+        // the RGB bytes hold a 24 bit picking ID
+        vec3 bytes = floor(aColor.rgb * 255.0 + 0.5);
+        color = vec4(bytes.r + bytes.g * 256.0 + bytes.b * 65536.0, 0.0, 0.0, 1.0);
+    }
+    else
+    {
+        color = aColor;
+    }
+
+    TexCoord = aTexCoord;
+    gl_Position = sys_viewProjection * vec4(position, 0.0, 1.0);
+}
+
+#FRAGMENT_SHADER
+
+#version 400
+uniform sampler2D gui_texture;
+in vec2 TexCoord;
+in vec4 color;
+out vec4 FragColor;
+
+void main()
+{
+    // solid quads have negative texture coords, glyphs sample the coverage from the atlas red channel.
+    if (TexCoord.x < 0.0)
+    {
+        FragColor = color;
+    }
+    else
+    {
+        FragColor = vec4(color.rgb, color.a * texture(gui_texture, TexCoord).r);
+    }
+}
@@ -13,6 +13,7 @@
 #include "Panels/MaterialEditorPanel.h"
 #include "Panels/SortingLayersPanel.h"
 #include "Panels/ProjectExportPanel.h"
+#include "Panels/ProfilerPanel.h"
 
 #include <Akkad/Application/Application.h>
 #include <Akkad/Logging.h>
@@ -354,6 +355,10 @@ namespace Akkad {
 						Renderer2D::SetPhysicsDebugDrawState(physicsdebug);
 					}
 
+					ViewPortPanel* viewport = (ViewPortPanel*)PanelManager::GetPanel("viewport");
+					ImGui::Checkbox("Pick with the picking buffer", &viewport->UseGPUPicking);
+					ImGui::Checkbox("Show render stats", &viewport->ShowRenderStats);
+
 					ImGui::EndMenu();
 				}
 				if (ImGui::MenuItem("Recompile shaders"))
@@ -393,6 +398,11 @@ namespace Akkad {
 					PanelManager::AddPanel(new GameViewPanel());
 				}
 
+				if (ImGui::MenuItem("Profiler"))
+				{
+					PanelManager::AddPanel(new ProfilerPanel());
+				}
+
 				ImGui::EndMenu();
 			}
 
@@ -20,7 +20,15 @@ namespace Akkad {
 		descriptor.height = 800;
 		descriptor.ColorAttachmentFormat = TextureFormat::RGB16;
 
-		m_buffer = Application::GetRenderPlatform()->CreateFrameBuffer(descriptor);
+		m_buffer = Application::GetRenderPlatform()->AcquireRenderTarget(descriptor);
+	}
+
+	GameViewPanel::~GameViewPanel()
+	{
+		if (Application::GetRenderPlatform() != nullptr)
+		{
+			Application::GetRenderPlatform()->ReleaseRenderTarget(m_buffer);
+		}
 	}
 
 	void GameViewPanel::DrawImGui()
@@ -35,7 +43,11 @@ namespace Akkad {
 			m_AspectRatio = panelSize.x / panelSize.y;
 			m_buffer->SetSize(panelSize.x, panelSize.y);
 			m_buffer->Bind();
-			ImGui::Image((void*)m_buffer->GetColorAttachmentTexture(), panelSize, ImVec2{ 0, 1 }, ImVec2{ 1, 0 });
+
+			auto& bufferDesc = m_buffer->GetDescriptor();
+			glm::vec2 storageSize = m_buffer->GetStorageSize();
+			ImVec2 textureCoordsMax = { bufferDesc.width / storageSize.x, bufferDesc.height / storageSize.y };
+			ImGui::Image((void*)m_buffer->GetColorAttachmentTexture(), panelSize, ImVec2{ 0, textureCoordsMax.y }, ImVec2{ textureCoordsMax.x, 0 });
 			m_buffer->Unbind();
 			IsSelected = true;
 
@@ -67,7 +79,6 @@ namespace Akkad {
 			auto sceneManager = Application::GetSceneManager();
 			sceneManager->GetActiveScene()->SetViewportRect(m_ViewportRect);
 			sceneManager->GetActiveScene()->SetViewportSize({ m_buffer->GetDescriptor().width, m_buffer->GetDescriptor().height });
-			sceneManager->GetActiveScene()->RenderPickingBuffer2D();
 			m_buffer->Bind();
 			sceneManager->GetActiveScene()->BeginRenderer2D(m_AspectRatio);
 			sceneManager->GetActiveScene()->Render2D();
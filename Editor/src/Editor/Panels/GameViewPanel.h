@@ -13,7 +13,7 @@ namespace Akkad {
 	{
 	public:
 		GameViewPanel();
-		~GameViewPanel() {};
+		~GameViewPanel();
 
 		virtual void DrawImGui() override;
 		virtual void OnOpen() override { showPanel = true; }
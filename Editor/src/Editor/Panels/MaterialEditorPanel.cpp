@@ -118,7 +118,7 @@ namespace Akkad {
 
 					if (desc.assetType == AssetType::TEXTURE)
 					{
-						textureProp.assetID = id;
+						m_Material->SetTexture(textureProp.samplerName, id);
 					}
 
 				}
@@ -142,7 +142,7 @@ namespace Akkad {
 				{
 					float bufferValue = m_Material->m_PropertyBuffer->GetData<float>(elementName);
 					ImGui::InputFloat(elementName.c_str(), &bufferValue);
-					m_Material->m_PropertyBuffer->SetData(elementName, bufferValue);
+					m_Material->SetProperty(elementName, bufferValue);
 					break;
 				}
 
@@ -150,7 +150,7 @@ namespace Akkad {
 				{
 					glm::vec2 bufferValue = m_Material->m_PropertyBuffer->GetData<glm::vec2>(elementName);
 					ImGui::InputFloat2(elementName.c_str(), glm::value_ptr(bufferValue));
-					m_Material->m_PropertyBuffer->SetData(elementName, bufferValue);
+					m_Material->SetProperty(elementName, bufferValue);
 					break;
 				}
 
@@ -165,7 +165,7 @@ namespace Akkad {
 					{
 						ImGui::InputFloat3(elementName.c_str(), glm::value_ptr(bufferValue));
 					}
-					m_Material->m_PropertyBuffer->SetData(elementName, bufferValue);
+					m_Material->SetProperty(elementName, bufferValue);
 					break;
 				}
 
@@ -173,7 +173,7 @@ namespace Akkad {
 				{
 					glm::vec4 bufferValue = m_Material->m_PropertyBuffer->GetData<glm::vec4>(elementName);
 					ImGui::InputFloat4(elementName.c_str(), glm::value_ptr(bufferValue));
-					m_Material->m_PropertyBuffer->SetData(elementName, bufferValue);
+					m_Material->SetProperty(elementName, bufferValue);
 					break;
 				}
 
@@ -181,7 +181,7 @@ namespace Akkad {
 				{
 					unsigned int bufferValue = m_Material->m_PropertyBuffer->GetData<unsigned int>(elementName);
 					ImGui::InputScalar(elementName.c_str(), ImGuiDataType_U32, &bufferValue);
-					m_Material->m_PropertyBuffer->SetData(elementName, bufferValue);
+					m_Material->SetProperty(elementName, bufferValue);
 					break;
 				}
 
@@ -0,0 +1,417 @@
+#include "ProfilerPanel.h"
+
+#include <Akkad/Logging.h>
+#include <Akkad/Application/Application.h>
+#include <Akkad/ECS/SceneManager.h>
+
+#include <imgui.h>
+#include <algorithm>
+#include <unordered_map>
+
+namespace Akkad {
+	bool ProfilerPanel::showPanel;
+
+	static float ToMilliseconds(uint64_t duration)
+	{
+		return (float)((double)duration / 1000000.0);
+	}
+
+	static ImU32 GetZoneColor(const char* name)
+	{
+		// the same zone keeps its color from a frame to the other.
+		unsigned int hash = 2166136261u;
+		for (const char* c = name; *c != '\0'; c++)
+		{
+			hash = (hash ^ (unsigned char)*c) * 16777619u;
+		}
+
+		return ImColor::HSV((hash % 360) / 360.0f, 0.45f, 0.75f);
+	}
+
+	void ProfilerPanel::DrawImGui()
+	{
+		if (ImGui::Begin("Profiler", &showPanel))
+		{
+			Profiler::GetFrameHistory(m_Frames);
+
+			if (!m_Frames.empty())
+			{
+				auto& lastFrame = m_Frames.back();
+				m_RenderStats[lastFrame.index % Profiler::FRAME_HISTORY_SIZE] = Graphics::RenderStats::GetLastFrame();
+
+				if (!m_Frozen && (m_Frame.end == 0 || m_Frame.index != lastFrame.index))
+				{
+					SelectFrame(lastFrame.index);
+				}
+			}
+
+			if (m_Frozen)
+			{
+				if (ImGui::Button("Resume"))
+				{
+					m_Frozen = false;
+				}
+				ImGui::SameLine();
+				ImGui::Text("frame %llu is frozen", (unsigned long long)m_Frame.index);
+			}
+			else
+			{
+				ImGui::TextDisabled("click a frame in the graph to freeze it");
+			}
+
+			ImGui::SameLine();
+			if (ImGui::Button("Save trace") && !m_Frames.empty())
+			{
+				uint64_t firstFrame = m_Frozen ? m_Frame.index : m_Frames.front().index;
+				uint64_t lastFrame = m_Frozen ? m_Frame.index : m_Frames.back().index;
+
+				if (Profiler::WriteChromeTrace("profiler_trace.json", firstFrame, lastFrame))
+				{
+					AK_INFO("profiler trace of frames {} to {} written to profiler_trace.json", firstFrame, lastFrame);
+				}
+			}
+
+			DrawFrameGraph();
+
+			if (ImGui::CollapsingHeader("Timeline", ImGuiTreeNodeFlags_DefaultOpen))
+			{
+				DrawTimeline();
+			}
+
+			if (ImGui::CollapsingHeader("Top zones", ImGuiTreeNodeFlags_DefaultOpen))
+			{
+				DrawTopZones();
+			}
+
+			if (ImGui::CollapsingHeader("Render stats", ImGuiTreeNodeFlags_DefaultOpen))
+			{
+				DrawRenderStats();
+			}
+
+			if (ImGui::CollapsingHeader("Systems"))
+			{
+				DrawSystemTimings();
+			}
+		}
+		ImGui::End();
+	}
+
+	void ProfilerPanel::DrawFrameGraph()
+	{
+		const float graphHeight = 80.0f;
+		const float budgets[] = { 1000.0f / 60.0f, 1000.0f / 30.0f };
+
+		ImVec2 origin = ImGui::GetCursorScreenPos();
+		float width = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+		ImGui::InvisibleButton("##frame_graph", { width, graphHeight });
+
+		auto drawList = ImGui::GetWindowDrawList();
+		drawList->AddRectFilled(origin, { origin.x + width, origin.y + graphHeight }, IM_COL32(25, 25, 25, 255));
+
+		// the scale grows with the slowest frame, but never below the 30 fps budget so a steady frame rate reads flat.
+		float maxMilliseconds = budgets[1];
+		for (auto& frame : m_Frames)
+		{
+			maxMilliseconds = std::max(maxMilliseconds, ToMilliseconds(frame.end - frame.start));
+		}
+
+		// the newest frame is on the right.
+		float barWidth = width / Profiler::FRAME_HISTORY_SIZE;
+		float firstBarX = origin.x + (Profiler::FRAME_HISTORY_SIZE - m_Frames.size()) * barWidth;
+
+		int hoveredFrame = -1;
+		if (ImGui::IsItemHovered())
+		{
+			int index = (int)((ImGui::GetIO().MousePos.x - firstBarX) / barWidth);
+			if (index >= 0 && index < (int)m_Frames.size())
+			{
+				hoveredFrame = index;
+			}
+		}
+
+		for (size_t i = 0; i < m_Frames.size(); i++)
+		{
+			auto& frame = m_Frames[i];
+			float milliseconds = ToMilliseconds(frame.end - frame.start);
+			float height = std::max(milliseconds / maxMilliseconds * graphHeight, 1.0f);
+
+			ImU32 color = IM_COL32(90, 180, 90, 255);
+			if (milliseconds > budgets[1])
+			{
+				color = IM_COL32(220, 80, 70, 255);
+			}
+			else if (milliseconds > budgets[0])
+			{
+				color = IM_COL32(220, 190, 70, 255);
+			}
+
+			if ((m_Frozen && frame.index == m_Frame.index) || (int)i == hoveredFrame)
+			{
+				color = IM_COL32(255, 255, 255, 255);
+			}
+
+			float x = firstBarX + i * barWidth;
+			drawList->AddRectFilled({ x, origin.y + graphHeight - height }, { x + std::max(barWidth - 1.0f, 1.0f), origin.y + graphHeight }, color);
+		}
+
+		for (float budget : budgets)
+		{
+			float y = origin.y + graphHeight - budget / maxMilliseconds * graphHeight;
+			drawList->AddLine({ origin.x, y }, { origin.x + width, y }, IM_COL32(255, 255, 255, 60));
+		}
+
+		if (hoveredFrame != -1)
+		{
+			auto& frame = m_Frames[hoveredFrame];
+			ImGui::SetTooltip("frame %llu : %.2f ms", (unsigned long long)frame.index, ToMilliseconds(frame.end - frame.start));
+
+			if (ImGui::IsItemClicked())
+			{
+				m_Frozen = true;
+				SelectFrame(frame.index);
+			}
+		}
+	}
+
+	void ProfilerPanel::DrawTimeline()
+	{
+		if (m_Frame.end == 0)
+		{
+			ImGui::TextDisabled("no finished frame yet");
+			return;
+		}
+
+		uint64_t frameDuration = std::max<uint64_t>(m_Frame.end - m_Frame.start, 1);
+		ImGui::Text("frame %llu : %.2f ms", (unsigned long long)m_Frame.index, ToMilliseconds(frameDuration));
+
+		const float rowHeight = ImGui::GetTextLineHeight() + 4.0f;
+		float width = std::max(ImGui::GetContentRegionAvail().x, 1.0f);
+		auto drawList = ImGui::GetWindowDrawList();
+
+		for (auto& thread : Profiler::GetThreadNames())
+		{
+			uint32_t maxDepth = 0;
+			bool hasEvents = false;
+			for (auto& record : m_Records)
+			{
+				if (record.threadID == thread.first)
+				{
+					maxDepth = std::max(maxDepth, record.event.depth);
+					hasEvents = true;
+				}
+			}
+
+			if (!hasEvents)
+			{
+				continue;
+			}
+
+			ImGui::TextUnformatted(thread.second.c_str());
+
+			ImGui::PushID(thread.first);
+			ImVec2 origin = ImGui::GetCursorScreenPos();
+			float height = (maxDepth + 1) * rowHeight;
+			ImGui::InvisibleButton("##timeline", { width, height });
+			bool hovered = ImGui::IsItemHovered();
+			ImGui::PopID();
+
+			drawList->AddRectFilled(origin, { origin.x + width, origin.y + height }, IM_COL32(25, 25, 25, 255));
+
+			// zones of other threads that started during the frame are shown, even if they end after it.
+			const ProfileRecord* hoveredRecord = nullptr;
+			ImVec2 mouse = ImGui::GetIO().MousePos;
+
+			for (auto& record : m_Records)
+			{
+				if (record.threadID != thread.first)
+				{
+					continue;
+				}
+
+				auto& event = record.event;
+				float x0 = origin.x + (float)((double)(event.start - m_Frame.start) / frameDuration) * width;
+				float x1 = origin.x + (float)((double)(event.end - m_Frame.start) / frameDuration) * width;
+				x1 = std::min(std::max(x1, x0 + 1.0f), origin.x + width);
+				float y0 = origin.y + event.depth * rowHeight;
+				float y1 = y0 + rowHeight - 1.0f;
+
+				drawList->AddRectFilled({ x0, y0 }, { x1, y1 }, GetZoneColor(event.name));
+
+				ImVec2 textSize = ImGui::CalcTextSize(event.name);
+				if (textSize.x + 4.0f < x1 - x0)
+				{
+					drawList->AddText({ x0 + 2.0f, y0 + 2.0f }, IM_COL32(0, 0, 0, 255), event.name);
+				}
+
+				if (hovered && mouse.x >= x0 && mouse.x < x1 && mouse.y >= y0 && mouse.y < y1)
+				{
+					hoveredRecord = &record;
+				}
+			}
+
+			if (hoveredRecord != nullptr)
+			{
+				ImGui::SetTooltip("%s\n%.3f ms", hoveredRecord->event.name, ToMilliseconds(hoveredRecord->event.end - hoveredRecord->event.start));
+			}
+		}
+	}
+
+	void ProfilerPanel::DrawTopZones()
+	{
+		ImGui::SliderInt("zones", &m_TopZoneCount, 5, 50);
+
+		ImGui::Columns(4, "##top_zones");
+		ImGui::Text("Zone"); ImGui::NextColumn();
+		ImGui::Text("Calls"); ImGui::NextColumn();
+		ImGui::Text("Exclusive ms"); ImGui::NextColumn();
+		ImGui::Text("Inclusive ms"); ImGui::NextColumn();
+		ImGui::Separator();
+
+		int count = std::min((int)m_Zones.size(), m_TopZoneCount);
+		for (int i = 0; i < count; i++)
+		{
+			auto& zone = m_Zones[i];
+			ImGui::TextUnformatted(zone.name.c_str()); ImGui::NextColumn();
+			ImGui::Text("%u", zone.calls); ImGui::NextColumn();
+			ImGui::Text("%.3f", ToMilliseconds(zone.exclusive)); ImGui::NextColumn();
+			ImGui::Text("%.3f", ToMilliseconds(zone.inclusive)); ImGui::NextColumn();
+		}
+
+		ImGui::Columns(1);
+	}
+
+	void ProfilerPanel::DrawRenderStats()
+	{
+		auto& stats = m_RenderStats[m_Frame.index % Profiler::FRAME_HISTORY_SIZE];
+		if (m_Frame.end == 0 || stats.frame == 0)
+		{
+			ImGui::TextDisabled("no render stats were recorded for this frame");
+			return;
+		}
+
+		// the render thread may lag behind, the counters are of the last render frame finished at that time.
+		ImGui::Text("render frame : %llu", (unsigned long long)stats.frame);
+		ImGui::Text("draw calls : %u (%u instanced)", stats.drawCalls, stats.instancedDrawCalls);
+		ImGui::Text("instances : %u", stats.instances);
+		ImGui::Text("vertices : %u", stats.vertices);
+		ImGui::Text("render packets : %u", stats.renderPackets);
+		ImGui::Text("state changes : %u (%u elided)", stats.stateChanges, stats.elidedStateChanges);
+		ImGui::Text("texture binds : %u", stats.textureBinds);
+		ImGui::Text("buffer uploads : %u (%.1f KB)", stats.bufferUploads, stats.bufferBytesUploaded / 1024.0f);
+		ImGui::Text("uniform uploads : %u", stats.uniformUploads);
+		ImGui::Text("framebuffer resizes : %u", stats.framebufferResizes);
+	}
+
+	void ProfilerPanel::DrawSystemTimings()
+	{
+		auto scene = Application::GetSceneManager()->GetActiveScene();
+		if (scene == nullptr)
+		{
+			ImGui::TextDisabled("no scene is loaded");
+			return;
+		}
+
+		// the timings are of the last update of the playing scene, not of the frame shown above.
+		ImGui::Columns(3, "##system_timings");
+		ImGui::Text("system"); ImGui::NextColumn();
+		ImGui::Text("phase"); ImGui::NextColumn();
+		ImGui::Text("ms"); ImGui::NextColumn();
+		ImGui::Separator();
+
+		for (auto& timing : scene->GetSystemScheduler().GetTimings())
+		{
+			ImGui::Text("%s", timing.name.c_str()); ImGui::NextColumn();
+			ImGui::Text("%s", SystemScheduler::GetPhaseName(timing.phase)); ImGui::NextColumn();
+			ImGui::Text("%.3f", ToMilliseconds(timing.durationNs)); ImGui::NextColumn();
+		}
+
+		ImGui::Columns(1);
+	}
+
+	void ProfilerPanel::SelectFrame(uint64_t index)
+	{
+		if (!Profiler::GetFrame(index, m_Frame))
+		{
+			return;
+		}
+
+		m_Records.clear();
+		Profiler::CollectEvents(m_Frame.start, m_Frame.end, m_Records);
+		BuildZoneSummaries();
+	}
+
+	void ProfilerPanel::BuildZoneSummaries()
+	{
+		// a parent always starts before its children, sorting by start gives each zone its parent on a stack.
+		std::sort(m_Records.begin(), m_Records.end(), [](const ProfileRecord& a, const ProfileRecord& b)
+		{
+			if (a.threadID != b.threadID)
+			{
+				return a.threadID < b.threadID;
+			}
+
+			if (a.event.start != b.event.start)
+			{
+				return a.event.start < b.event.start;
+			}
+
+			return a.event.depth < b.event.depth;
+		});
+
+		std::vector<uint64_t> exclusive(m_Records.size());
+		std::vector<size_t> openZones;
+
+		for (size_t i = 0; i < m_Records.size(); i++)
+		{
+			auto& record = m_Records[i];
+			uint64_t duration = record.event.end - record.event.start;
+			exclusive[i] = duration;
+
+			if (i > 0 && m_Records[i - 1].threadID != record.threadID)
+			{
+				openZones.clear();
+			}
+
+			while (!openZones.empty() && m_Records[openZones.back()].event.depth >= record.event.depth)
+			{
+				openZones.pop_back();
+			}
+
+			if (!openZones.empty())
+			{
+				uint64_t& parent = exclusive[openZones.back()];
+				parent -= std::min(parent, duration);
+			}
+
+			openZones.push_back(i);
+		}
+
+		// zones are grouped by name, the same literal may have a different address in every translation unit.
+		std::unordered_map<std::string, size_t> zoneIndices;
+		m_Zones.clear();
+
+		for (size_t i = 0; i < m_Records.size(); i++)
+		{
+			auto& event = m_Records[i].event;
+			auto it = zoneIndices.find(event.name);
+			if (it == zoneIndices.end())
+			{
+				it = zoneIndices.insert({ event.name, m_Zones.size() }).first;
+				m_Zones.emplace_back();
+				m_Zones.back().name = event.name;
+			}
+
+			auto& zone = m_Zones[it->second];
+			zone.calls++;
+			zone.inclusive += event.end - event.start;
+			zone.exclusive += exclusive[i];
+		}
+
+		std::sort(m_Zones.begin(), m_Zones.end(), [](const ZoneSummary& a, const ZoneSummary& b) { return a.exclusive > b.exclusive; });
+	}
+
+	void ProfilerPanel::OnClose()
+	{
+		showPanel = false;
+	}
+}
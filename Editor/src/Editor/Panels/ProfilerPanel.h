@@ -0,0 +1,53 @@
+#pragma once
+#include "Panel.h"
+
+#include "Akkad/Profiling/Profiler.h"
+#include "Akkad/Graphics/RenderStats.h"
+
+namespace Akkad {
+
+	class ProfilerPanel : public Panel
+	{
+	public:
+		ProfilerPanel() {};
+		~ProfilerPanel() {};
+
+		virtual void DrawImGui() override;
+		virtual void OnOpen() override { showPanel = true; }
+		virtual void OnClose() override;
+		virtual bool IsOpen() override { return showPanel; };
+
+		virtual std::string GetName() override { return "Profiler"; }
+
+	private:
+		struct ZoneSummary {
+			std::string name;
+			unsigned int calls = 0;
+			uint64_t inclusive = 0;
+			uint64_t exclusive = 0;
+		};
+
+		void DrawFrameGraph();
+		void DrawTimeline();
+		void DrawTopZones();
+		void DrawRenderStats();
+		void DrawSystemTimings();
+
+		void SelectFrame(uint64_t index);
+		void BuildZoneSummaries();
+
+		static bool showPanel;
+
+		std::vector<ProfileFrame> m_Frames;
+
+		// the frame shown in the timeline, the last finished one unless a frame is frozen.
+		bool m_Frozen = false;
+		ProfileFrame m_Frame = {};
+		std::vector<ProfileRecord> m_Records;
+		std::vector<ZoneSummary> m_Zones;
+		int m_TopZoneCount = 15;
+
+		// the render stats seen while each frame was the last finished one, indexed by frame % FRAME_HISTORY_SIZE.
+		Graphics::RenderFrameStats m_RenderStats[Profiler::FRAME_HISTORY_SIZE];
+	};
+}
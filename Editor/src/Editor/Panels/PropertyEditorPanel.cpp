@@ -59,6 +59,11 @@ namespace Akkad {
 				DrawTransformComponent();
 			}
 
+			if (m_ActiveEntity.HasComponent<Transform2DComponent>())
+			{
+				DrawTransform2DComponent();
+			}
+
 			if (m_ActiveEntity.HasComponent<SpriteRendererComponent>())
 			{
 				DrawSpriteRendererComponent();
@@ -156,6 +161,25 @@ namespace Akkad {
 			ImGui::Separator();
 			if (ImGui::TreeNode("2D"))
 			{
+				if (ImGui::Button("Transform 2D"))
+				{
+					// replaces the 3D transform, the z rotation and the depth are kept.
+					if (m_ActiveEntity.HasComponent<TransformComponent>())
+					{
+						auto& transform = m_ActiveEntity.GetComponent<TransformComponent>();
+						glm::vec3 position = transform.GetLocalPosition();
+						glm::vec3 rotation = transform.GetRotation();
+						glm::vec3 scale = transform.GetScale();
+						m_ActiveEntity.RemoveComponent<TransformComponent>();
+
+						auto& transform2D = m_ActiveEntity.AddComponent<Transform2DComponent>();
+						transform2D.SetPosition(glm::vec2(position));
+						transform2D.SetZ(position.z);
+						transform2D.SetRotation(rotation.z);
+						transform2D.SetScale(glm::vec2(scale));
+					}
+				}
+
 				if (ImGui::Button("Sprite Renderer"))
 				{
 					if (!m_ActiveEntity.HasComponent<SpriteRendererComponent>())
@@ -239,17 +263,17 @@ namespace Akkad {
 		if (ImGui::TreeNode("Transform"))
 		{
 			auto& transform = m_ActiveEntity.GetComponent<TransformComponent>();
-			glm::vec3 position = transform.GetPosition();
+			glm::vec3 position = transform.GetLocalPosition();
 			glm::vec3 rotation = transform.GetRotation();
 			glm::vec3 scale = transform.GetScale();
 
 			if (ImGui::DragFloat3("Position", glm::value_ptr(position)))
 			{
-				transform.SetPostion(position - transform.m_ParentPosition);
+				transform.SetPostion(position);
 			}
 			if (ImGui::DragFloat3("Rotation", glm::value_ptr(rotation)))
 			{
-				transform.SetRotation(rotation - transform.m_ParentRotation);
+				transform.SetRotation(rotation);
 			}
 			if (ImGui::DragFloat3("Scale", glm::value_ptr(scale)))
 			{
@@ -261,6 +285,37 @@ namespace Akkad {
 
 	}
 
+	void PropertyEditorPanel::DrawTransform2DComponent()
+	{
+		ImGui::SetNextItemOpen(true);
+		if (ImGui::TreeNode("Transform 2D"))
+		{
+			auto& transform = m_ActiveEntity.GetComponent<Transform2DComponent>();
+			glm::vec2 position = transform.GetLocalPosition();
+			float rotation = transform.GetRotation();
+			glm::vec2 scale = transform.GetScale();
+			float z = transform.GetZ();
+
+			if (ImGui::DragFloat2("Position", glm::value_ptr(position)))
+			{
+				transform.SetPosition(position);
+			}
+			if (ImGui::DragFloat("Rotation", &rotation))
+			{
+				transform.SetRotation(rotation);
+			}
+			if (ImGui::DragFloat2("Scale", glm::value_ptr(scale)))
+			{
+				transform.SetScale(scale);
+			}
+			if (ImGui::DragFloat("Z", &z))
+			{
+				transform.SetZ(z);
+			}
+			ImGui::TreePop();
+		}
+	}
+
 	void PropertyEditorPanel::DrawSpriteRendererComponent()
 	{
 		ImGui::SetNextItemOpen(true);
@@ -329,6 +384,12 @@ namespace Akkad {
 				ImGui::EndCombo();
 			}
 
+			int orderInLayer = sprite.sprite.GetOrderInLayer();
+			if (ImGui::InputInt("Order In Layer", &orderInLayer))
+			{
+				sprite.sprite.SetOrderInLayer(orderInLayer);
+			}
+
 			if (sprite.sprite.IsValid())
 			{
 				if (sprite.sprite.IsUsingTilemap())
@@ -973,6 +1034,12 @@ namespace Akkad {
 				ImGui::EndCombo();
 			}
 
+			int orderInLayer = animatedSprite.sprite.GetOrderInLayer();
+			if (ImGui::InputInt("Order In Layer", &orderInLayer))
+			{
+				animatedSprite.sprite.SetOrderInLayer(orderInLayer);
+			}
+
 			if (ImGui::ListBoxHeader("Animations"))
 			{
 				int id = 0;
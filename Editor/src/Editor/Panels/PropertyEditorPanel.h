@@ -30,6 +30,7 @@ namespace Akkad {
 
 		void DrawTagComponent();
 		void DrawTransformComponent();
+		void DrawTransform2DComponent();
 		void DrawSpriteRendererComponent();
 		void DrawCameraComponent();
 		void DrawScriptComponent();
@@ -48,7 +48,7 @@ namespace Akkad {
             }
             if (move_from != -1 && move_to != -1)
             {
-                std::swap(layers[move_from], layers[move_to]);
+                SortingLayer2DHandler::SwapLayers(move_from, move_to);
                 ImGui::SetDragDropPayload("SORTING_LAYER_DRAG_DROP", &move_to, sizeof(int)); // Update payload immediately so on the next frame if we move the mouse to an earlier item our index payload will be correct. This is odd and showcase how the DnD api isn't best presented in this example.
             }
             
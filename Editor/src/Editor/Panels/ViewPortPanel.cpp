@@ -8,6 +8,7 @@
 #include <Akkad/Application/Application.h>
 #include <Akkad/Input/Input.h>
 #include <Akkad/Graphics/Renderer2D.h>
+#include <Akkad/Graphics/RenderStats.h>
 #include <Akkad/ECS/Components/Components.h>
 #include <Akkad/Math/Math.h>
 #include <Akkad/GUI/GUIText.h>
@@ -28,12 +29,16 @@ namespace Akkad {
 		sceneBufferDescriptor.width = 800;
 		sceneBufferDescriptor.height = 800;
 		sceneBufferDescriptor.ColorAttachmentFormat = TextureFormat::RGB16;
-		m_buffer = Application::GetRenderPlatform()->CreateFrameBuffer(sceneBufferDescriptor);
+		m_buffer = Application::GetRenderPlatform()->AcquireRenderTarget(sceneBufferDescriptor);
 		
 	}
 
 	ViewPortPanel::~ViewPortPanel()
 	{
+		if (Application::GetRenderPlatform() != nullptr)
+		{
+			Application::GetRenderPlatform()->ReleaseRenderTarget(m_buffer);
+		}
 	}
 
 	void ViewPortPanel::DrawImGui()
@@ -55,14 +60,25 @@ namespace Akkad {
 				}
 			}
 
-			m_buffer->Bind();
 			ImVec2 viewportPanelSize = ImGui::GetContentRegionAvail();
 			m_ViewportAspectRatio = viewportPanelSize.x / viewportPanelSize.y;
 
+			// cheap when the size did not change, the storage is only reallocated by Bind() when it no longer fits.
 			m_buffer->SetSize(viewportPanelSize.x, viewportPanelSize.y);
+			m_buffer->Bind();
+
+			// the scene only covers the bottom left of the storage.
+			auto& bufferDesc = m_buffer->GetDescriptor();
+			glm::vec2 storageSize = m_buffer->GetStorageSize();
+			ImVec2 textureCoordsMax = { bufferDesc.width / storageSize.x, bufferDesc.height / storageSize.y };
 
 			auto ViewPortPos = ImGui::GetCursorScreenPos();
-			ImGui::Image((void*)m_buffer->GetColorAttachmentTexture(), viewportPanelSize, ImVec2{ 0, 1 }, ImVec2{ 1, 0 });
+			ImGui::Image((void*)m_buffer->GetColorAttachmentTexture(), viewportPanelSize, ImVec2{ 0, textureCoordsMax.y }, ImVec2{ textureCoordsMax.x, 0 });
+
+			if (ShowRenderStats)
+			{
+				DrawRenderStatsOverlay({ ViewPortPos.x, ViewPortPos.y });
+			}
 
 			if (ImGui::BeginDragDropTarget())
 			{
@@ -109,28 +125,42 @@ namespace Akkad {
 					{
 						int bufferX = mouseX - (int)ViewPortPos.x;
 						int bufferY = mouseY - (int)ViewPortPos.y;
-						auto pickingBuffer = EditorLayer::GetActiveScene()->GetPickingBuffer();
-						if (pickingBuffer != nullptr)
-						{
-							auto pixel = pickingBuffer->ReadPixels(bufferX, viewportPanelSize.y - bufferY - 1);
-							unsigned int entityID = pixel.x;
+						auto scene = EditorLayer::GetActiveScene();
+						entt::entity entity = entt::null;
 
-							entityID -= 1;
-							entt::entity entity = (entt::entity)entityID;
-							if (EditorLayer::GetActiveScene()->m_Registry.valid(entity))
+						if (UseGPUPicking)
+						{
+							// the read does not stall the GPU, its result is picked up a frame or two later.
+							auto pickingBuffer = scene->GetPickingBuffer();
+							if (pickingBuffer != nullptr && m_PickRequestID == 0)
 							{
-								if (!ImGuizmo::IsUsing())
-								{
-									m_SelectedEntity = { entity, EditorLayer::GetActiveScene().get() };
-									auto scene = EditorLayer::GetActiveScene();
-								}
+								m_PickRequestBuffer = pickingBuffer;
+								m_PickRequestID = pickingBuffer->RequestPixels(bufferX, viewportPanelSize.y - bufferY - 1);
+							}
+						}
+						else
+						{
+							glm::mat4 viewProjection = m_EditorCamera.GetProjection() * glm::inverse(m_EditorCamera.GetTransformMatrix());
+							entity = scene->Pick({ bufferX, bufferY }, viewProjection);
+						}
 
+						if (entity != entt::null && scene->m_Registry.valid(entity))
+						{
+							if (!ImGuizmo::IsUsing())
+							{
+								m_SelectedEntity = { entity, scene.get() };
 							}
+
 						}
 					}
 				}
 			}
 
+			if (m_PickRequestID != 0)
+			{
+				PollPickRequest();
+			}
+
 			/* Rendering gizmos */
 			if (m_SelectedEntity.IsValid())
 			{
@@ -188,14 +218,15 @@ namespace Akkad {
 
 					if (ImGuizmo::IsUsing())
 					{
+						// the gizmo edits the world matrix, the component stores it relative to the parent.
+						glm::mat4 localTransform = glm::inverse(comp.GetParentMatrix()) * transform;
 						glm::vec3 translation, rotation, scale;
-						DecomposeTransform(transform, translation, rotation, scale);
+						DecomposeTransform(localTransform, translation, rotation, scale);
 
 						glm::vec3 deltaRotation = rotation - comp.GetRotation();
-						comp.SetPostion(translation - comp.m_ParentPosition);
+						comp.SetPostion(translation);
 						comp.SetScale(scale);
-						auto& rotationc = comp.GetRotation();
-						rotationc += deltaRotation;
+						comp.SetRotation(comp.GetRotation() + deltaRotation);
 					}
 				}
 
@@ -239,6 +270,71 @@ namespace Akkad {
 		sceneManager->LoadSceneEditor(EditorLayer::GetActiveScenePath());
 	}
 
+	void ViewPortPanel::DrawRenderStatsOverlay(glm::vec2 position)
+	{
+		auto stats = RenderStats::GetLastFrame();
+
+		char text[512];
+		snprintf(text, sizeof(text),
+			"draw calls : %u (%u instanced, %u instances)\n"
+			"vertices : %u\n"
+			"render packets : %u\n"
+			"state changes : %u (%u elided)\n"
+			"texture binds : %u\n"
+			"buffer uploads : %u (%.1f KB)\n"
+			"uniform uploads : %u\n"
+			"framebuffer resizes : %u",
+			stats.drawCalls, stats.instancedDrawCalls, stats.instances, stats.vertices, stats.renderPackets,
+			stats.stateChanges, stats.elidedStateChanges, stats.textureBinds,
+			stats.bufferUploads, stats.bufferBytesUploaded / 1024.0f, stats.uniformUploads, stats.framebufferResizes);
+
+		// every Renderer2D draw of the frame is counted, the game view and the picking pass included.
+		ImVec2 textPosition = { position.x + 8, position.y + 8 };
+		ImVec2 textSize = ImGui::CalcTextSize(text);
+
+		auto drawList = ImGui::GetWindowDrawList();
+		drawList->AddRectFilled({ textPosition.x - 4, textPosition.y - 4 }, { textPosition.x + textSize.x + 4, textPosition.y + textSize.y + 4 }, IM_COL32(0, 0, 0, 160));
+		drawList->AddText(textPosition, IM_COL32(255, 255, 255, 255), text);
+	}
+
+	void ViewPortPanel::PollPickRequest()
+	{
+		std::vector<float> pixels;
+		if (!m_PickRequestBuffer->GetRequestedPixels(m_PickRequestID, pixels))
+		{
+			// the picking pass stops with UseGPUPicking, the request would never complete.
+			if (!UseGPUPicking)
+			{
+				m_PickRequestID = 0;
+				m_PickRequestBuffer = nullptr;
+			}
+			return;
+		}
+
+		auto scene = EditorLayer::GetActiveScene();
+		bool sameScene = scene->GetPickingBuffer() == m_PickRequestBuffer;
+
+		m_PickRequestID = 0;
+		m_PickRequestBuffer = nullptr;
+
+		if (pixels.empty() || !sameScene)
+		{
+			return;
+		}
+
+		unsigned int entityID = pixels[0];
+		entityID -= 1;
+		entt::entity entity = (entt::entity)entityID;
+
+		if (entity != entt::null && scene->m_Registry.valid(entity))
+		{
+			if (!ImGuizmo::IsUsing())
+			{
+				m_SelectedEntity = { entity, scene.get() };
+			}
+		}
+	}
+
 	void ViewPortPanel::RenderScene()
 	{
 		m_EditorCamera.SetAspectRatio(m_ViewportAspectRatio);
@@ -248,7 +344,10 @@ namespace Akkad {
 			auto sceneManager = Application::GetSceneManager();
 			sceneManager->GetActiveScene()->SetViewportSize({ m_buffer->GetDescriptor().width, m_buffer->GetDescriptor().height });
 			Renderer2D::BeginScene(m_EditorCamera, m_EditorCamera.GetTransformMatrix());
-			sceneManager->GetActiveScene()->RenderPickingBuffer2D();
+			if (UseGPUPicking)
+			{
+				sceneManager->GetActiveScene()->RenderPickingBuffer2D();
+			}
 
 			m_buffer->Bind();
 			sceneManager->GetActiveScene()->Render2D();
@@ -266,7 +365,10 @@ namespace Akkad {
 			EditorLayer::GetActiveScene()->UpdateTransforms();
 			Renderer2D::BeginScene(m_EditorCamera, m_EditorCamera.GetTransformMatrix());
 
-			EditorLayer::GetActiveScene()->RenderPickingBuffer2D();
+			if (UseGPUPicking)
+			{
+				EditorLayer::GetActiveScene()->RenderPickingBuffer2D();
+			}
 
 			m_buffer->Bind();
 			EditorLayer::GetActiveScene()->Render2D();
@@ -26,6 +26,10 @@ namespace Akkad {
 
 		bool IsPlaying = false;
 		bool IsSelected = false;
+		// selects through the picking buffer instead of Scene::Pick, renders the picking pass every frame.
+		bool UseGPUPicking = false;
+		// draws the render stats of the last frame over the scene.
+		bool ShowRenderStats = false;
 
 		void SetSelectedEntity(Entity selectedEntity)
 		{
@@ -39,10 +43,16 @@ namespace Akkad {
 		Graphics::Rect m_ViewportRect;
 		Entity m_SelectedEntity;
 
+		// pending read of the picking buffer, 0 when there is none.
+		unsigned int m_PickRequestID = 0;
+		SharedPtr<Graphics::FrameBuffer> m_PickRequestBuffer;
+
 		void OnScenePlay();
 		void OnSceneStop();
 
 		void RenderScene();
+		void DrawRenderStatsOverlay(glm::vec2 position);
+		void PollPickRequest();
 
 		friend class EditorLayer;
 		friend class GameViewPanel;
@@ -32,6 +32,11 @@ project "Runtime"
 	filter "system:windows"
 		systemversion "latest"
 
+	filter "system:linux"
+		if not _OPTIONS['target-emscripten'] then
+			links { "Glad", "curl-lib", "imgui", "spdlog", "SPIRV-Cross", "box2d", "X11", "EGL", "dl", "pthread" }
+		end
+
 	filter "configurations:Debug"
 		defines "AK_DEBUG"
 		runtime "Debug"
@@ -1,6 +1,7 @@
 #include "RuntimeLayer.h"
 
 #include <Akkad/Graphics/Renderer2D.h>
+#include <Akkad/Graphics/RenderStats.h>
 #include <Akkad/Graphics/SortingLayer2D.h>
 #include <fstream>
 #include <map>
@@ -16,9 +17,56 @@ namespace Akkad {
 		settings.window_settings.width = 800;
 		settings.window_settings.height = 600;
 		settings.window_settings.title = windowTitle.c_str();
+		settings.headless = m_Headless;
+		settings.offscreen = m_Offscreen;
+		settings.job_worker_threads = m_JobWorkerThreads;
 		Application::Init(settings);
 	}
 
+	void RuntimeLayer::ParseCommandLine(int argc, char** argv)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			std::string argument = argv[i];
+
+			if (argument == "--headless")
+			{
+				m_Headless = true;
+			}
+
+			else if (argument == "--offscreen")
+			{
+				m_Offscreen = true;
+			}
+
+			else if (argument == "--render-stats" && i + 1 < argc)
+			{
+				std::string path = argv[++i];
+				m_RenderStatsAsJSON = path.size() >= 5 && path.compare(path.size() - 5, 5, ".json") == 0;
+				m_RenderStatsFile.open(path, std::ios::trunc);
+
+				if (!m_RenderStatsFile.is_open())
+				{
+					AK_ERROR("could not open the render stats file {}", path);
+				}
+				else if (!m_RenderStatsAsJSON)
+				{
+					m_RenderStatsFile << Graphics::RenderStats::GetCSVHeader() << "\n";
+				}
+			}
+
+			else if (argument == "--frames" && i + 1 < argc)
+			{
+				m_FrameLimit = std::stoul(argv[++i]);
+			}
+
+			else if (argument == "--job-workers" && i + 1 < argc)
+			{
+				m_JobWorkerThreads = std::stoi(argv[++i]);
+			}
+		}
+	}
+
 	void RuntimeLayer::OnAttach()
 	{
 		LoadGameAssembly();
@@ -42,12 +90,41 @@ namespace Akkad {
 
 		sceneManager->GetActiveScene()->Update();
 
-		sceneManager->GetActiveScene()->RenderPickingBuffer2D();
 		sceneManager->GetActiveScene()->BeginRenderer2D((float)window->GetWidth() / (float)window->GetHeight());
 		sceneManager->GetActiveScene()->Render2D();
 		Graphics::Renderer2D::EndScene();
 		sceneManager->GetActiveScene()->RenderGUI();
 
+		if (m_RenderStatsFile.is_open())
+		{
+			DumpRenderStats();
+		}
+
+		m_FrameCount++;
+		if (m_FrameLimit != 0 && m_FrameCount >= m_FrameLimit)
+		{
+			Application::Shutdown();
+		}
+	}
+
+	void RuntimeLayer::DumpRenderStats()
+	{
+		// with threaded rendering the last finished frame lags behind, a frame is only written once.
+		auto stats = Graphics::RenderStats::GetLastFrame();
+		if (stats.frame <= m_LastDumpedFrame)
+		{
+			return;
+		}
+
+		m_LastDumpedFrame = stats.frame;
+		if (m_RenderStatsAsJSON)
+		{
+			m_RenderStatsFile << Graphics::RenderStats::ToJSON(stats) << "\n";
+		}
+		else
+		{
+			m_RenderStatsFile << Graphics::RenderStats::ToCSV(stats) << "\n";
+		}
 	}
 
 	void RuntimeLayer::RenderImGui()
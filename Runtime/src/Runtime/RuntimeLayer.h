@@ -2,12 +2,19 @@
 #include <Akkad/Akkad.h>
 
 #include <json.hpp>
+#include <fstream>
 namespace Akkad {
 
 	class RuntimeLayer : public Layer
 	{
 	public:
 		void InitializeEngine();
+		// --render-stats <file> : writes the render stats of every frame, as JSON lines for a .json file, CSV otherwise.
+		// --frames <count> : quits after the given amount of frames.
+		// --headless : runs without a window nor GPU on the null render platform, with a fixed time step.
+		// --offscreen : linux only, renders on the GPU without opening a window.
+		// --job-workers <count> : amount of job worker threads, one per hardware thread besides the main thread by default.
+		void ParseCommandLine(int argc, char** argv);
 		virtual void OnAttach() override;
 		virtual void OnDetach() override;
 		virtual void OnUpdate() override;
@@ -21,7 +28,18 @@ namespace Akkad {
 		void RegisterSortingLayers();
 		void LoadStartupScene();
 		/*-------------------------*/
+		void DumpRenderStats();
+
 		nlohmann::json m_packageInfo;
+
+		std::ofstream m_RenderStatsFile;
+		bool m_RenderStatsAsJSON = false;
+		uint64_t m_LastDumpedFrame = 0;
+		unsigned int m_FrameLimit = 0;
+		unsigned int m_FrameCount = 0;
+		bool m_Headless = false;
+		bool m_Offscreen = false;
+		int m_JobWorkerThreads = -1;
 	};
 }
 
@@ -3,9 +3,10 @@
 using namespace Akkad;
 using namespace Graphics;
 
-int main()
+int main(int argc, char** argv)
 {
 	RuntimeLayer* layer = new RuntimeLayer();
+	layer->ParseCommandLine(argc, argv);
 	Application::AttachLayer(layer);
 	layer->InitializeEngine();
 	Application::Run();
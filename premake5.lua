@@ -67,6 +67,10 @@ workspace "Akkad"
     include "Runtime"
     
     if not _OPTIONS['target-emscripten'] then
-      include "Editor"
+      -- the editor needs the win32 ImGui backend and file dialogs
+      if os.target() ~= "linux" then
+        include "Editor"
+      end
       include "GameAssembly"
+      include "Benchmarks"
     end
\ No newline at end of file
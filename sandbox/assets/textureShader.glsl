@@ -4,6 +4,12 @@
 layout (location = 0) in vec3 position;
 layout (location = 1) in vec2 aTexCoord;
 
+// per instance attributes, see Renderer2D::QuadInstance
+layout (location = 2) in vec2 aTranslation;
+layout (location = 3) in vec4 aLinear;
+layout (location = 4) in vec4 aInstanceColor;
+layout (location = 5) in vec4 aTextureRect;
+
 out vec2 TexCoord;
 
 layout (std140) uniform sys_SceneProps {
@@ -16,10 +22,16 @@ layout (std140) uniform shader_props {
     float tintColorIntensity;
 };
 
+// the columns of the 2x2 part of the world matrix, scale and rotation in the order the engine composes them
+vec2 InstancePosition()
+{
+    return mat2(aLinear.xy, aLinear.zw) * position.xy + aTranslation;
+}
+
 void main()
 {
-    gl_Position = sys_viewProjection * sys_transform * vec4(position, 1.0);
-    TexCoord = aTexCoord;
+    gl_Position = sys_viewProjection * vec4(InstancePosition(), 0.0, 1.0);
+    TexCoord = mix(aTextureRect.xy, aTextureRect.zw, aTexCoord);
 }
 
 #FRAGMENT_SHADER
@@ -19,6 +19,7 @@ project "sandbox"
 		"%{IncludeDir.spdlog}",
 		"%{IncludeDir.stb}",
 		"%{IncludeDir.json}",
+		"%{IncludeDir.concurrentqueue}",
 
 	}
 
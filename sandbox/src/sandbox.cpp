@@ -58,6 +58,13 @@ public:
 		r2d_texturedrect.assetName = "r2d_texturedRect";
 		r2d_texturedrect.assetType = AssetType::SHADER;
 		assetManager->RegisterAsset("4", r2d_texturedrect);
+
+		AssetDescriptor r2d_guishader;
+		r2d_guishader.absolutePath = "assets/compiledSPV/r2d_guiShader.shaderdesc";
+		r2d_guishader.assetID = "5";
+		r2d_guishader.assetName = "r2d_guiShader";
+		r2d_guishader.assetType = AssetType::SHADER;
+		assetManager->RegisterAsset("5", r2d_guishader);
 		Renderer2D::InitShaders();
 
 		